@@ -0,0 +1,134 @@
+/*
+ * Benchmarks of the traversals built on HtmlElement::Walk.
+ *
+ *   g++ -std=c++11 -O2 -pthread -I.. bench-traversal.cpp -o bench-traversal
+ *   ./bench-traversal [rows] [depth] [runs]
+ *
+ * every traversal runs on a wide document, a table of rows, and on a deep
+ * one, nested divs. the best of runs is printed in milliseconds and in
+ * nanoseconds per element.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include "html_parser.hpp"
+#include "html_parser_diff.hpp"
+#include "html_parser_json.hpp"
+#include "html_parser_parallel.hpp"
+#include "html_parser_selector.hpp"
+#include "html_parser_snapshot.hpp"
+
+using namespace std;
+
+static string Repeat(const string &s, size_t n) {
+    string r;
+    r.reserve(s.size() * n);
+    for (size_t i = 0; i < n; i++) r += s;
+    return r;
+}
+
+static string Wide(size_t rows) {
+    string row = "<tr class=\"row\"><td><a href=\"/x\">link</a></td><td>text &amp; <b>bold</b></td></tr>";
+    return "<html><body><table>" + Repeat(row, rows) + "</table></body></html>";
+}
+
+static string Deep(size_t depth) {
+    return "<html>" + Repeat("<div class=\"d\">", depth) + "<p id=\"x\">deep</p>" + Repeat("</div>", depth) + "</html>";
+}
+
+/**
+ * best of runs in milliseconds, prepare is not timed
+ */
+static double Best(size_t runs, const function<void()> &prepare, const function<void()> &run) {
+    double best = 1e18;
+    for (size_t i = 0; i < runs; i++) {
+        prepare();
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        run();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count());
+    }
+
+    return best;
+}
+
+/**
+ * counts the elements of a walk
+ */
+struct Counter : HtmlVisitor {
+    Counter()
+            : elements(0) {}
+
+    HtmlWalk Enter(const shared_ptr<HtmlElement> &) {
+        elements++;
+        return HTML_WALK_CONTINUE;
+    }
+
+    size_t elements;
+};
+
+static void Report(const char *name, size_t elements, double ms) {
+    printf("  %-24s %10.3f ms %8.1f ns/element\n", name, ms, ms * 1e6 / elements);
+}
+
+static void Run(const char *title, const string &html, size_t runs) {
+    HtmlParser parser;
+    parser.SetSubtreeHashes(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    // without subtree hashes the diff compares every element
+    HtmlParser plain;
+    shared_ptr<HtmlDocument> before = plain.Parse(html);
+    shared_ptr<HtmlDocument> after = plain.Parse(html);
+    shared_ptr<HtmlElement> top = doc->GetRoot()->ChildBegin()[0];
+    Counter counter;
+    doc->GetRoot()->Walk(counter);
+    size_t elements = counter.elements;
+    printf("%s: %zu bytes, %zu elements\n", title, html.size(), elements);
+
+    HtmlSelectorSet set;
+    set.Add("//a");
+    set.Add("//td/b");
+    set.Add("//p");
+    HtmlParallelQuery parallel(doc);
+
+    function<void()> none = [] {};
+    size_t sink = 0;
+    Report("GetElementById (miss)", elements, Best(runs, none, [&] { sink += !!doc->GetElementById("none"); }));
+    Report("GetElementByTagName", elements, Best(runs, none, [&] { sink += doc->GetElementByTagName("a").size(); }));
+    Report("GetElementByClassName", elements, Best(runs, none, [&] { sink += doc->GetElementByClassName("row").size(); }));
+    Report("SelectElement(//a)", elements, Best(runs, none, [&] { sink += doc->SelectElement("//a").size(); }));
+    Report("text()", elements, Best(runs, none, [&] { sink += top->text().size(); }));
+    Report("html()", elements, Best(runs, none, [&] { sink += top->html().size(); }));
+    Report("MemoryUsage", elements, Best(runs, none, [&] { sink += doc->MemoryUsage().Total(); }));
+    Report("Compact", elements, Best(runs, none, [&] { doc->Compact(); }));
+    Report("HtmlSelectorSet", elements, Best(runs, none, [&] { sink += set.Select(doc).size(); }));
+    Report("HtmlJsonWriter", elements, Best(runs, none, [&] { sink += HtmlJsonWriter::ToJson(doc).size(); }));
+    Report("HtmlTreeDiff", elements, Best(runs, none, [&] { sink += HtmlTreeDiff::Compare(before, after).size(); }));
+    Report("HtmlSnapshot::Serialize", elements, Best(runs, none, [&] { sink += HtmlSnapshot::Serialize(doc).size(); }));
+    Report("HtmlParallelQuery(//a)", elements, Best(runs, none, [&] { sink += parallel.SelectElement("//a").size(); }));
+
+    // the destructor, on documents parsed before the clock starts. the
+    // parser holds the root of its last document until the next parse.
+    shared_ptr<HtmlDocument> victim;
+    Report("~HtmlDocument", elements, Best(runs, [&] {
+        victim = plain.Parse(html);
+        plain.Parse("");
+    }, [&] { victim.reset(); }));
+
+    if (sink == 0) printf("\n");
+}
+
+int main(int argc, char **argv) {
+    size_t rows = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000;
+    size_t depth = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+    size_t runs = argc > 3 ? strtoul(argv[3], NULL, 10) : 10;
+
+    // the parser warns about every unclosed element
+    cerr.setstate(ios::failbit);
+    Run("wide", Wide(rows), runs);
+    Run("deep", Deep(depth), runs);
+    return 0;
+}
@@ -17,6 +17,15 @@
 #include <map>
 #include <set>
 #include <unordered_set>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "html_parser_entity.hpp"
 
 #if __cplusplus <= 199711L
 #if linux
@@ -37,742 +46,3005 @@ using std::weak_ptr;
 #endif
 
 /**
- * class HtmlElement
- * HTML Element struct
+ * tag property flags, see HtmlTag::Lookup
  */
-class HtmlElement : public enable_shared_from_this<HtmlElement> {
-public:
-    friend class HtmlParser;
-
-    friend class HtmlDocument;
+enum HtmlTagFlag {
+    HTML_TAG_VOID = 1,          // never has content or a close tag: <br>
+    HTML_TAG_RAW_TEXT = 2,      // content kept verbatim until the close tag: <script>
+    HTML_TAG_INVISIBLE = 4,     // skipped by text()
+    HTML_TAG_BLOCK = 8,         // text() starts a new line before it
+    HTML_TAG_TABLE_CELL = 16    // text() puts a tab before it
+};
 
+/**
+ * class HtmlTag
+ * compile-time tag property table, indexed by a perfect hash of the tag name
+ */
+class HtmlTag {
 public:
-    /**
-     * for children traversals.
-     */
-    typedef std::vector<shared_ptr<HtmlElement> >::const_iterator ChildIterator;
-
-    const ChildIterator ChildBegin() {
-        return children.begin();
+    static constexpr unsigned Hash(const char *name, size_t len) {
+        return len == 0 ? 0 : ((unsigned char) name[0] + 3u * (unsigned char) name[len - 1] + 9u * (unsigned) len) & 127u;
     }
 
-    const ChildIterator ChildEnd() {
-        return children.end();
-    }
+    static unsigned Lookup(const char *name, size_t len) {
+        struct Entry {
+            const char *name;
+            size_t len;
+            unsigned flags;
+        };
 
-    /**
-     * for attribute traversals.
-     */
-    typedef std::map<std::string, std::string>::const_iterator AttributeIterator;
+        static constexpr Entry entry[] = {
+            {"", 0, 0},
+            {"script", 6, HTML_TAG_RAW_TEXT | HTML_TAG_INVISIBLE},
+            {"h1", 2, HTML_TAG_BLOCK},
+            {"h2", 2, HTML_TAG_BLOCK},
+            {"noscript", 8, HTML_TAG_RAW_TEXT},
+            {"h3", 2, HTML_TAG_BLOCK},
+            {"h4", 2, HTML_TAG_BLOCK},
+            {"h5", 2, HTML_TAG_BLOCK},
+            {"h6", 2, HTML_TAG_BLOCK},
+            {"h7", 2, HTML_TAG_BLOCK},
+            {"area", 4, HTML_TAG_VOID | HTML_TAG_BLOCK},
+            {"td", 2, HTML_TAG_TABLE_CELL},
+            {"meta", 4, HTML_TAG_VOID | HTML_TAG_INVISIBLE},
+            {"base", 4, HTML_TAG_VOID},
+            {"head", 4, HTML_TAG_INVISIBLE},
+            {"img", 3, HTML_TAG_VOID},
+            {"embed", 5, HTML_TAG_VOID},
+            {"col", 3, HTML_TAG_VOID},
+            {"p", 1, HTML_TAG_BLOCK},
+            {"br", 2, HTML_TAG_VOID | HTML_TAG_BLOCK},
+            {"command", 7, HTML_TAG_VOID},
+            {"style", 5, HTML_TAG_RAW_TEXT | HTML_TAG_INVISIBLE},
+            {"hr", 2, HTML_TAG_VOID | HTML_TAG_BLOCK},
+            {"link", 4, HTML_TAG_VOID | HTML_TAG_INVISIBLE},
+            {"source", 6, HTML_TAG_VOID},
+            {"tr", 2, HTML_TAG_BLOCK},
+            {"div", 3, HTML_TAG_BLOCK},
+            {"track", 5, HTML_TAG_VOID},
+            {"param", 5, HTML_TAG_VOID},
+            {"wbr", 3, HTML_TAG_VOID},
+            {"keygen", 6, HTML_TAG_VOID},
+            {"input", 5, HTML_TAG_VOID},
+        };
 
-    const AttributeIterator AttributeBegin() {
-        return attribute.begin();
-    }
+        // generated: entry index of every hash slot, 0 when no tag hashes there
+        static constexpr unsigned char slot[128] = {
+             0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+             3,  0,  4,  5,  0,  0,  6,  0,  0,  7,  0,  0,  8,  0,  0,  9,
+             0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+             0,  0, 11,  0, 12, 13,  0,  0, 14, 15,  0,  0,  0,  0, 16,  0,
+             0,  0, 17,  0,  0,  0,  0,  0,  0, 18, 19,  0,  0,  0, 20, 21,
+            22, 23,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0, 25,  0,  0,  0,
+             0, 26, 27,  0, 28,  0,  0,  0, 29,  0,  0, 30,  0,  0,  0,  0,
+             0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        };
 
-    const AttributeIterator AttributeEnd() {
-        return attribute.end();
+        const Entry &e = entry[slot[Hash(name, len)]];
+        return (e.len == len && memcmp(e.name, name, len) == 0) ? e.flags : 0;
     }
 
-public:
-    HtmlElement() {}
-
-    HtmlElement(shared_ptr<HtmlElement> p)
-            : parent(p) {}
-
-    std::string GetAttribute(const std::string &k) {
-        if (attribute.find(k) != attribute.end()) {
-            return attribute[k];
-        }
-
-        return "";
+    static unsigned Lookup(const std::string &name) {
+        return Lookup(name.data(), name.size());
     }
 
-    shared_ptr<HtmlElement> GetElementById(const std::string &id) {
-        for (HtmlElement::ChildIterator it = children.begin(); it != children.end(); ++it) {
-            if ((*it)->GetAttribute("id") == id) return *it;
-
-            shared_ptr<HtmlElement> r = (*it)->GetElementById(id);
-            if (r) return r;
-        }
-
-        return shared_ptr<HtmlElement>();
-    }
+    /**
+     * the name of a close tag: all from begin, right after "</", up to
+     * the '>' that ends at end. names longer than max are cut like start
+     * tag names.
+     * @return true when the name was cut
+     */
+    static bool CloseName(const char *begin, const char *end, size_t max, std::string &name) {
+        name.clear();
+        if (end > begin + 1)
+            name.append(begin, end - begin - 1);
+        else
+            name.append(begin, end - begin);
 
-    std::vector<shared_ptr<HtmlElement> > GetElementByClassName(const std::string &name) {
-        std::vector<shared_ptr<HtmlElement> > result;
-        GetElementByClassName(name, result);
-        return result;
-    }
+        if (name.size() <= max) return false;
 
-    std::vector<shared_ptr<HtmlElement> > GetElementByTagName(const std::string &name) {
-        std::vector<shared_ptr<HtmlElement> > result;
-        GetElementByTagName(name, result);
-        return result;
+        name.resize(max);
+        return true;
     }
+};
 
-    void SelectElement(const std::string& rule, std::vector<shared_ptr<HtmlElement> >& result){
-        if(rule.empty() || rule.at(0) != '/' || name == "plain") return;
-        std::string::size_type pos = 0;
-        if(rule.size() >= 2 && rule.at(1) == '/') {
-            std::vector<shared_ptr<HtmlElement> > temp;
-            GetAllElement(temp);
-            pos = 1;
-            std::string next = rule.substr(pos);
-            if(next.empty()) {
-                for(size_t i = 0; i < temp.size(); i++){
-                    InsertIfNotExists(result, temp[i]);
-                }
-            } else {
-                for(size_t i = 0; i < temp.size(); i++){
-                    temp[i]->SelectElement(next, result);;
-                }
-            }
-        } else {
-            std::string::size_type p = rule.find('/', 1);
-            std::string line;
-            if(p == std::string::npos) {
-                line = rule;
-                pos = rule.size();
-            } else {
-                line = rule.substr(0, p);
-                pos = p;
-            }
-
-            enum { x_ele, x_wait_attr, x_attr, x_val };
-            std::string ele, attr, oper, val, cond;
-            int state = x_ele;
-            for(p = 1; p < pos; ) {
-                char c = line.at(p++);
-                switch (state) {
-                    case x_ele: {
-                        if(c == '@') {
-                            state = x_attr;
-                        } else if(c == '!') {
-                            state = x_wait_attr;
-                            cond.append(1,c);
-                        } else if(c == '[') {
-                            state = x_wait_attr;
-                        } else {
-                            ele.append(1,c);
-                        }
-                    }
-                    break;
-
-                    case x_wait_attr: {
-                        if(c == '@') state = x_attr;
-                        else if(c == '!') {
-                            cond.append(1,c);
-                        }
-                    }
-                    break;
-
-                    case x_attr: {
-                        if(c == '!') {
-                            oper.append(1,c);
-                        } else if(c == '=') {
-                            oper.append(1,c);
-                            state = x_val;
-                        } else if(c == ']') {
-                            state = x_ele;
-                        } else {
-                            attr.append(1,c);
-                        }
-                    }
-                    break;
-
-                    case x_val: {
-                        if(c == ']') {
-                            state = x_ele;
-                        } else {
-                            val.append(1,c);
-                        }
+/**
+ * struct HtmlSelectStep
+ * one "/tag[@attr='value']" step of a select rule and its predicate
+ */
+struct HtmlSelectStep {
+    /**
+     * parses the step held in rule[0, end), rule[0] being its leading '/'.
+     */
+    HtmlSelectStep(const std::string &rule, std::string::size_type end) {
+        enum { x_ele, x_wait_attr, x_attr, x_val };
+        int state = x_ele;
+        for(std::string::size_type p = 1; p < end; ) {
+            char c = rule.at(p++);
+            switch (state) {
+                case x_ele: {
+                    if(c == '@') {
+                        state = x_attr;
+                    } else if(c == '!') {
+                        state = x_wait_attr;
+                        cond.append(1,c);
+                    } else if(c == '[') {
+                        state = x_wait_attr;
+                    } else {
+                        ele.append(1,c);
                     }
-                    break;
-                }
-            }
-
-            if(!val.empty() && val.at(0) == '\''){
-                val.erase(val.begin());
-            }
-
-            if(!val.empty() && val.at(val.size() - 1) == '\''){
-                val.pop_back();
-            }
-
-            bool matched = true;
-            if(!ele.empty()){
-                if(name != ele) {
-                    matched = false;
                 }
-            }
+                break;
 
-            if(cond == "!"){
-                if(!attr.empty() && matched){
-                    if(!oper.empty()){
-                        std::string v = attribute[attr];
-                        if(oper == "="){
-                            if(v == val) matched = false;
-                            if (attr == "class") {
-                                std::set<std::string> attr_class = SplitClassName(GetAttribute("class"));
-                                if (attr_class.find(val) != attr_class.end()) matched = false;
-                            }
-                        } else if (oper == "!=") {
-                            if (v == val) matched = false;
-                            if (attr == "class") {
-                                std::set<std::string> attr_class = SplitClassName(GetAttribute("class"));
-                                if (attr_class.find(val) == attr_class.end()) matched = false;
-                            }
-                        }
-                    } else {
-                        if(attribute.find(attr) != attribute.end()) matched = false;
+                case x_wait_attr: {
+                    if(c == '@') state = x_attr;
+                    else if(c == '!') {
+                        cond.append(1,c);
                     }
                 }
-            } else {
-                if (!attr.empty() && matched) {
-                    if (attribute.find(attr) == attribute.end()) {
-                        matched = false;
+                break;
+
+                case x_attr: {
+                    if(c == '!') {
+                        oper.append(1,c);
+                    } else if(c == '=') {
+                        oper.append(1,c);
+                        state = x_val;
+                    } else if(c == ']') {
+                        state = x_ele;
                     } else {
-                        std::string v = attribute[attr];
-                        if (oper == "=") {
-                            if (v != val) matched = false;
-                            if (attr == "class") {
-                                std::set<std::string> attr_class = SplitClassName(GetAttribute("class"));
-                                if (attr_class.find(val) == attr_class.end()) matched = false;
-                            }
-                        } else if (oper == "!=") {
-                            if (v == val) matched = false;
-                            if (attr == "class") {
-                                std::set<std::string> attr_class = SplitClassName(GetAttribute("class"));
-                                if (attr_class.find(val) != attr_class.end()) matched = false;
-                            }
-                        }
+                        attr.append(1,c);
                     }
                 }
-            }
+                break;
 
-            std::string next = rule.substr(pos);
-            if(matched) {
-                if(next.empty())
-                    InsertIfNotExists(result, shared_from_this());
-                else {
-                    for(ChildIterator it = ChildBegin(); it != ChildEnd(); it++){
-                        (*it)->SelectElement(next, result);
+                case x_val: {
+                    if(c == ']') {
+                        state = x_ele;
+                    } else {
+                        val.append(1,c);
                     }
                 }
+                break;
             }
-        };
-    }
-
-    shared_ptr<HtmlElement> GetParent() {
-        return parent.lock();
-    }
-
-    const std::string &GetValue() {
-        if(value.empty() && children.size() == 1 && children[0]->GetName() == "plain"){
-            return children[0]->GetValue();
-        }
-
-        return value;
-    }
-
-    const std::string &GetName() {
-        return name;
-    }
-
-    std::string text(){
-        std::string str;
-        PlainStylize(str);
-        return str;
-    }
-
-    void PlainStylize(std::string& str){
-        if(name == "head" || name == "meta" || name == "style" || name == "script" || name == "link"){
-            return ;
         }
 
-        if(name == "plain"){
-            str.append(value);
-            return;
+        if(!val.empty() && val.at(0) == '\''){
+            val.erase(val.begin());
         }
 
-        for (size_t i = 0; i < children.size();) {
-            children[i]->PlainStylize(str);
-
-            if (++i < children.size()) {
-                std::string ele = children[i]->GetName();
-                if (ele == "td") {
-                    str.append("\t");
-                }
-                else if (ele == "tr" || ele == "br" || ele == "div" || ele == "p" || ele == "hr" || ele == "area" ||
-                  ele == "h1" || ele == "h2" || ele == "h3" || ele == "h4" || ele == "h5" || ele == "h6" || ele == "h7") {
-                    str.append("\n");
-                }
-            }
+        if(!val.empty() && val.at(val.size() - 1) == '\''){
+            val.erase(val.size() - 1);
         }
     }
 
-    std::string html(){
-        std::string str;
-        HtmlStylize(str);
-        return str;
-    }
-
-    void HtmlStylize(std::string& str) {
-        if (name.empty()) {
-            for (size_t i = 0; i < children.size(); i++) {
-                children[i]->HtmlStylize(str);
+    /**
+     * @param name tag name of the element
+     * @param v value of the element's attribute named attr
+     * @param has false when the element has no such attribute
+     */
+    bool Match(const char *name, size_t name_len, const char *v, size_t v_len, bool has) const {
+        bool matched = true;
+        if(!ele.empty()){
+            if(ele.size() != name_len || ele.compare(0, name_len, name, name_len) != 0) {
+                matched = false;
             }
-
-            return;
-        } else if(name == "plain"){
-            str.append(value);
-            return;
         }
 
-        str.append("<" + name);
-        std::map<std::string, std::string>::const_iterator it = attribute.begin();
-        for (; it != attribute.end(); it++) {
-            str.append(" " + it->first + "=\"" + it->second + "\"");
-        }
-        str.append(">");
-        
-        if (children.empty()) {
-            str.append(value);
+        if (attr.empty() || !matched) return matched;
+
+        if (!has) v_len = 0;
+        bool equal = val.size() == v_len && val.compare(0, v_len, v, v_len) == 0;
+        bool is_class = attr == "class";
+        if(cond == "!"){
+            if(!oper.empty()){
+                if(oper == "="){
+                    if(equal) matched = false;
+                    if (is_class && HasClass(v, v_len, val)) matched = false;
+                } else if (oper == "!=") {
+                    if (equal) matched = false;
+                    if (is_class && !HasClass(v, v_len, val)) matched = false;
+                }
+            } else {
+                if(has) matched = false;
+            }
         } else {
-            for (size_t i = 0; i < children.size(); i++) {
-                children[i]->HtmlStylize(str);
+            if (!has) {
+                matched = false;
+            } else if (oper == "=") {
+                if (!equal) matched = false;
+                if (is_class && !HasClass(v, v_len, val)) matched = false;
+            } else if (oper == "!=") {
+                if (equal) matched = false;
+                if (is_class && HasClass(v, v_len, val)) matched = false;
             }
         }
 
-        str.append("</" + name + ">");
+        return matched;
     }
 
-private:
-    void GetElementByClassName(const std::string &name, std::vector<shared_ptr<HtmlElement> > &result) {
-        for (HtmlElement::ChildIterator it = children.begin(); it != children.end(); ++it) {
-            std::set<std::string> attr_class = SplitClassName((*it)->GetAttribute("class"));
-            std::set<std::string> class_name = SplitClassName(name);
-
-            std::set<std::string>::const_iterator iter = class_name.begin();
-            for(; iter != class_name.end(); ++iter){
-                if(attr_class.find(*iter) == attr_class.end()){
-                    break;
-                }
-            }
-
-            if(iter == class_name.end()){
-                InsertIfNotExists(result, *it);
+    /**
+     * whether the space separated class list v contains name.
+     */
+    static bool HasClass(const char *v, size_t v_len, const std::string &name) {
+        size_t i = 0;
+        while (i < v_len) {
+            while (i < v_len && v[i] == ' ') i++;
+            size_t begin = i;
+            while (i < v_len && v[i] != ' ') i++;
+            if (i > begin && i - begin == name.size() && name.compare(0, name.size(), v + begin, i - begin) == 0) {
+                return true;
             }
-
-            (*it)->GetElementByClassName(name, result);
         }
+
+        return false;
     }
 
-    void GetElementByTagName(const std::string &name, std::vector<shared_ptr<HtmlElement> > &result) {
-        for (HtmlElement::ChildIterator it = children.begin(); it != children.end(); ++it) {
-            if ((*it)->name == name)
-                InsertIfNotExists(result, *it);
+    std::string ele, attr, oper, val, cond;
+};
 
-            (*it)->GetElementByTagName(name, result);
-        }
-    }
+/**
+ * struct HtmlMemoryUsage
+ * approximate heap bytes held by a document, by category
+ */
+struct HtmlMemoryUsage {
+    HtmlMemoryUsage()
+            : nodes(0), names(0), text(0), attributes(0), containers(0), source(0) {}
 
-    void GetAllElement(std::vector<shared_ptr<HtmlElement> >& result){
-        for (size_t i = 0; i < children.size(); ++i) {
-            InsertIfNotExists(result, children[i]);
-            children[i]->GetAllElement(result);
-        }
+    size_t Total() const {
+        return nodes + names + text + attributes + containers + source;
     }
 
-    void Parse(const std::string &attr) {
-        size_t index = 0;
-        std::string k;
-        std::string v;
-        char split = ' ';
-        bool quota = false;
+    size_t nodes;       // element objects and their shared_ptr control blocks
+    size_t names;       // tag name strings
+    size_t text;        // value strings
+    size_t attributes;  // attribute keys and values
+    size_t containers;  // children vector capacity and attribute map nodes
+    size_t source;      // input copy kept for subtrees not built yet, see HtmlParser::SetLazySubtrees
+};
 
-        enum ParseAttrState {
-            PARSE_ATTR_KEY,
-            PARSE_ATTR_VALUE_BEGIN,
-            PARSE_ATTR_VALUE_END,
-        };
+/**
+ * limits reported by HtmlParser::GetExceededLimits
+ */
+enum HtmlLimit {
+    HTML_LIMIT_DEPTH = 1,
+    HTML_LIMIT_NODES = 2,
+    HTML_LIMIT_ATTRIBUTES = 4,
+    HTML_LIMIT_ATTRIBUTE_LENGTH = 8,
+    HTML_LIMIT_NAME_LENGTH = 16,
+    HTML_LIMIT_TEXT_LENGTH = 32
+};
 
-        ParseAttrState state = PARSE_ATTR_KEY;
+/**
+ * struct HtmlParseLimits
+ * per parse resource limits, all unlimited by default
+ */
+struct HtmlParseLimits {
+    HtmlParseLimits()
+            : max_depth(-1), max_nodes(-1), max_attributes(-1), max_attribute_length(-1), max_name_length(-1),
+              max_text_length(-1) {}
+
+    size_t max_depth;               // start tags nested deeper are ignored, their content goes to the parent
+    size_t max_nodes;               // elements and text nodes, parsing stops and open elements are closed
+    size_t max_attributes;          // per element, further attributes are dropped
+    size_t max_attribute_length;    // longer attribute values are cut
+    size_t max_name_length;         // longer tag and attribute names are cut
+    size_t max_text_length;         // longer text of one node is cut
+};
 
-        while (attr.size() > index) {
-            char input = attr.at(index);
-            switch (state) {
+/**
+ * class HtmlAttributeReader
+ * tokenizes the attribute text of a start tag into an attribute map, names
+ * and values are copied run by run. the text may come in several pieces.
+ */
+class HtmlAttributeReader {
+public:
+    explicit HtmlAttributeReader(const HtmlParseLimits &limits)
+            : limits_(&limits), state_(PARSE_ATTR_KEY), quote_(0), exceeded_(0) {}
+
+    void Read(const char *data, size_t len, std::map<std::string, std::string> &attribute) {
+        const char *end = data + len;
+        const char *p = data;
+        while (p < end) {
+            switch (state_) {
                 case PARSE_ATTR_KEY: {
-                    if (input == '\t' || input == '\r' || input == '\n') {
-                    } else if (input == '\'' || input == '"') {
-                        std::cerr << "WARN : attribute unexpected " << input << std::endl;
-                    } else if (input == ' ') {
-                        if (!k.empty()) {
-                            attribute[k] = v;
-                            k.clear();
-                        }
-                    } else if (input == '=') {
-                        state = PARSE_ATTR_VALUE_BEGIN;
-                    } else {
-                        k.append(attr.c_str() + index, 1);
+                    const char *begin = p;
+                    while (p < end && !Class(*p)) p++;
+                    Append(key_, begin, p, limits_->max_name_length, HTML_LIMIT_NAME_LENGTH);
+                    if (p == end) break;
+
+                    unsigned c = Class(*p);
+                    if (c & ATTR_CHAR_SPACE) {
+                        if (!key_.empty()) Add(attribute);
+                    } else if (c & ATTR_CHAR_EQUAL) {
+                        state_ = PARSE_ATTR_VALUE_BEGIN;
+                    } else if (c & ATTR_CHAR_QUOTE) {
+                        std::cerr << "WARN : attribute unexpected " << *p << std::endl;
                     }
+                    p++;
                 }
                 break;
 
-                case PARSE_ATTR_VALUE_BEGIN:{
-                    if (input == '\t' || input == '\r' || input == '\n' || input == ' ') {
-                        if (!k.empty()) {
-                            attribute[k] = v;
-                            k.clear();
-                        }
-                        state = PARSE_ATTR_KEY;
-                    } else if (input == '\'' || input == '"') {
-                        split = input;
-                        quota = true;
-                        state = PARSE_ATTR_VALUE_END;
+                case PARSE_ATTR_VALUE_BEGIN: {
+                    unsigned c = Class(*p);
+                    if (c & (ATTR_CHAR_SPACE | ATTR_CHAR_BREAK)) {
+                        if (!key_.empty()) Add(attribute);
+                        state_ = PARSE_ATTR_KEY;
+                        p++;
+                    } else if (c & ATTR_CHAR_QUOTE) {
+                        quote_ = *p++;
+                        state_ = PARSE_ATTR_VALUE_END;
                     } else {
-                        v.append(attr.c_str() + index, 1);
-                        quota = false;
-                        state = PARSE_ATTR_VALUE_END;
+                        // this byte is the first of the value
+                        quote_ = 0;
+                        state_ = PARSE_ATTR_VALUE_END;
                     }
                 }
                 break;
 
                 case PARSE_ATTR_VALUE_END: {
-                    if((quota && input == split) || (!quota && (input == '\t' || input == '\r' || input == '\n' || input == ' '))) {
-                        attribute[k] = v;
-                        k.clear();
-                        v.clear();
-                        state = PARSE_ATTR_KEY;
+                    const char *begin = p;
+                    if (quote_) {
+                        p = (const char *) memchr(p, quote_, end - p);
+                        if (!p) p = end;
                     } else {
-                        v.append(attr.c_str() + index, 1);
+                        while (p < end && !(Class(*p) & (ATTR_CHAR_SPACE | ATTR_CHAR_BREAK))) p++;
                     }
+
+                    Append(val_, begin, p, limits_->max_attribute_length, HTML_LIMIT_ATTRIBUTE_LENGTH);
+                    if (p == end) break;
+
+                    Add(attribute);
+                    state_ = PARSE_ATTR_KEY;
+                    p++;
                 }
                 break;
             }
-
-            index++;
         }
+    }
 
-        if(!k.empty()){
-            attribute[k] = v;
-        }
+    /**
+     * the text ended, adds the attribute still being read.
+     */
+    void End(std::map<std::string, std::string> &attribute) {
+        if (!key_.empty()) Add(attribute);
+        key_.clear();
+        val_.clear();
+        state_ = PARSE_ATTR_KEY;
+    }
 
-        //trim
-        if (!value.empty()) {
-            value.erase(0, value.find_first_not_of(" "));
-            value.erase(value.find_last_not_of(" ") + 1);
-        }
+    /**
+     * @return the HtmlLimit bits hit so far
+     */
+    unsigned GetExceeded() const {
+        return exceeded_;
     }
 
-    static std::set<std::string> SplitClassName(const std::string& name){
-#if defined(WIN32)
-#define strtok_ strtok_s
-#else
-#define strtok_ strtok_r
-#endif
-        std::set<std::string> class_names;
-        char *temp = NULL;
-        char *p = strtok_((char *)name.c_str(), " ", &temp);
-        while (p) {
-            class_names.insert(p);
-            p = strtok_(NULL, " ", &temp);
+    /**
+     * @return true while a quoted value is still open
+     */
+    bool Quoted() const {
+        return state_ == PARSE_ATTR_VALUE_END && quote_;
+    }
+
+private:
+    enum ParseAttrState {
+        PARSE_ATTR_KEY,
+        PARSE_ATTR_VALUE_BEGIN,
+        PARSE_ATTR_VALUE_END
+    };
+
+    enum AttrChar {
+        ATTR_CHAR_SPACE = 1,    // ' ', ends a name
+        ATTR_CHAR_BREAK = 2,    // '\t' '\r' '\n', skipped in a name
+        ATTR_CHAR_QUOTE = 4,
+        ATTR_CHAR_EQUAL = 8
+    };
+
+    static unsigned Class(char c) {
+        // AttrChar bits, every byte past '=' is plain
+        static constexpr unsigned char table[256] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            1, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+        };
+
+        return table[(unsigned char) c];
+    }
+
+    /**
+     * moves the name and value read into attribute, a later attribute of
+     * the same name replaces the earlier one.
+     */
+    void Add(std::map<std::string, std::string> &attribute) {
+        std::map<std::string, std::string>::iterator it = attribute.find(key_);
+        if (it == attribute.end()) {
+            if (attribute.size() >= limits_->max_attributes) {
+                exceeded_ |= HTML_LIMIT_ATTRIBUTES;
+                key_.clear();
+                val_.clear();
+                return;
+            }
+
+            it = attribute.insert(std::make_pair(std::move(key_), std::string())).first;
         }
 
-        return class_names;
+        it->second.swap(val_);
+        key_.clear();
+        val_.clear();
     }
 
-    static void InsertIfNotExists(std::vector<std::shared_ptr<HtmlElement>>& vec, const std::shared_ptr<HtmlElement>& ele){
-        for(size_t i = 0; i < vec.size(); i++){
-            if(vec[i] == ele) return;
+    /**
+     * appends [begin, end) to str, up to max bytes in total.
+     */
+    void Append(std::string &str, const char *begin, const char *end, size_t max, unsigned limit) {
+        size_t room = max - std::min(str.size(), max);
+        if ((size_t) (end - begin) > room) {
+            exceeded_ |= limit;
+            end = begin + room;
         }
 
-        vec.push_back(ele);
+        str.append(begin, end - begin);
     }
 
 private:
-    std::string name;
-    std::string value;
-    std::map<std::string, std::string> attribute;
-    weak_ptr<HtmlElement> parent;
-    std::vector<shared_ptr<HtmlElement> > children;
+    const HtmlParseLimits *limits_;
+    ParseAttrState state_;
+    char quote_;
+    std::string key_;
+    std::string val_;
+    unsigned exceeded_;
 };
 
+class HtmlParser;
+
 /**
- * class HtmlDocument
- * Html Doc struct
+ * struct HtmlSourceView
+ * bytes of the parsed input, not copied
  */
-class HtmlDocument {
-public:
-    HtmlDocument(shared_ptr<HtmlElement> &root)
-            : root_(root) {}
+struct HtmlSourceView {
+    HtmlSourceView(const char *d = NULL, size_t s = 0)
+            : data(d), size(s) {}
 
-    shared_ptr<HtmlElement> GetElementById(const std::string &id) {
-        return root_->GetElementById(id);
+    std::string str() const {
+        return data ? std::string(data, size) : std::string();
     }
 
-    std::vector<shared_ptr<HtmlElement> > GetElementByClassName(const std::string &name) {
-        return root_->GetElementByClassName(name);
-    }
+    const char *data;
+    size_t size;
+};
 
-    std::vector<shared_ptr<HtmlElement> > GetElementByTagName(const std::string &name) {
-        return root_->GetElementByTagName(name);
-    }
+/**
+ * struct HtmlSourceSpan
+ * where an element was found in the input, see HtmlParser::SetSourceSpans.
+ * offsets count bytes from the start of the input, line and column from 1.
+ * an element without content has an empty inner span at the end of its
+ * start tag, one closed by the end of an ancestor or of the input ends there.
+ */
+struct HtmlSourceSpan {
+    const char *input;      // the parsed input, NULL after Feed
+    size_t outer_begin;     // the '<' of the start tag
+    size_t inner_begin;     // after the start tag
+    size_t inner_end;       // the '<' of the close tag
+    size_t outer_end;       // after the close tag
+    size_t line;            // of outer_begin
+    size_t column;          // of outer_begin, in bytes
+};
 
-    std::vector<shared_ptr<HtmlElement> > SelectElement(const std::string& rule){
-        std::vector<shared_ptr<HtmlElement> > result;
-        HtmlElement::ChildIterator it = root_->ChildBegin();
-        for(; it != root_->ChildEnd(); it++){
-            (*it)->SelectElement(rule, result);
+/**
+ * struct HtmlHash
+ * 64 bit hash of the bytes and numbers added to it, eight bytes a step.
+ * words are read in host byte order.
+ */
+struct HtmlHash {
+    HtmlHash()
+            : h(0x9E3779B97F4A7C15ULL) {}
+
+    void Add(const char *data, size_t len) {
+        const char *end = data + len;
+        uint64_t word;
+        for (; end - data >= 8; data += 8) {
+            memcpy(&word, data, 8);
+            Add(word);
         }
 
+        word = 0;
+        memcpy(&word, data, end - data);
+        Add(word);
+        Add((uint64_t) len);
+    }
+
+    void Add(const std::string &str) {
+        Add(str.data(), str.size());
+    }
+
+    void Add(uint64_t v) {
+        h ^= v * 0xFF51AFD7ED558CCDULL;
+        h = (h << 27 | h >> 37) * 0xC4CEB9FE1A85EC53ULL + 0x52DCE729;
+    }
+
+    /**
+     * @return never 0, which stands for no hash
+     */
+    uint64_t Value() const {
+        uint64_t x = h;
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDULL;
+        x ^= x >> 33;
+        return x ? x : 1;
+    }
+
+    uint64_t h;
+};
+
+/**
+ * struct HtmlFingerprint
+ * near-duplicate signature of the visible text of a document, see
+ * HtmlParser::SetFingerprint.
+ */
+struct HtmlFingerprint {
+    HtmlFingerprint()
+            : simhash(0), tokens(0) {}
+
+    /**
+     * @return bits in which the simhashes differ, a few for near duplicates
+     */
+    int Distance(const HtmlFingerprint &other) const {
+        uint64_t x = simhash ^ other.simhash;
+        int bits = 0;
+        for (; x; x &= x - 1) bits++;
+        return bits;
+    }
+
+    /**
+     * @return estimated jaccard similarity of the shingle sets, 0 to 1
+     */
+    double Similarity(const HtmlFingerprint &other) const {
+        size_t n = std::min(minhash.size(), other.minhash.size());
+        if (n == 0) return 0;
+
+        size_t same = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (minhash[i] == other.minhash[i]) same++;
+        }
+
+        return (double) same / n;
+    }
+
+    uint64_t simhash;               // over the tokens
+    std::vector<uint64_t> minhash;  // over the shingles of consecutive tokens
+    size_t tokens;
+};
+
+/**
+ * class HtmlFingerprinter
+ * splits text given piece by piece into tokens and sums them up into an
+ * HtmlFingerprint. a token is a run of ascii letters and digits (lowercased)
+ * and other non-ascii characters, each cjk character is a token by itself.
+ * the text is taken as written: a character reference separates tokens.
+ * '\r', '\n' and '\t' are passed over like the parser does in text.
+ */
+class HtmlFingerprinter {
+public:
+    /**
+     * allocates nothing, an Add without a Reset before it resets to 64
+     * minhash values and shingles of 3 tokens.
+     */
+    HtmlFingerprinter()
+            : cjk_(0), reference_(false), tokens_(0) {
+        memset(bits_, 0, sizeof(bits_));
+    }
+
+    /**
+     * @param minhash number of minhash values
+     * @param shingle tokens in a shingle
+     */
+    void Reset(size_t minhash, size_t shingle) {
+        token_.clear();
+        cjk_ = 0;
+        reference_ = false;
+        tokens_ = 0;
+        memset(bits_, 0, sizeof(bits_));
+        window_.assign(shingle ? shingle : 1, 0);
+        minhash_.assign(minhash, uint64_t(-1));
+    }
+
+    void Add(const char *data, size_t len) {
+        if (window_.empty()) Reset(64, 3);
+
+        for (const char *end = data + len; data < end; data++) {
+            unsigned char c = (unsigned char) *data;
+            if (reference_) {
+                if (c == '#' || (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z')) continue;
+                reference_ = false;
+            }
+
+            if (cjk_) {
+                token_.push_back(c);
+                if (--cjk_ == 0) Token();
+            } else if (c >= 0xE3 && c <= 0xE9) {
+                // U+3000 to U+9FFF, three bytes
+                Token();
+                token_.push_back(c);
+                cjk_ = 2;
+            } else if (c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')) {
+                token_.push_back(c);
+            } else if (c >= 'A' && c <= 'Z') {
+                token_.push_back(c + ('a' - 'A'));
+            } else if (c == '&') {
+                Token();
+                reference_ = true;
+            } else if (c != '\r' && c != '\n' && c != '\t') {
+                Token();
+            }
+        }
+    }
+
+    /**
+     * the text that follows does not continue the current token.
+     */
+    void Break() {
+        cjk_ = 0;
+        reference_ = false;
+        Token();
+    }
+
+    void Finish(HtmlFingerprint &fp) {
+        Break();
+        // a text shorter than a shingle is one shingle
+        if (tokens_ > 0 && tokens_ < window_.size()) Shingle(tokens_);
+
+        fp.simhash = 0;
+        for (int b = 0; b < 64; b++) {
+            if (bits_[b] > 0) fp.simhash |= uint64_t(1) << b;
+        }
+        fp.minhash = minhash_;
+        fp.tokens = tokens_;
+    }
+
+private:
+    void Token() {
+        if (token_.empty()) return;
+
+        HtmlHash hash;
+        hash.Add(token_);
+        uint64_t h = hash.Value();
+        token_.clear();
+
+        for (int b = 0; b < 64; b++) {
+            bits_[b] += (h >> b & 1) ? 1 : -1;
+        }
+
+        window_[tokens_ % window_.size()] = h;
+        if (++tokens_ >= window_.size()) Shingle(window_.size());
+    }
+
+    /**
+     * the shingle of the last n tokens
+     */
+    void Shingle(size_t n) {
+        HtmlHash hash;
+        for (size_t i = tokens_ - n; i < tokens_; i++) hash.Add(window_[i % window_.size()]);
+        uint64_t h = hash.Value();
+
+        // one hash function per value, mixed from the shingle hash
+        for (size_t i = 0; i < minhash_.size(); i++) {
+            uint64_t x = h + (i + 1) * 0x9E3779B97F4A7C15ULL;
+            x ^= x >> 31;
+            x *= 0xBF58476D1CE4E5B9ULL;
+            x ^= x >> 29;
+            if (x < minhash_[i]) minhash_[i] = x;
+        }
+    }
+
+    std::string token_;
+    unsigned cjk_;                  // bytes left of a cjk character
+    bool reference_;                // in a character reference
+    size_t tokens_;
+    int bits_[64];                  // simhash votes
+    std::vector<uint64_t> window_;  // hashes of the last tokens
+    std::vector<uint64_t> minhash_;
+};
+
+/**
+ * struct HtmlLazySource
+ * input of a lazy parse, shared by the elements whose children are not built yet
+ */
+struct HtmlLazySource {
+    std::string data;
+    shared_ptr<HtmlParser> parser;  // options of the parse, builds the children
+    std::mutex mutex;               // the parser builds one subtree at a time
+};
+
+class HtmlElement;
+
+/**
+ * what HtmlElement::Walk does after a visitor has seen an element
+ */
+enum HtmlWalk {
+    HTML_WALK_CONTINUE,     // into its children
+    HTML_WALK_SKIP,         // past its children
+    HTML_WALK_STOP          // ends the walk
+};
+
+/**
+ * struct HtmlVisitor
+ * base of the visitors of HtmlElement::Walk. Walk is a template on the
+ * visitor and calls Enter and Leave directly, so they are inlined. Enter
+ * is called before the children of an element and Leave after them, also
+ * when they were skipped.
+ */
+struct HtmlVisitor {
+    HtmlWalk Enter(const shared_ptr<HtmlElement> &) {
+        return HTML_WALK_CONTINUE;
+    }
+
+    void Leave(const shared_ptr<HtmlElement> &) {}
+};
+
+/**
+ * class HtmlElement
+ * HTML Element struct
+ */
+class HtmlElement : public enable_shared_from_this<HtmlElement> {
+public:
+    friend class HtmlParser;
+
+    friend class HtmlDocument;
+
+    friend class HtmlParallelQuery;
+
+    friend class HtmlSnapshot;
+
+    friend class HtmlSelectorSet;
+
+    friend class HtmlTreeDiff;
+
+    friend class HtmlJsonWriter;
+
+public:
+    /**
+     * for children traversals.
+     */
+    typedef std::vector<shared_ptr<HtmlElement> >::const_iterator ChildIterator;
+
+    const ChildIterator ChildBegin() {
+        Expand();
+        return children.begin();
+    }
+
+    const ChildIterator ChildEnd() {
+        Expand();
+        return children.end();
+    }
+
+    /**
+     * for attribute traversals.
+     */
+    typedef std::map<std::string, std::string>::const_iterator AttributeIterator;
+
+    const AttributeIterator AttributeBegin() {
+        return Attributes().begin();
+    }
+
+    const AttributeIterator AttributeEnd() {
+        return Attributes().end();
+    }
+
+public:
+    HtmlElement()
+            : flags(0), attribute_pending(LAZY_BUILT), source_offset(0), children_pending(LAZY_BUILT), entities(ENTITIES_KEPT),
+              hash(0) {}
+
+    HtmlElement(shared_ptr<HtmlElement> p)
+            : flags(0), attribute_pending(LAZY_BUILT), parent(p), source_offset(0), children_pending(LAZY_BUILT),
+              entities(ENTITIES_KEPT), hash(0) {}
+
+    ~HtmlElement() {
+        // a deep subtree is released a level at a time, not by recursion
+        std::vector<shared_ptr<HtmlElement> > release;
+        release.swap(children);
+        while (!release.empty()) {
+            shared_ptr<HtmlElement> e;
+            e.swap(release.back());
+            release.pop_back();
+            if (e.use_count() == 1) {
+                for (size_t i = 0; i < e->children.size(); i++) release.push_back(std::move(e->children[i]));
+                e->children.clear();
+            }
+        }
+    }
+
+    /**
+     * an element being walked and where the walk goes on in its parent
+     * once it is left
+     */
+    struct Level {
+        Level(const shared_ptr<HtmlElement> *e, const shared_ptr<HtmlElement> *n, const shared_ptr<HtmlElement> *x)
+                : self(e), next(n), end(x) {}
+
+        const shared_ptr<HtmlElement> *self;
+        const shared_ptr<HtmlElement> *next;
+        const shared_ptr<HtmlElement> *end;
+    };
+
+    /**
+     * walks the subtree in document order without recursion, so deep trees
+     * do not run out of stack. see HtmlVisitor.
+     * @param self visit this element too, not only the ones below it
+     * @param expand build lazy children on the way, see HtmlParser::SetLazySubtrees
+     * @return false when the visitor stopped the walk
+     */
+    template<typename Visitor>
+    bool Walk(Visitor &visitor, bool self = false, bool expand = true) {
+        shared_ptr<HtmlElement> me = shared_from_this();
+        if (self) {
+            HtmlWalk next = visitor.Enter(me);
+            if (next == HTML_WALK_STOP) return false;
+            if (next == HTML_WALK_SKIP) {
+                visitor.Leave(me);
+                return true;
+            }
+        }
+
+        // the children of the innermost element stay in registers, the
+        // elements entered around it are stacked
+        if (expand) Expand();
+        const shared_ptr<HtmlElement> *next = children.data();
+        const shared_ptr<HtmlElement> *end = next + children.size();
+        std::vector<Level> stack;
+        for (;;) {
+            if (next == end) {
+                if (stack.empty()) break;
+
+                const Level &top = stack.back();
+                next = top.next;
+                end = top.end;
+                visitor.Leave(*top.self);
+                stack.pop_back();
+                continue;
+            }
+
+            const shared_ptr<HtmlElement> &child = *next++;
+            HtmlWalk step = visitor.Enter(child);
+            if (step == HTML_WALK_STOP) return false;
+            if (step == HTML_WALK_CONTINUE) {
+                if (expand) child->Expand();
+                if (!child->children.empty()) {
+                    stack.push_back(Level(&child, next, end));
+                    next = child->children.data();
+                    end = next + child->children.size();
+                    continue;
+                }
+            }
+
+            // skipped, or a leaf like most elements
+            visitor.Leave(child);
+        }
+
+        if (self) visitor.Leave(me);
+        return true;
+    }
+
+    std::string GetAttribute(const std::string &k) {
+        const std::map<std::string, std::string> &attribute = Attributes();
+        std::map<std::string, std::string>::const_iterator it = attribute.find(k);
+        if (it != attribute.end()) {
+            return it->second;
+        }
+
+        return "";
+    }
+
+    shared_ptr<HtmlElement> GetElementById(const std::string &id) {
+        IdFinder finder(id);
+        Walk(finder);
+        return finder.found;
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByClassName(const std::string &name) {
+        std::vector<shared_ptr<HtmlElement> > result;
+        GetElementByClassName(name, result);
+        return result;
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByTagName(const std::string &name) {
+        std::vector<shared_ptr<HtmlElement> > result;
+        GetElementByTagName(name, result);
+        return result;
+    }
+
+    /**
+     * select by a path rule. every element is evaluated at most once per
+     * step of the rule, so "//" steps stay linear in the size of the tree.
+     */
+    void SelectElement(const std::string& rule, std::vector<shared_ptr<HtmlElement> >& result){
+        SelectState state;
+        for(size_t i = 0; i < result.size(); i++){
+            state.found.insert(result[i].get());
+        }
+
+        SelectElement(rule, result, state);
+    }
+
+    shared_ptr<HtmlElement> GetParent() {
+        return parent.lock();
+    }
+
+    const std::string &GetValue() {
+        Expand();
+        if(Value().empty() && children.size() == 1 && children[0]->GetName() == "plain"){
+            return children[0]->GetValue();
+        }
+
+        return value;
+    }
+
+    const std::string &GetName() {
+        return name;
+    }
+
+    /**
+     * @return hash of the element and everything below it, 0 when the
+     * parser did not compute subtree hashes
+     */
+    uint64_t GetHash() const {
+        return hash;
+    }
+
+    /**
+     * @return where the element was found, NULL when the parser did not
+     * record source spans and for the text children
+     */
+    const HtmlSourceSpan *GetSourceSpan() const {
+        return span.get();
+    }
+
+    /**
+     * the element as written in the input, from its start tag to the end
+     * of its close tag. it points into the input, which must still be
+     * alive, and is empty without source spans or after Feed.
+     */
+    HtmlSourceView OuterSource() const {
+        if (!span || !span->input) return HtmlSourceView();
+        return HtmlSourceView(span->input + span->outer_begin, span->outer_end - span->outer_begin);
+    }
+
+    /**
+     * the content of the element as written in the input, see OuterSource.
+     */
+    HtmlSourceView InnerSource() const {
+        if (!span || !span->input) return HtmlSourceView();
+        return HtmlSourceView(span->input + span->inner_begin, span->inner_end - span->inner_begin);
+    }
+
+    std::string text(){
+        std::string str;
+        PlainStylize(str);
+        return str;
+    }
+
+    void PlainStylize(std::string& str){
+        TextWriter writer(str);
+        Walk(writer, true);
+    }
+
+    std::string html(){
+        std::string str;
+        HtmlStylize(str);
+        return str;
+    }
+
+    void HtmlStylize(std::string& str) {
+        HtmlWriter writer(str);
+        Walk(writer, true);
+    }
+
+    /**
+     * adds the memory held by this element and its subtree to usage.
+     */
+    void MemoryUsage(HtmlMemoryUsage &usage) {
+        MemoryCounter counter(usage);
+        Walk(counter, true, false);
+    }
+
+    /**
+     * releases the spare capacity of strings and children vectors in the subtree.
+     */
+    void Compact() {
+        Compactor compactor;
+        Walk(compactor, true, false);
+    }
+
+private:
+    /**
+     * the visitors of the traversals above
+     */
+    struct IdFinder : HtmlVisitor {
+        explicit IdFinder(const std::string &i)
+                : id(i) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            // an element without attributes has the empty id
+            bool none = e->attribute_pending.load(std::memory_order_acquire) == LAZY_BUILT && e->attribute.empty();
+            const std::map<std::string, std::string> *attribute = none ? NULL : &e->Attributes();
+            std::map<std::string, std::string>::const_iterator it;
+            bool match = (none || (it = attribute->find("id")) == attribute->end()) ? id.empty() : it->second == id;
+            if (!match) return HTML_WALK_CONTINUE;
+
+            found = e;
+            return HTML_WALK_STOP;
+        }
+
+        const std::string &id;
+        shared_ptr<HtmlElement> found;
+    };
+
+    struct NameCollector : HtmlVisitor {
+        NameCollector(const std::string &n, std::vector<shared_ptr<HtmlElement> > &r)
+                : name(n), result(r) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            if (e->name == name) result.push_back(e);
+            return HTML_WALK_CONTINUE;
+        }
+
+        const std::string &name;
+        std::vector<shared_ptr<HtmlElement> > &result;
+    };
+
+    struct ClassCollector : HtmlVisitor {
+        ClassCollector(const std::set<std::string> &c, std::vector<shared_ptr<HtmlElement> > &r)
+                : class_name(c), result(r) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            bool none = e->attribute_pending.load(std::memory_order_acquire) == LAZY_BUILT && e->attribute.empty();
+            if ((!none || class_name.empty()) && e->MatchClassName(class_name)) result.push_back(e);
+            return HTML_WALK_CONTINUE;
+        }
+
+        const std::set<std::string> &class_name;
+        std::vector<shared_ptr<HtmlElement> > &result;
+    };
+
+    /**
+     * text(): a tab before a table cell and a new line before a block
+     * that follows a sibling, invisible elements left out.
+     */
+    struct TextWriter : HtmlVisitor {
+        explicit TextWriter(std::string &s)
+                : str(s), first(true) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            if (!first) {
+                if (e->flags & HTML_TAG_TABLE_CELL) {
+                    str.push_back('\t');
+                } else if (e->flags & HTML_TAG_BLOCK) {
+                    str.push_back('\n');
+                }
+            }
+
+            first = true;
+            if (e->flags & HTML_TAG_INVISIBLE) return HTML_WALK_SKIP;
+            if (e->name == "plain") {
+                str.append(e->Value());
+                return HTML_WALK_SKIP;
+            }
+
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &) {
+            first = false;
+        }
+
+        std::string &str;
+        bool first;     // no sibling before the next element entered
+    };
+
+    struct HtmlWriter : HtmlVisitor {
+        explicit HtmlWriter(std::string &s)
+                : str(s) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            if (e->name.empty()) return HTML_WALK_CONTINUE;
+            if (e->name == "plain") {
+                e->AppendText(str, e->Value());
+                return HTML_WALK_SKIP;
+            }
+
+            str.push_back('<');
+            str.append(e->name);
+            const std::map<std::string, std::string> &attribute = e->Attributes();
+            bool escape = e->entities.load(std::memory_order_relaxed) == ENTITIES_DECODED;
+            std::map<std::string, std::string>::const_iterator it = attribute.begin();
+            for (; it != attribute.end(); it++) {
+                str.push_back(' ');
+                str.append(it->first);
+                str.append("=\"");
+                if (escape) {
+                    HtmlEntity::Escape(it->second.data(), it->second.size(), true, str);
+                } else {
+                    str.append(it->second);
+                }
+                str.push_back('"');
+            }
+            str.push_back('>');
+
+            e->Expand();
+            if (e->children.empty()) e->AppendText(str, e->Value());
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &e) {
+            if (e->name.empty() || e->name == "plain") return;
+
+            str.append("</");
+            str.append(e->name);
+            str.push_back('>');
+        }
+
+        std::string &str;
+    };
+
+    struct MemoryCounter : HtmlVisitor {
+        explicit MemoryCounter(HtmlMemoryUsage &u)
+                : usage(u) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            // the control block of shared_ptr(new T): vtable plus two counters
+            usage.nodes += sizeof(HtmlElement) + sizeof(void *) + 2 * sizeof(long);
+            usage.names += StringHeap(e->name);
+            usage.text += StringHeap(e->value);
+            usage.containers += e->children.capacity() * sizeof(shared_ptr<HtmlElement>);
+            usage.attributes += StringHeap(e->attribute_text);
+            if (e->span) usage.nodes += sizeof(HtmlSourceSpan);
+            // shared by the unbuilt elements of a document, counted once
+            if (e->source && sources.insert(e->source.get()).second) usage.source += SourceHeap(*e->source);
+
+            std::map<std::string, std::string>::const_iterator it = e->attribute.begin();
+            for (; it != e->attribute.end(); ++it) {
+                // red-black tree node: color and three links
+                usage.containers += 4 * sizeof(void *);
+                usage.attributes += sizeof(*it) + StringHeap(it->first) + StringHeap(it->second);
+            }
+
+            return HTML_WALK_CONTINUE;
+        }
+
+        HtmlMemoryUsage &usage;
+        std::unordered_set<const HtmlLazySource *> sources;
+    };
+
+    struct Compactor : HtmlVisitor {
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            e->name.shrink_to_fit();
+            e->value.shrink_to_fit();
+            e->children.shrink_to_fit();
+            e->attribute_text.shrink_to_fit();
+
+            std::map<std::string, std::string>::iterator it = e->attribute.begin();
+            for (; it != e->attribute.end(); ++it) {
+                it->second.shrink_to_fit();
+            }
+
+            return HTML_WALK_CONTINUE;
+        }
+    };
+
+    void GetElementByClassName(const std::string &name, std::vector<shared_ptr<HtmlElement> > &result) {
+        GetElementByClassName(SplitClassName(name), result);
+    }
+
+    void GetElementByClassName(const std::set<std::string> &class_name, std::vector<shared_ptr<HtmlElement> > &result) {
+        ClassCollector collector(class_name, result);
+        Walk(collector);
+    }
+
+    bool MatchClassName(const std::set<std::string> &class_name) {
+        std::set<std::string> attr_class = SplitClassName(GetAttribute("class"));
+        std::set<std::string>::const_iterator iter = class_name.begin();
+        for(; iter != class_name.end(); ++iter){
+            if(attr_class.find(*iter) == attr_class.end()){
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void GetElementByTagName(const std::string &name, std::vector<shared_ptr<HtmlElement> > &result) {
+        NameCollector collector(name, result);
+        Walk(collector);
+    }
+
+    /**
+     * (element, length of the remaining rule) pairs already evaluated and
+     * the elements already in the result.
+     */
+    struct SelectState {
+        struct KeyHash {
+            size_t operator()(const std::pair<const HtmlElement *, size_t> &key) const {
+                return std::hash<const void *>()(key.first) ^ (key.second * 31);
+            }
+        };
+
+        std::unordered_set<std::pair<const HtmlElement *, size_t>, KeyHash> visited;
+        std::unordered_set<const HtmlElement *> found;
+    };
+
+    /**
+     * evaluates next on every element of a subtree, one already walked for
+     * the same "//" rule is not walked again.
+     */
+    struct DescendantSelector : HtmlVisitor {
+        DescendantSelector(const std::string &n, size_t s, std::vector<shared_ptr<HtmlElement> > &r,
+                           SelectState &st)
+                : next(n), size(s), result(r), state(st) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            e->SelectElement(next, result, state);
+            return state.visited.insert(std::make_pair(e.get(), size)).second ? HTML_WALK_CONTINUE : HTML_WALK_SKIP;
+        }
+
+        const std::string &next;
+        size_t size;    // of the "//" rule next was taken from
+        std::vector<shared_ptr<HtmlElement> > &result;
+        SelectState &state;
+    };
+
+    void SelectElement(const std::string& rule, std::vector<shared_ptr<HtmlElement> >& result, SelectState& state){
+        if(rule.empty() || rule.at(0) != '/' || name == "plain") return;
+
+        // a second evaluation can only find what the first one added
+        if(!state.visited.insert(std::make_pair(this, rule.size())).second) return;
+
+        if(rule.size() >= 2 && rule.at(1) == '/') {
+            std::string next = rule.substr(1);
+            DescendantSelector selector(next, rule.size(), result, state);
+            Walk(selector);
+        } else {
+            std::string::size_type p = rule.find('/', 1);
+            std::string::size_type pos = (p == std::string::npos) ? rule.size() : p;
+
+            HtmlSelectStep step(rule, pos);
+            const std::map<std::string, std::string> &attribute = Attributes();
+            std::map<std::string, std::string>::const_iterator found = attribute.find(step.attr);
+            bool matched = (found == attribute.end()) ? step.Match(name.data(), name.size(), NULL, 0, false)
+                                                      : step.Match(name.data(), name.size(), found->second.data(),
+                                                                   found->second.size(), true);
+
+            std::string next = rule.substr(pos);
+            if(matched) {
+                if(next.empty()) {
+                    if(state.found.insert(this).second) result.push_back(shared_from_this());
+                } else {
+                    for(ChildIterator it = ChildBegin(); it != ChildEnd(); it++){
+                        (*it)->SelectElement(next, result, state);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * the attributes, parsed from attribute_text on the first call. the
+     * parse happens once, racing readers of the same element wait for it.
+     */
+    std::map<std::string, std::string> &Attributes() {
+        ParseAttributes();
+        DecodeEntities();
+        return attribute;
+    }
+
+    void ParseAttributes() {
+        if (attribute_pending.load(std::memory_order_acquire) == LAZY_BUILT) return;
+
+        Once(attribute_pending, LAZY_PENDING, LAZY_BUILDING, LAZY_BUILT, [this]() {
+            HtmlParseLimits limits;
+            HtmlAttributeReader reader(limits);
+            reader.Read(attribute_text.data(), attribute_text.size(), attribute);
+            reader.End(attribute);
+            std::string().swap(attribute_text);
+        });
+    }
+
+    /**
+     * a once flag of the element without a mutex: the thread that moves
+     * state from pending to busy runs build, racing readers wait until it
+     * is done. other elements, also of the same document, are not held up.
+     */
+    template<typename Build>
+    static void Once(std::atomic<unsigned char> &state, unsigned char pending, unsigned char busy,
+                     unsigned char done, Build build) {
+        unsigned char expected = pending;
+        if (state.compare_exchange_strong(expected, busy, std::memory_order_acquire)) {
+            build();
+            state.store(done, std::memory_order_release);
+            return;
+        }
+
+        while (state.load(std::memory_order_acquire) == busy) std::this_thread::yield();
+    }
+
+    /**
+     * the value, its character references decoded on the first call, see
+     * HtmlParser::SetEntityDecoding.
+     */
+    const std::string &Value() {
+        DecodeEntities();
+        return value;
+    }
+
+    /**
+     * decodes value and attributes once, see Once. a reader that finds
+     * the decode running waits for it, Decode rewrites them in place.
+     */
+    void DecodeEntities() {
+        unsigned char state = entities.load(std::memory_order_acquire);
+        if (state != ENTITIES_PENDING && state != ENTITIES_DECODING) return;
+
+        Once(entities, ENTITIES_PENDING, ENTITIES_DECODING, ENTITIES_DECODED, [this]() {
+            ParseAttributes();
+            Decode();
+        });
+    }
+
+    /**
+     * decodes in place, the content of raw text elements is kept as it is.
+     */
+    void Decode() {
+        std::map<std::string, std::string>::iterator it = attribute.begin();
+        for (; it != attribute.end(); ++it) {
+            HtmlEntity::Decode(it->second, true);
+        }
+
+        if (!(flags & HTML_TAG_RAW_TEXT)) HtmlEntity::Decode(value, false);
+    }
+
+    /**
+     * appends text for html(), escaped again when it was decoded.
+     */
+    void AppendText(std::string &str, const std::string &text) {
+        if (entities.load(std::memory_order_relaxed) == ENTITIES_DECODED && !(flags & HTML_TAG_RAW_TEXT)) {
+            HtmlEntity::Escape(text.data(), text.size(), false, str);
+        } else {
+            str.append(text);
+        }
+    }
+
+    /**
+     * builds the children kept unexpanded by a lazy parse, see
+     * HtmlParser::SetLazySubtrees. the children are built once, see Once.
+     */
+    void Expand() {
+        if (children_pending.load(std::memory_order_acquire)) ExpandChildren();
+    }
+
+    void ExpandChildren();
+
+    static std::set<std::string> SplitClassName(const std::string& name){
+        std::set<std::string> class_names;
+        std::string::size_type begin = name.find_first_not_of(' ');
+        while (begin != std::string::npos) {
+            std::string::size_type end = name.find(' ', begin);
+            class_names.insert(name.substr(begin, end - begin));
+            begin = name.find_first_not_of(' ', end);
+        }
+
+        return class_names;
+    }
+
+    /**
+     * heap bytes of a string, zero when it lives in the small string buffer.
+     */
+    static size_t StringHeap(const std::string &str) {
+        const char *p = str.data();
+        const char *self = (const char *) &str;
+        return (p >= self && p < self + sizeof(str)) ? 0 : str.capacity() + 1;
+    }
+
+    /**
+     * heap bytes of a lazy source: the input copy and the parser.
+     */
+    static size_t SourceHeap(const HtmlLazySource &source);
+
+private:
+    std::string name;
+    std::string value;
+    unsigned flags;
+    std::map<std::string, std::string> attribute;
+    std::string attribute_text;             // not parsed yet, see HtmlParser::SetLazyAttributes
+    std::atomic<unsigned char> attribute_pending;   // LAZY_*, not LAZY_BUILT while attribute_text is unparsed
+    weak_ptr<HtmlElement> parent;
+    std::vector<shared_ptr<HtmlElement> > children;
+    shared_ptr<HtmlLazySource> source;      // content of the children not built yet
+    size_t source_offset;
+    std::atomic<unsigned char> children_pending;    // LAZY_*
+    std::unique_ptr<HtmlSourceSpan> span;   // see HtmlParser::SetSourceSpans
+    std::atomic<unsigned char> entities;    // ENTITIES_*, see HtmlParser::SetEntityDecoding
+    uint64_t hash;                          // see HtmlParser::SetSubtreeHashes
+
+    enum {
+        ENTITIES_KEPT,          // value and attributes as written
+        ENTITIES_PENDING,       // decoded on first access
+        ENTITIES_DECODING,
+        ENTITIES_DECODED
+    };
+
+    enum {
+        LAZY_BUILT,
+        LAZY_PENDING,           // built on first access
+        LAZY_BUILDING
+    };
+};
+
+/**
+ * class HtmlDocument
+ * Html Doc struct
+ */
+class HtmlDocument {
+public:
+    friend class HtmlParser;
+
+    HtmlDocument(shared_ptr<HtmlElement> &root)
+            : root_(root) {}
+
+    shared_ptr<HtmlElement> GetElementById(const std::string &id) const {
+        return root_->GetElementById(id);
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByClassName(const std::string &name) const {
+        return root_->GetElementByClassName(name);
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByTagName(const std::string &name) const {
+        return root_->GetElementByTagName(name);
+    }
+
+    std::vector<shared_ptr<HtmlElement> > SelectElement(const std::string& rule) const {
+        std::vector<shared_ptr<HtmlElement> > result;
+        HtmlElement::SelectState state;
+        HtmlElement::ChildIterator it = root_->ChildBegin();
+        for(; it != root_->ChildEnd(); it++){
+            (*it)->SelectElement(rule, result, state);
+        }
+
+        return result;
+    }
+
+    std::string html() const {
+        return root_->html();
+    }
+
+    std::string text() const {
+        return root_->text();
+    }
+
+    HtmlMemoryUsage MemoryUsage() const {
+        HtmlMemoryUsage usage;
+        usage.nodes += sizeof(HtmlDocument);
+        root_->MemoryUsage(usage);
+        return usage;
+    }
+
+    void Compact() {
+        root_->Compact();
+    }
+
+    /**
+     * unnamed container element holding the top-level elements.
+     */
+    shared_ptr<HtmlElement> GetRoot() const {
+        return root_;
+    }
+
+    /**
+     * empty unless parsed with HtmlParser::SetFingerprint.
+     */
+    const HtmlFingerprint &GetFingerprint() const {
+        return fingerprint_;
+    }
+
+private:
+    shared_ptr<HtmlElement> root_;
+    HtmlFingerprint fingerprint_;
+};
+
+/**
+ * what HtmlParser::SetEntityDecoding does with character references
+ */
+enum HtmlEntityMode {
+    HTML_ENTITIES_KEEP,     // values and attributes as written
+    HTML_ENTITIES_LAZY,     // decoded on the first access to an element
+    HTML_ENTITIES_EAGER     // decoded while parsing
+};
+
+/**
+ * what HtmlParser::SetStrict does at the first violation of well-formedness
+ */
+enum HtmlStrictMode {
+    HTML_STRICT_OFF,
+    HTML_STRICT_FALLBACK,   // parse again from the start, recovering
+    HTML_STRICT_ERROR       // stop there, see HtmlParser::GetStrictError
+};
+
+/**
+ * what HtmlParser::SetSkipTag keeps of a skipped element
+ */
+enum HtmlSkipMode {
+    HTML_SKIP_RAW,          // the element, with its unparsed content as value
+    HTML_SKIP_CONTENT,      // the element without content
+    HTML_SKIP_ELEMENT       // nothing
+};
+
+/**
+ * result of HtmlParser::ParseUntil
+ */
+struct HtmlPartialParse {
+    HtmlPartialParse()
+            : offset(0), stopped(false) {}
+
+    shared_ptr<HtmlDocument> doc;      // with the elements open at offset, closed there
+    size_t offset;      // byte offset where parsing stopped
+    bool stopped;       // stopped early by the targets or the boundary
+};
+
+/**
+ * class HtmlParser
+ * html parser, parses a whole buffer at once or incrementally chunk by chunk
+ */
+class HtmlParser {
+public:
+    friend class HtmlElement;
+    friend class HtmlParseSession;
+
+    /**
+     * called for every element as soon as it is closed and attached to its parent.
+     */
+    typedef std::function<void(const shared_ptr<HtmlElement> &)> ElementCallback;
+
+    HtmlParser()
+            : stream_(NULL), length_(0), index_(0), skip_(NULL), skip_len_(0), done_(false), feeding_(false),
+              stop_(false), stop_offset_(0), remaining_(0), close_at_(std::string::npos), close_scan_(0),
+              close_end_(std::string::npos), close_cut_(false), lazy_attributes_(false), lazy_depth_(0), lazy_min_bytes_(0), floor_(0), spans_(false), hashes_(false), fingerprint_(false), minhash_(64), shingle_(3), input_(NULL),
+              base_(0), line_(1), line_at_(0), line_start_(0), nodes_(0), exceeded_(0), entities_(HTML_ENTITIES_LAZY), strict_(HTML_STRICT_OFF),
+              strict_error_(std::string::npos) {}
+
+    /**
+     * parse html by C-Style data
+     * @param data
+     * @param len
+     * @return html document object
+     */
+    shared_ptr<HtmlDocument> Parse(const char *data, size_t len) {
+        Begin(data, len);
+        if (Strict()) {
+            if (RunStrict()) return End();
+
+            size_t error = index_;
+            if (strict_ == HTML_STRICT_FALLBACK) {
+                Begin(data, len);
+                Run(true);
+            }
+
+            strict_error_ = error;
+        } else {
+            Run(true);
+        }
+
+        return End();
+    }
+
+    /**
+     * parse html by string data
+     * @param data
+     * @return html document object
+     */
+    shared_ptr<HtmlDocument> Parse(const std::string &data) {
+        return Parse(data.data(), data.size());
+    }
+
+    /**
+     * parse only as far as needed: stops once an element matching each of
+     * the targets has been closed, or when a boundary tag opens. elements
+     * still open at that point are closed there and kept in the partial
+     * document, unlike the end of the input, where Parse drops them. the
+     * boundary element is left out.
+     * @param targets single step select rules such as "/link[@rel='canonical']"
+     * @param boundary tag name, for example "body", empty for none
+     */
+    HtmlPartialParse ParseUntil(const char *data, size_t len, const std::vector<std::string> &targets,
+                                const std::string &boundary = std::string()) {
+        Reset();
+        stream_ = data;
+        length_ = len;
+        input_ = data;
+        for (size_t i = 0; i < targets.size(); i++) {
+            std::string rule = (!targets[i].empty() && targets[i][0] == '/') ? targets[i] : "/" + targets[i];
+            targets_.push_back(HtmlSelectStep(rule, rule.size()));
+        }
+        matched_.assign(targets_.size(), 0);
+        remaining_ = targets_.size();
+        boundary_ = boundary;
+
+        Run(true);
+
+        HtmlPartialParse result;
+        result.stopped = stop_;
+        result.offset = (stop_ && stop_offset_ != std::string::npos) ? stop_offset_ : index_;
+        remaining_ = 0;
+        if (stop_) CloseOpenElements();
+
+        targets_.clear();
+        boundary_.clear();
+        result.doc = NewDocument();
         return result;
     }
 
-    std::string html() {
-        return root_->html();
+    HtmlPartialParse ParseUntil(const std::string &data, const std::vector<std::string> &targets,
+                                const std::string &boundary = std::string()) {
+        return ParseUntil(data.data(), data.size(), targets, boundary);
+    }
+
+    /**
+     * limits for the following parses. a parse that hits one goes on with
+     * the truncation described in HtmlParseLimits and warns once per limit.
+     */
+    void SetLimits(const HtmlParseLimits &limits) {
+        limits_ = limits;
+    }
+
+    /**
+     * when lazy, elements keep the attribute text of their start tag and
+     * parse it on the first access to their attributes. only the length of
+     * the text is bounded by the attribute limits then.
+     */
+    void SetLazyAttributes(bool lazy) {
+        lazy_attributes_ = lazy;
+    }
+
+    /**
+     * Parse builds the elements at depth (1 for the top level) without
+     * their subtree when the content is at least min_bytes long, only the
+     * structure is scanned to find where they end. the children are built
+     * on first access, the result is the same as without this option.
+     * not used with a max_nodes limit, by Feed or ParseUntil. the element
+     * callback is not called for elements built later. 0 turns it off.
+     * a copy of the whole input stays pinned by the document until every
+     * unbuilt subtree is built, see HtmlMemoryUsage::source.
+     */
+    void SetLazySubtrees(size_t depth, size_t min_bytes = 4096) {
+        lazy_depth_ = depth;
+        lazy_min_bytes_ = min_bytes;
+    }
+
+    /**
+     * character references in text and attribute values are decoded the
+     * html5 way, by default on first access to an element. html() escapes
+     * decoded text again. the content of script, style and skipped raw
+     * elements is never decoded.
+     */
+    void SetEntityDecoding(HtmlEntityMode mode) {
+        entities_ = mode;
+    }
+
+    /**
+     * Parse assumes well-formed input such as generated xhtml and reads it
+     * without the recovery of the state machine: text runs are found with
+     * memchr, a close tag has to match the open element and every element
+     * has to be closed. it gives the tree the recovering parse would.
+     * applies when no limits, lazy subtrees, source spans, skip tags or
+     * fingerprints are set, and with HTML_STRICT_FALLBACK no callback.
+     */
+    void SetStrict(HtmlStrictMode mode) {
+        strict_ = mode;
+    }
+
+    /**
+     * @return offset of the first violation in the last strict parse, npos when none
+     */
+    size_t GetStrictError() const {
+        return strict_error_;
+    }
+
+    /**
+     * give each element a hash of its name, attributes, value and the
+     * hashes of its children, computed bottom-up when it closes. equal
+     * subtrees parsed with the same options hash equal, whatever the
+     * attribute order. lazy attributes are hashed as written, an element
+     * whose children are not built yet by the source of its content.
+     * see html_parser_diff.hpp.
+     */
+    void SetSubtreeHashes(bool hashes) {
+        hashes_ = hashes;
+    }
+
+    /**
+     * compute an HtmlFingerprint of the visible text, the text text() would
+     * return, while the text is read; see HtmlDocument::GetFingerprint.
+     * lazy subtrees are read as well, without being built.
+     * @param minhash number of minhash values
+     * @param shingle tokens in a minhash shingle
+     */
+    void SetFingerprint(bool fingerprint, size_t minhash = 64, size_t shingle = 3) {
+        fingerprint_ = fingerprint;
+        minhash_ = minhash;
+        shingle_ = shingle;
+    }
+
+    /**
+     * record where each element is found in the input, see HtmlSourceSpan.
+     * the line of an element is counted from the previous one, so the
+     * cost stays linear in the input.
+     */
+    void SetSourceSpans(bool spans) {
+        spans_ = spans;
+    }
+
+    const HtmlParseLimits &GetLimits() const {
+        return limits_;
+    }
+
+    /**
+     * @return the HtmlLimit bits hit by the last parse
+     */
+    unsigned GetExceededLimits() const {
+        return exceeded_;
+    }
+
+    void SetElementCallback(const ElementCallback &callback) {
+        callback_ = callback;
+    }
+
+    /**
+     * the content of tag is not parsed, it is only scanned for the matching
+     * close tag (nested tags of the same name are counted).
+     * @param tag
+     * @param mode what is kept of the element
+     * @param attributes attributes of the element itself to keep, others are dropped
+     */
+    void SetSkipTag(const std::string &tag, HtmlSkipMode mode,
+                    const std::vector<std::string> &attributes = std::vector<std::string>()) {
+        SkipRule &rule = skip_tags_[tag];
+        rule.mode = mode;
+        rule.attributes.clear();
+        rule.attributes.insert(attributes.begin(), attributes.end());
+    }
+
+    void ClearSkipTags() {
+        skip_tags_.clear();
+    }
+
+    /**
+     * incremental parse, appends the next chunk of a document and parses
+     * as far as the data allows. the first call starts a new document.
+     * @param data
+     * @param len
+     */
+    void Feed(const char *data, size_t len) {
+        if (!feeding_) {
+            Reset();
+            buffer_.clear();
+            feeding_ = true;
+        }
+
+        if (done_ || stop_) return;
+
+        Compact();
+        buffer_.append(data, len);
+        stream_ = buffer_.data();
+        length_ = buffer_.size();
+        Run(false);
+    }
+
+    /**
+     * ends an incremental parse, elements still open are dropped like Parse does.
+     * @return html document object
+     */
+    shared_ptr<HtmlDocument> Finish() {
+        if (feeding_) {
+            Run(true);
+            if (stop_) CloseOpenElements();
+            feeding_ = false;
+        } else {
+            Reset();
+        }
+
+        return NewDocument();
+    }
+
+private:
+    enum ParseElementState {
+        PARSE_ELEMENT_TAG,
+        PARSE_ELEMENT_ATTR,
+        PARSE_ELEMENT_VALUE,
+        PARSE_ELEMENT_TAG_END
+    };
+
+    struct SkipRule {
+        HtmlSkipMode mode;
+        std::set<std::string> attributes;
+    };
+
+    /**
+     * an element whose close tag was not seen yet
+     */
+    struct Frame {
+        Frame(const shared_ptr<HtmlElement> &e, const HtmlParseLimits &limits)
+                : self(e), state(PARSE_ELEMENT_TAG), attr(limits), start(0), mark(0), skip(NULL), depth(0),
+                  shadow(false), shallow(false), hidden(false) {}
+
+        shared_ptr<HtmlElement> self;
+        ParseElementState state;
+        HtmlAttributeReader attr;
+        size_t start;           // the '<' of the start tag
+        size_t mark;            // content start, after the '>' of the start tag
+        const SkipRule *skip;   // set when the content is skipped
+        size_t depth;           // nested open tags of the same name while skipping
+        bool shadow;            // in a lazy subtree, only scanned for the structure
+        bool shallow;           // the content is not built
+        bool hidden;            // not part of text(), only set for fingerprints
+    };
+
+    /**
+     * sets up a parse of the whole of data, see Parse and HtmlParseSession.
+     */
+    void Begin(const char *data, size_t len) {
+        Reset();
+        stream_ = data;
+        length_ = len;
+        input_ = data;
+        if (lazy_depth_ && limits_.max_nodes == size_t(-1)) {
+            // the unexpanded elements read their children from a copy
+            source_.reset(new HtmlLazySource());
+            source_->data.assign(data, len);
+            source_->parser.reset(new HtmlParser());
+            source_->parser->CopyOptions(*this);
+            stream_ = source_->data.data();
+        }
+    }
+
+    shared_ptr<HtmlDocument> End() {
+        if (stop_) CloseOpenElements();
+        source_.reset();
+        spare_.clear();
+        return NewDocument();
+    }
+
+    shared_ptr<HtmlDocument> NewDocument() {
+        shared_ptr<HtmlDocument> doc(new HtmlDocument(root_));
+        if (fingerprint_) {
+            // the text of an element left open counts as read, like in a lazy subtree
+            if (!stack_.empty() && !stack_.back().hidden) {
+                const std::string &value = stack_.back().self->value;
+                fingerprinter_.Add(value.data(), value.size());
+            }
+            fingerprinter_.Finish(doc->fingerprint_);
+        }
+        return doc;
+    }
+
+    void Reset() {
+        root_.reset(new HtmlElement());
+        stack_.clear();
+        stream_ = NULL;
+        length_ = 0;
+        index_ = 0;
+        skip_ = NULL;
+        done_ = false;
+        feeding_ = false;
+        stop_ = false;
+        remaining_ = 0;
+        open_.clear();
+        close_at_ = std::string::npos;
+        nodes_ = 0;
+        exceeded_ = 0;
+        strict_error_ = std::string::npos;
+        if (fingerprint_) fingerprinter_.Reset(minhash_, shingle_);
+        source_.reset();
+        input_ = NULL;
+        base_ = 0;
+        line_ = 1;
+        line_at_ = 0;
+        line_start_ = 0;
+        span_open_.reset();
+    }
+
+    bool Strict() const {
+        const HtmlParseLimits &l = limits_;
+        return strict_ != HTML_STRICT_OFF && !lazy_depth_ && !spans_ && skip_tags_.empty() && !fingerprint_ &&
+               !(callback_ && strict_ == HTML_STRICT_FALLBACK) &&
+               (l.max_depth & l.max_nodes & l.max_attributes & l.max_attribute_length & l.max_name_length &
+                l.max_text_length) == size_t(-1);
+    }
+
+    /**
+     * reads the whole input the strict way, see SetStrict. elements are
+     * attached as they close like in Run.
+     * @return false at the first violation, index_ is its offset
+     */
+    bool RunStrict() {
+        // 1: ends a tag name, 2: dropped from text
+        static const unsigned char table[256] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 3, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        };
+
+        std::vector<shared_ptr<HtmlElement> > open;
+        HtmlAttributeReader attr(limits_);
+        const char *begin = stream_;
+        const char *end = stream_ + length_;
+        const char *p = begin;
+        for (;;) {
+            if (open.empty()) {
+                while (p < end && (*p == ' ' || (table[(unsigned char) *p] & 2))) p++;
+                if (p == end) return true;
+                if (*p != '<') break;
+            } else {
+                HtmlElement *self = open.back().get();
+                if (self->flags & HTML_TAG_RAW_TEXT) {
+                    std::string close = "</" + self->name + ">";
+                    index_ = p - begin;
+                    size_t pos = Find(index_, close.data(), close.size());
+                    if (pos == std::string::npos) {
+                        p = end;
+                        break;
+                    }
+
+                    if (begin + pos > p) AppendText(self, p, begin + pos - p);
+                    p = begin + pos + close.size();
+                    CloseStrict(open);
+                    continue;
+                }
+
+                const char *lt = (const char *) memchr(p, '<', end - p);
+                if (!lt) {
+                    p = end;
+                    break;
+                }
+
+                while (p < lt) {
+                    const char *q = p;
+                    while (q < lt && !(table[(unsigned char) *q] & 2)) q++;
+                    self->value.append(p, q - p);
+                    p = q < lt ? q + 1 : lt;
+                }
+
+                FlushValue(open.back());
+            }
+
+            // p is at '<'
+            if (end - p < 2) break;
+
+            char c = p[1];
+            if (c == '/') {
+                if (open.empty()) break;
+
+                const std::string &name = open.back()->name;
+                if ((size_t) (end - p) < name.size() + 3 || memcmp(p + 2, name.data(), name.size()) != 0 ||
+                    p[name.size() + 2] != '>') break;
+
+                p += name.size() + 3;
+                CloseStrict(open);
+            } else if (c == '!' || c == '?') {
+                bool comment = c == '!' && end - p >= 4 && memcmp(p, "<!--", 4) == 0;
+                const char *delimiter = comment ? "-->" : (c == '!' ? ">" : "?>");
+                size_t pos = Find(p - begin + (c == '!' ? 2 : 0), delimiter, strlen(delimiter));
+                if (pos == std::string::npos) break;
+
+                p = begin + pos + strlen(delimiter);
+            } else {
+                if (!((c | 0x20) >= 'a' && (c | 0x20) <= 'z')) break;
+
+                const char *q = p + 1;
+                while (q < end && !(table[(unsigned char) *q] & 1)) q++;
+                if (q == end) break;
+
+                nodes_++;
+                shared_ptr<HtmlElement> e(new HtmlElement(open.empty() ? root_ : open.back()));
+                if (entities_ != HTML_ENTITIES_KEEP)
+                    e->entities.store(HtmlElement::ENTITIES_PENDING, std::memory_order_relaxed);
+                e->name.assign(p + 1, q - p - 1);
+                e->flags = HtmlTag::Lookup(e->name);
+
+                bool closed = false;
+                if (*q == '/') {
+                    if (end - q < 2 || q[1] != '>') break;
+
+                    p = q + 2;
+                    closed = true;
+                } else if (*q == '>') {
+                    p = q + 1;
+                } else {
+                    const char *gt = (const char *) memchr(q, '>', end - q);
+                    if (!gt) break;
+
+                    closed = gt[-1] == '/';
+                    const char *text = q + 1;
+                    const char *text_end = closed && gt - 1 > q ? gt - 1 : gt;
+                    if (lazy_attributes_) {
+                        e->attribute_text.assign(text, std::max(text, text_end) - text);
+                        if (!e->attribute_text.empty()) e->attribute_pending.store(HtmlElement::LAZY_PENDING, std::memory_order_relaxed);
+                    } else if (text < text_end) {
+                        attr.Read(text, text_end - text, e->attribute);
+                        // a quote left open hides a '>' the recovering parse stops at
+                        if (attr.Quoted()) {
+                            p = q;
+                            break;
+                        }
+                        attr.End(e->attribute);
+                    }
+
+                    p = gt + 1;
+                }
+
+                open.push_back(e);
+                if (closed || (e->flags & HTML_TAG_VOID)) CloseStrict(open);
+            }
+        }
+
+        index_ = p - begin;
+        return false;
+    }
+
+    /**
+     * attaches the last of the open elements of RunStrict to its parent.
+     */
+    void CloseStrict(std::vector<shared_ptr<HtmlElement> > &open) {
+        shared_ptr<HtmlElement> self;
+        self.swap(open.back());
+        open.pop_back();
+        if (!self->value.empty()) {
+            self->value.erase(0, self->value.find_first_not_of(" "));
+            self->value.erase(self->value.find_last_not_of(" ") + 1);
+        }
+
+        DecodeEntities(self.get());
+        if (hashes_) HashElement(self.get(), NULL, 0);
+        (open.empty() ? root_ : open.back())->children.push_back(self);
+        if (callback_) callback_(self);
+    }
+
+    /**
+     * runs the state machine until the data is exhausted. when final is
+     * false it stops in front of any token that may continue in the next
+     * chunk, all state lives in stack_ and index_ so it can resume there.
+     */
+    void Run(bool final) {
+        while (!done_) {
+            if (skip_ && !SkipPending(final)) return;
+            if (stop_ || length_ <= index_) return;
+
+            if (stack_.empty()) {
+                char input = stream_[index_];
+                if (input == '\r' || input == '\n' || input == '\t' || input == ' ') {
+                    index_++;
+                } else if (input == '<') {
+                    if (!ParseElement(root_, final)) return;
+                } else {
+                    done_ = true;
+                }
+
+                continue;
+            }
+
+            Frame &frame = stack_.back();
+            HtmlElement *self = frame.self.get();
+            switch (frame.state) {
+                case PARSE_ELEMENT_TAG: {
+                    char input = stream_[index_];
+                    if (input == ' ' || input == '\r' || input == '\n' || input == '\t') {
+                        if (!self->name.empty()) {
+                            if (!EndTagName(frame)) break;
+                            frame.state = PARSE_ELEMENT_ATTR;
+                        }
+                        index_++;
+                    } else if (input == '/') {
+                        if (!EndTagName(frame)) break;
+                        // the span ends with the '>' SkipUntil finds
+                        if (self->span) span_open_ = frame.self;
+                        CloseElement(index_, index_);
+                        SkipUntil(index_, ">");
+                    } else if (input == '>') {
+                        if (!EndTagName(frame)) break;
+                        if (self->flags & HTML_TAG_VOID) {
+                            CloseElement(index_ + 1, index_ + 1);
+                            index_++;
+                        } else {
+                            OpenContent(frame);
+                        }
+                    } else {
+                        if (self->name.size() < limits_.max_name_length) {
+                            self->name.append(stream_ + index_, 1);
+                        } else {
+                            Exceed(HTML_LIMIT_NAME_LENGTH);
+                        }
+                        index_++;
+                    }
+                }
+                break;
+
+                case PARSE_ELEMENT_ATTR: {
+                    const char *gt = (const char *) memchr(stream_ + index_, '>', length_ - index_);
+                    if (!gt) {
+                        if (final) {
+                            // the element is dropped at the end like any other open one
+                            index_ = length_;
+                            break;
+                        }
+
+                        // a trailing '/' may still turn out to close the tag
+                        ReadAttributes(frame, stream_[length_ - 1] == '/' ? length_ - 1 : length_);
+                        return;
+                    }
+
+                    size_t end = gt - stream_;
+                    bool closed = stream_[end - 1] == '/';
+                    ReadAttributes(frame, closed ? end - 1 : end);
+                    EndAttributes(frame);
+                    index_ = end;
+                    if (closed || (self->flags & HTML_TAG_VOID)) {
+                        CloseElement(end + 1, end + 1);
+                        index_++;
+                    } else {
+                        OpenContent(frame);
+                    }
+                }
+                break;
+
+                case PARSE_ELEMENT_VALUE: {
+                    if (frame.skip) {
+                        if (!SkipContent(frame, final)) return;
+
+                        CloseElement(index_ - self->name.size() - 3, index_);
+                        break;
+                    }
+
+                    if (self->flags & HTML_TAG_RAW_TEXT) {
+                        std::string close = "</" + self->name + ">";
+                        size_t pos = Find(index_, close.data(), close.size());
+                        if (pos == std::string::npos) {
+                            if (!final) {
+                                // keep a close tag split across chunks
+                                if (length_ + 1 > index_ + close.size()) index_ = length_ + 1 - close.size();
+                                return;
+                            }
+
+                            index_ = length_;
+                            if (index_ > (frame.mark + close.size()) && !frame.shadow)
+                                AppendText(self, stream_ + frame.mark, index_ - frame.mark - close.size());
+                            CloseElement(index_, index_);
+                        } else {
+                            index_ = pos + close.size();
+                            if (pos > frame.mark && !frame.shadow)
+                                AppendText(self, stream_ + frame.mark, pos - frame.mark);
+                            CloseElement(pos, index_);
+                        }
+
+                        break;
+                    }
+
+                    if (frame.shallow) {
+                        // the text is not built, only tags matter
+                        const char *p = (const char *) memchr(stream_ + index_, '<', length_ - index_);
+                        size_t end = p ? p - stream_ : length_;
+                        if (fingerprint_ && !frame.hidden) fingerprinter_.Add(stream_ + index_, end - index_);
+                        index_ = end;
+                        if (!p) break;
+                    }
+
+                    char input = stream_[index_];
+                    if (input == '<') {
+                        if (!final && length_ <= index_ + 1) return;
+
+                        FlushValue(frame.self);
+
+                        if (At(index_ + 1) == '/') {
+                            frame.state = PARSE_ELEMENT_TAG_END;
+                        } else if (!ParseElement(frame.self, final)) {
+                            return;
+                        }
+                    } else if (input != '\r' && input != '\n' && input != '\t') {
+                        if (self->value.size() < limits_.max_text_length) {
+                            self->value.append(stream_ + index_, 1);
+                        } else {
+                            Exceed(HTML_LIMIT_TEXT_LENGTH);
+                        }
+                        index_++;
+                    } else {
+                        index_++;
+                    }
+                }
+                break;
+
+                case PARSE_ELEMENT_TAG_END: {
+                    size_t pre = index_ + 2;
+                    const std::string &name = self->name;
+                    if (!final && length_ < pre + name.size() + 1) return;
+
+                    if (length_ > pre + name.size() && memcmp(stream_ + pre, name.data(), name.size()) == 0 &&
+                        stream_[pre + name.size()] == '>') {
+                        // a shadow element is cleared for reuse as it closes
+                        size_t end = pre + name.size() + 1;
+                        CloseElement(index_, end);
+                        index_ = end;
+                        break;
+                    }
+
+                    // a close tag that closes several elements is scanned once
+                    if (close_at_ != index_) {
+                        close_at_ = index_;
+                        close_scan_ = pre;
+                        close_end_ = std::string::npos;
+                    }
+
+                    if (close_end_ == std::string::npos) {
+                        const char *end = close_scan_ < length_
+                                          ? (const char *) memchr(stream_ + close_scan_, '>', length_ - close_scan_)
+                                          : NULL;
+                        if (!end && !final) {
+                            close_scan_ = std::max(close_scan_, length_);
+                            return;
+                        }
+
+                        close_end_ = end ? end - stream_ + 1 : length_;
+                        // matched like the start tag names, which were cut the same way
+                        close_cut_ = HtmlTag::CloseName(stream_ + pre, stream_ + close_end_,
+                                                        limits_.max_name_length, close_name_);
+                    }
+
+                    const std::string &value = close_name_;
+                    size_t index = close_end_;
+                    if (close_cut_ && value == name) {
+                        CloseElement(index_, index);
+                        index_ = index;
+                        break;
+                    }
+
+                    bool opened = value.empty();
+                    if (!opened) {
+                        // the innermost element is open under this name too, it is no ancestor
+                        std::unordered_map<std::string, size_t>::const_iterator it = open_.find(value);
+                        opened = it != open_.end() && it->second > (value == name ? 1u : 0u);
+                    }
+
+                    if (opened) {
+                        std::cerr << "WARN : element not closed <" << name << "> " << std::endl;
+                        CloseElement(index_, index_);
+                        index_ = pre - 2;
+                    } else {
+                        std::cerr << "WARN : unexpected closed element </" << value << "> for <" << name
+                                  << ">" << std::endl;
+                        frame.state = PARSE_ELEMENT_VALUE;
+                        index_ = index;
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    /**
+     * handles the '<' at index_: skips comments, declarations, processing
+     * instructions and stray close tags, otherwise opens a child of parent.
+     * @return false when more data is needed to decide
+     */
+    bool ParseElement(shared_ptr<HtmlElement> parent, bool final) {
+        if (!final && length_ <= index_ + 1) return false;
+
+        char input = At(index_ + 1);
+        if (input == '!') {
+            if (!final && length_ < index_ + 4) return false;
+
+            if (length_ >= index_ + 4 && strncmp(stream_ + index_, "<!--", 4) == 0) {
+                SkipUntil(index_ + 2, "-->");
+            } else {
+                SkipUntil(index_ + 2, ">");
+            }
+        } else if (input == '/') {
+            SkipUntil(index_, ">");
+        } else if (input == '?') {
+            SkipUntil(index_, "?>");
+        } else if (stack_.size() >= limits_.max_depth) {
+            // too deep, the start tag is ignored
+            Exceed(HTML_LIMIT_DEPTH);
+            SkipUntil(index_, ">");
+        } else if (nodes_ >= limits_.max_nodes) {
+            Exceed(HTML_LIMIT_NODES);
+            stop_ = true;
+            stop_offset_ = std::string::npos;
+        } else if (!stack_.empty() && stack_.back().shallow) {
+            // scanned only, the element is reused once closed
+            shared_ptr<HtmlElement> e;
+            if (spare_.empty()) {
+                e.reset(new HtmlElement());
+            } else {
+                e.swap(spare_.back());
+                spare_.pop_back();
+            }
+
+            stack_.push_back(Frame(e, limits_));
+            stack_.back().start = index_++;
+            stack_.back().shadow = true;
+        } else {
+            nodes_++;
+            stack_.push_back(Frame(shared_ptr<HtmlElement>(new HtmlElement(parent)), limits_));
+            stack_.back().start = index_++;
+            if (spans_) OpenSpan(stack_.back());
+            if (entities_ != HTML_ENTITIES_KEEP)
+                stack_.back().self->entities.store(HtmlElement::ENTITIES_PENDING, std::memory_order_relaxed);
+        }
+
+        return true;
     }
 
-    std::string text() {
-        return root_->text();
+    /**
+     * the tag name of frame is complete, look up how to treat it.
+     * @return false when it is the ParseUntil boundary, the tag is not read further
+     */
+    bool EndTagName(Frame &frame) {
+        frame.self->flags = HtmlTag::Lookup(frame.self->name);
+        // where text() starts a new line or cell, tokens do not run on
+        if (fingerprint_ && (frame.self->flags & (HTML_TAG_BLOCK | HTML_TAG_TABLE_CELL))) fingerprinter_.Break();
+        if (!skip_tags_.empty()) {
+            std::unordered_map<std::string, SkipRule>::const_iterator it = skip_tags_.find(frame.self->name);
+            if (it != skip_tags_.end()) frame.skip = &it->second;
+        }
+
+        if (!boundary_.empty() && frame.self->name == boundary_ && !stop_) {
+            stop_ = true;
+            stop_offset_ = frame.start;
+            return false;
+        }
+
+        return true;
     }
 
-private:
-    shared_ptr<HtmlElement> root_;
-};
+    void CopyOptions(const HtmlParser &other) {
+        skip_tags_ = other.skip_tags_;
+        limits_ = other.limits_;
+        lazy_attributes_ = other.lazy_attributes_;
+        spans_ = other.spans_;
+        entities_ = other.entities_;
+        hashes_ = other.hashes_;
+    }
 
-/**
- * class HtmlParser
- * html parser and only one interface
- */
-class HtmlParser {
-public:
-    HtmlParser() {
-        static const std::string token[] = { "br", "hr", "img", "input", "link", "meta",
-        "area", "base", "col", "command", "embed", "keygen", "param", "source", "track", "wbr"};
-        self_closing_tags_.insert(token, token + sizeof(token) / sizeof(token[0]));
+    /**
+     * builds the children of an element a lazy parse left unexpanded, by
+     * parsing its content again the way the whole document was parsed:
+     * with its open ancestors, up to the point where it is closed.
+     */
+    void Expand(const shared_ptr<HtmlElement> &self) {
+        HtmlParseLimits limits = limits_;
+        Reset();
+        stream_ = self->source->data.data();
+        length_ = self->source->data.size();
+        index_ = self->source_offset;
+        if (self->span) {
+            // lines are counted on from the start tag
+            input_ = self->span->input;
+            line_ = self->span->line;
+            line_at_ = self->span->outer_begin;
+            line_start_ = line_at_ + 1 - self->span->column;
+        }
+
+        size_t depth = 0;
+        for (shared_ptr<HtmlElement> p = self->parent.lock(); p; p = p->parent.lock()) {
+            open_[p->name]++;
+            depth++;
+        }
+
+        // the root counts as one of them
+        if (limits_.max_depth != size_t(-1)) limits_.max_depth -= std::min(limits_.max_depth, depth - 1);
+
+        open_[self->name]++;
+        stack_.push_back(Frame(self, limits_));
+        stack_.back().state = PARSE_ELEMENT_VALUE;
+        stack_.back().mark = index_;
+        floor_ = 1;
+        Run(true);
+
+        floor_ = 0;
+        stack_.clear();
+        limits_ = limits;
     }
 
     /**
-     * parse html by C-Style data
-     * @param data
-     * @param len
-     * @return html document object
+     * ends a parse stopped early: a start tag still being read is left
+     * out, the open elements are closed.
      */
-    shared_ptr<HtmlDocument> Parse(const char *data, size_t len) {
-        stream_ = data;
-        length_ = len;
-        size_t index = 0;
-        root_.reset(new HtmlElement());
-        while (length_ > index) {
-            char input = stream_[index];
-            if (input == '\r' || input == '\n' || input == '\t' || input == ' ') {
-                index++;
-            } else if (input == '<') {
-                index = ParseElement(index, root_);
-            } else {
-                break;
+    void CloseOpenElements() {
+        if (!stack_.empty() && stack_.back().state != PARSE_ELEMENT_VALUE &&
+            stack_.back().state != PARSE_ELEMENT_TAG_END) {
+            stack_.pop_back();
+        }
+
+        size_t end = stop_offset_ == std::string::npos ? index_ : stop_offset_;
+        stop_ = false;
+        while (!stack_.empty()) {
+            FlushValue(stack_.back().self);
+            CloseElement(end, end);
+        }
+    }
+
+    void Exceed(unsigned limits) {
+        static const char *names[] = {"max_depth", "max_nodes", "max_attributes", "max_attribute_length",
+                                      "max_name_length", "max_text_length"};
+        if (!(limits & ~exceeded_)) return;
+
+        for (unsigned i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+            unsigned limit = 1u << i;
+            if ((limits & limit) && !(exceeded_ & limit)) {
+                exceeded_ |= limit;
+                std::cerr << "WARN : limit " << names[i] << " exceeded" << std::endl;
             }
         }
+    }
+
+    void AppendText(HtmlElement *self, const char *data, size_t len) {
+        size_t room = limits_.max_text_length - std::min(self->value.size(), limits_.max_text_length);
+        if (len > room) {
+            Exceed(HTML_LIMIT_TEXT_LENGTH);
+            len = room;
+        }
 
-        return shared_ptr<HtmlDocument>(new HtmlDocument(root_));
+        self->value.append(data, len);
     }
 
     /**
-     * parse html by string data
-     * @param data
-     * @return html document object
+     * reads the attribute text [index_, end) of the start tag in frame.
      */
-    shared_ptr<HtmlDocument> Parse(const std::string &data) {
-        return Parse(data.data(), data.size());
+    void ReadAttributes(Frame &frame, size_t end) {
+        HtmlElement *self = frame.self.get();
+        if (frame.shadow) {
+        } else if (lazy_attributes_) {
+            // kept as text, bounded like the attributes it holds
+            size_t each = limits_.max_name_length + limits_.max_attribute_length + 4;
+            bool overflow = each < limits_.max_name_length || limits_.max_attributes > size_t(-1) / each;
+            size_t cap = overflow ? size_t(-1) : limits_.max_attributes * each;
+            size_t room = cap - std::min(cap, self->attribute_text.size());
+            if (end - index_ > room) Exceed(HTML_LIMIT_ATTRIBUTE_LENGTH);
+            self->attribute_text.append(stream_ + index_, std::min(end - index_, room));
+        } else {
+            frame.attr.Read(stream_ + index_, end - index_, self->attribute);
+        }
+
+        index_ = end;
     }
 
-private:
-    size_t ParseElement(size_t index, shared_ptr<HtmlElement> &element) {
-        while (length_ > index) {
-            char input = stream_[index + 1];
-            if (input == '!') {
-                if (strncmp(stream_ + index, "<!--", 4) == 0) {
-                    return SkipUntil(index + 2, "-->");
-                } else {
-                    return SkipUntil(index + 2, '>');
-                }
-            } else if (input == '/') {
-                return SkipUntil(index, '>');
-            } else if (input == '?') {
-                return SkipUntil(index, "?>");
+    /**
+     * the start tag of frame ended.
+     */
+    void EndAttributes(Frame &frame) {
+        HtmlElement *self = frame.self.get();
+        if (frame.shadow) return;
+
+        if (lazy_attributes_) {
+            if (!self->attribute_text.empty()) self->attribute_pending.store(HtmlElement::LAZY_PENDING, std::memory_order_relaxed);
+            return;
+        }
+
+        frame.attr.End(self->attribute);
+        if (frame.attr.GetExceeded()) Exceed(frame.attr.GetExceeded());
+    }
+
+    /**
+     * the start tag of frame is complete, its content follows.
+     */
+    void OpenContent(Frame &frame) {
+        frame.state = PARSE_ELEMENT_VALUE;
+        frame.mark = ++index_;
+        if (frame.self->span) frame.self->span->inner_begin = base_ + index_;
+        open_[frame.self->name]++;
+        frame.shallow = frame.shadow || (source_ && stack_.size() == lazy_depth_ && !frame.skip &&
+                                         !(frame.self->flags & HTML_TAG_RAW_TEXT));
+        if (fingerprint_) {
+            frame.hidden = (frame.self->flags & (HTML_TAG_INVISIBLE | HTML_TAG_RAW_TEXT)) ||
+                           (stack_.size() > 1 && stack_[stack_.size() - 2].hidden);
+        }
+    }
+
+    /**
+     * moves the text collected so far into a plain child.
+     */
+    void FlushValue(const shared_ptr<HtmlElement> &self) {
+        if (!self->value.empty()) {
+            if (fingerprint_ && !stack_.back().hidden) fingerprinter_.Add(self->value.data(), self->value.size());
+
+            if (nodes_ >= limits_.max_nodes) {
+                Exceed(HTML_LIMIT_NODES);
+                self->value.clear();
+                stop_ = true;
+                stop_offset_ = std::string::npos;
+                return;
             }
 
-            shared_ptr<HtmlElement> self(new HtmlElement(element));
+            nodes_++;
+            shared_ptr<HtmlElement> child(new HtmlElement(self));
+            child->name = "plain";
+            child->value.swap(self->value);
+            if (entities_ != HTML_ENTITIES_KEEP) {
+                child->entities.store(HtmlElement::ENTITIES_PENDING, std::memory_order_relaxed);
+                DecodeEntities(child.get());
+            }
+            if (hashes_) HashElement(child.get(), NULL, 0);
+            self->children.push_back(child);
+        }
+    }
 
-            enum ParseElementState {
-                PARSE_ELEMENT_TAG,
-                PARSE_ELEMENT_ATTR,
-                PARSE_ELEMENT_VALUE,
-                PARSE_ELEMENT_TAG_END
-            };
+    /**
+     * a complete element without any '&' is decoded as it is, so readers
+     * never take the lock for it. eager decoding leaves lazy attributes
+     * pending.
+     */
+    void DecodeEntities(HtmlElement *e) {
+        if (e->entities.load(std::memory_order_relaxed) != HtmlElement::ENTITIES_PENDING) return;
+
+        bool found = (!(e->flags & HTML_TAG_RAW_TEXT) && memchr(e->value.data(), '&', e->value.size())) ||
+                     memchr(e->attribute_text.data(), '&', e->attribute_text.size());
+        std::map<std::string, std::string>::const_iterator it = e->attribute.begin();
+        for (; it != e->attribute.end() && !found; ++it) {
+            found = memchr(it->second.data(), '&', it->second.size()) != NULL;
+        }
 
-            ParseElementState state = PARSE_ELEMENT_TAG;
-            index++;
-            char split = 0;
-            std::string attr;
-
-            while (length_ > index) {
-                switch (state) {
-                    case PARSE_ELEMENT_TAG: {
-                        char input = stream_[index];
-                        if (input == ' ' || input == '\r' || input == '\n' || input == '\t') {
-                            if (!self->name.empty()) {
-                                state = PARSE_ELEMENT_ATTR;
-                            }
-                            index++;
-                        } else if (input == '/') {
-                            self->Parse(attr);
-                            element->children.push_back(self);
-                            return SkipUntil(index, '>');
-                        } else if (input == '>') {
-                            if(self_closing_tags_.find(self->name) != self_closing_tags_.end()) {
-                                element->children.push_back(self);
-                                return ++index;
-                            }
-                            state = PARSE_ELEMENT_VALUE;
-                            index++;
-                        } else {
-                            self->name.append(stream_ + index, 1);
-                            index++;
-                        }
-                    }
-                    break;
+        if (found) {
+            if (entities_ != HTML_ENTITIES_EAGER || e->attribute_pending.load(std::memory_order_relaxed)) return;
+            e->Decode();
+        }
 
-                    case PARSE_ELEMENT_ATTR: {
-                        char input = stream_[index];
-                        if (input == '>') {
-                            if (stream_[index - 1] == '/') {
-                                attr.erase(attr.size() - 1);
-                                self->Parse(attr);
-                                element->children.push_back(self);
-                                return ++index;
-                            } else if(self_closing_tags_.find(self->name) != self_closing_tags_.end()) {
-                                self->Parse(attr);
-                                element->children.push_back(self);
-                                return ++index;
-                            }
-                            state = PARSE_ELEMENT_VALUE;
-                            index++;
-                        } else {
-                            attr.append(stream_ + index, 1);
-                            index++;
-                        }
-                    }
-                    break;
+        e->entities.store(HtmlElement::ENTITIES_DECODED, std::memory_order_relaxed);
+    }
 
-                    case PARSE_ELEMENT_VALUE: {
-                        if (self->name == "script" || self->name == "noscript" || self->name == "style") {
-                            std::string close = "</" + self->name + ">";
+    /**
+     * @param content source of the children when they are not built
+     */
+    void HashElement(HtmlElement *e, const char *content, size_t len) {
+        HtmlHash hash;
+        hash.Add(e->name);
+        if (e->attribute_pending.load(std::memory_order_relaxed)) {
+            hash.Add(e->attribute_text);
+        } else {
+            hash.Add((uint64_t) e->attribute.size());
+            std::map<std::string, std::string>::const_iterator it = e->attribute.begin();
+            for (; it != e->attribute.end(); ++it) {
+                hash.Add(it->first);
+                hash.Add(it->second);
+            }
+        }
 
-                            size_t pre = index;
-                            index = SkipUntil(index, close.c_str());
-                            if (index > (pre + close.size()))
-                                self->value.append(stream_ + pre, index - pre - close.size());
+        hash.Add(e->value);
+        if (content) {
+            hash.Add(content, len);
+        } else {
+            hash.Add((uint64_t) e->children.size());
+            for (size_t i = 0; i < e->children.size(); i++) hash.Add(e->children[i]->hash);
+        }
 
-                            self->Parse(attr);
-                            element->children.push_back(self);
-                            return index;
-                        }
+        e->hash = hash.Value();
+    }
 
-                        char input = stream_[index];
-                        if (input == '<') {
-                            if (!self->value.empty()) {
-                                shared_ptr<HtmlElement> child(new HtmlElement(self));
-                                child->name = "plain";
-                                child->value.swap(self->value);
-                                self->children.push_back(child);
-                            }
+    /**
+     * counts the ParseUntil targets matched by a closed element.
+     */
+    void MatchTargets(const shared_ptr<HtmlElement> &self) {
+        for (size_t i = 0; i < targets_.size(); i++) {
+            if (matched_[i]) continue;
+
+            const std::map<std::string, std::string> &attribute = self->Attributes();
+            std::map<std::string, std::string>::const_iterator found = attribute.find(targets_[i].attr);
+            matched_[i] = (found == attribute.end())
+                          ? targets_[i].Match(self->name.data(), self->name.size(), NULL, 0, false)
+                          : targets_[i].Match(self->name.data(), self->name.size(), found->second.data(),
+                                              found->second.size(), true);
+            if (matched_[i]) remaining_--;
+        }
 
-                            if (stream_[index + 1] == '/') {
-                                state = PARSE_ELEMENT_TAG_END;
-                            } else {
-                                index = ParseElement(index, self);
-                            }
-                        } else if (input != '\r' && input != '\n' && input != '\t') {
-                            self->value.append(stream_ + index, 1);
-                            index++;
-                        } else {
-                            index++;
-                        }
-                    }
-                    break;
+        if (remaining_ == 0 && !stop_) {
+            // the close tag is consumed before Run checks stop_
+            stop_ = true;
+            stop_offset_ = std::string::npos;
+        }
+    }
 
-                    case PARSE_ELEMENT_TAG_END: {
-                        index += 2;
-                        std::string selfname = self->name + ">";
-                        if (strncmp(stream_ + index, selfname.c_str(), selfname.size())) {
-                            size_t pre = index;
-                            index = SkipUntil(index, ">");
-                            std::string value;
-                            if (index > (pre + 1))
-                                value.append(stream_ + pre, index - pre - 1);
-                            else
-                                value.append(stream_ + pre, index - pre);
-
-                            shared_ptr<HtmlElement> parent = self->GetParent();
-                            while (parent) {
-                                if (parent->name == value) {
-                                    std::cerr << "WARN : element not closed <" << self->name << "> " << std::endl;
-                                    self->Parse(attr);
-                                    element->children.push_back(self);
-                                    return pre - 2;
-                                }
-
-                                parent = parent->GetParent();
-                            }
+    /**
+     * the element of frame starts at frame.start.
+     */
+    void OpenSpan(Frame &frame) {
+        size_t begin = base_ + frame.start;
+        CountLines(begin);
+
+        HtmlSourceSpan *span = new HtmlSourceSpan();
+        span->input = input_;
+        span->outer_begin = begin;
+        span->line = line_;
+        span->column = begin - line_start_ + 1;
+        frame.self->span.reset(span);
+    }
 
-                            std::cerr << "WARN : unexpected closed element </" << value << "> for <" << self->name
-                                      << ">" << std::endl;
-                            state = PARSE_ELEMENT_VALUE;
-                        } else {
-                            self->Parse(attr);
-                            element->children.push_back(self);
-                            return SkipUntil(index, '>');
-                        }
-                    }
-                    break;
+    /**
+     * counts the lines of the input up to offset end.
+     */
+    void CountLines(size_t end) {
+        if (end <= line_at_) return;
+
+        const char *p = stream_ + (line_at_ - base_);
+        const char *last = stream_ + (end - base_);
+        while ((p = (const char *) memchr(p, '\n', last - p)) != NULL) {
+            line_++;
+            line_start_ = base_ + (++p - stream_);
+        }
+
+        line_at_ = end;
+    }
+
+    /**
+     * attaches the innermost open element to its parent.
+     * @param inner_end where its content ends
+     * @param outer_end where its close tag ends
+     */
+    void CloseElement(size_t inner_end, size_t outer_end) {
+        if (stack_.size() == floor_) {
+            // the element whose children Expand builds
+            stack_.pop_back();
+            stop_ = true;
+            return;
+        }
+
+        shared_ptr<HtmlElement> self;
+        self.swap(stack_.back().self);
+        if (!self->value.empty()) {
+            self->value.erase(0, self->value.find_first_not_of(" "));
+            self->value.erase(self->value.find_last_not_of(" ") + 1);
+        }
+        const SkipRule *skip = stack_.back().skip;
+        if (stack_.back().state == PARSE_ELEMENT_VALUE || stack_.back().state == PARSE_ELEMENT_TAG_END) {
+            std::unordered_map<std::string, size_t>::iterator it = open_.find(self->name);
+            if (--it->second == 0) open_.erase(it);
+        }
+
+        if (stack_.back().shadow) {
+            self->name.clear();
+            spare_.push_back(self);
+            stack_.pop_back();
+            return;
+        }
+
+        bool shallow = stack_.back().shallow;
+        size_t mark = stack_.back().mark;
+        if (self->span) {
+            HtmlSourceSpan *span = self->span.get();
+            if (stack_.back().state != PARSE_ELEMENT_VALUE && stack_.back().state != PARSE_ELEMENT_TAG_END)
+                span->inner_begin = base_ + inner_end;
+            span->inner_end = base_ + inner_end;
+            span->outer_end = base_ + outer_end;
+        }
+        stack_.pop_back();
+
+        if (skip) {
+            if (skip->mode == HTML_SKIP_ELEMENT) return;
+
+            // the value is the unparsed content
+            if (skip->mode == HTML_SKIP_RAW) self->flags |= HTML_TAG_RAW_TEXT;
+            self->Attributes();
+            std::map<std::string, std::string>::iterator it = self->attribute.begin();
+            while (it != self->attribute.end()) {
+                if (skip->attributes.count(it->first)) {
+                    ++it;
+                } else {
+                    self->attribute.erase(it++);
                 }
             }
         }
-        
-        return index;
-    }
 
-    size_t SkipUntil(size_t index, const char *data) {
-        while (length_ > index) {
-            if (strncmp(stream_ + index, data, strlen(data)) == 0) {
-                return index + strlen(data);
+        DecodeEntities(self.get());
+        if (hashes_) {
+            bool pending = shallow && index_ > mark;
+            HashElement(self.get(), pending ? stream_ + mark : NULL, pending ? index_ - mark : 0);
+        }
+
+        (stack_.empty() ? root_ : stack_.back().self)->children.push_back(self);
+        if (shallow && index_ > mark) {
+            // the '<' of the close tag ends the content
+            self->source = source_;
+            self->source_offset = mark;
+            if (index_ - mark < lazy_min_bytes_) {
+                source_->parser->Expand(self);
+                self->source.reset();
             } else {
-                index++;
+                self->children_pending.store(HtmlElement::LAZY_PENDING, std::memory_order_relaxed);
             }
         }
-        
-        return index;
+
+        if (remaining_) MatchTargets(self);
+        if (callback_) callback_(self);
     }
 
-    size_t SkipUntil(size_t index, const char data) {
-        while (length_ > index) {
-            if (stream_[index] == data) {
-                return ++index;
+    /**
+     * scans the content of a skipped element up to its close tag.
+     * @return false when the data ended first, the element stays open
+     */
+    bool SkipContent(Frame &frame, bool final) {
+        const std::string &name = frame.self->name;
+        // raw text does not nest, a "<script" in a script is text
+        bool raw = HtmlTag::Lookup(name) & HTML_TAG_RAW_TEXT;
+        while (length_ > index_) {
+            const char *p = (const char *) memchr(stream_ + index_, '<', length_ - index_);
+            if (!p) {
+                index_ = length_;
+                return false;
+            }
+
+            index_ = p - stream_;
+            if (length_ < index_ + name.size() + 3) {
+                if (!final) return false;
+                index_ = length_;
+                return false;
+            }
+
+            bool closing = p[1] == '/';
+            const char *tag = p + (closing ? 2 : 1);
+            char next = tag[name.size()];
+            if (memcmp(tag, name.data(), name.size()) != 0) {
+                index_++;
+            } else if (closing && next == '>') {
+                if (frame.depth == 0) {
+                    if (frame.skip->mode == HTML_SKIP_RAW && !frame.shadow) AppendText(frame.self.get(), stream_ + frame.mark, p - stream_ - frame.mark);
+                    index_ += name.size() + 3;
+                    return true;
+                }
+
+                frame.depth--;
+                index_ += name.size() + 3;
+            } else if (!closing && !raw && (next == '>' || next == '/' || next == ' ' || next == '\t' ||
+                                    next == '\r' || next == '\n')) {
+                // a nested element of the same name, unless it closes itself
+                const char *end = (const char *) memchr(p, '>', length_ - index_);
+                if (!end) {
+                    if (final) index_ = length_;
+                    return false;
+                }
+
+                if (end[-1] != '/') frame.depth++;
+                index_ = end - stream_ + 1;
             } else {
-                index++;
+                index_++;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * drops the consumed prefix of the incremental buffer, so it holds the
+     * unparsed tail only instead of the whole document.
+     */
+    void Compact() {
+        // ATTR looks one byte back, raw text is copied from its start
+        size_t keep = index_ ? index_ - 1 : 0;
+        if (!stack_.empty() && stack_.back().state == PARSE_ELEMENT_VALUE &&
+            (stack_.back().skip || (stack_.back().self->flags & HTML_TAG_RAW_TEXT))) {
+            keep = std::min(keep, stack_.back().mark);
+        }
+
+        // amortized: only move a tail that is shorter than the dropped prefix
+        if (keep < 4096 || keep * 2 < buffer_.size()) return;
+
+        if (spans_) CountLines(base_ + keep);
+        buffer_.erase(0, keep);
+        base_ += keep;
+        index_ -= keep;
+        for (size_t i = 0; i < stack_.size(); i++) {
+            stack_[i].start = stack_[i].start > keep ? stack_[i].start - keep : 0;
+            stack_[i].mark = stack_[i].mark > keep ? stack_[i].mark - keep : 0;
+        }
+
+        if (close_at_ != std::string::npos) {
+            close_at_ = close_at_ >= keep ? close_at_ - keep : std::string::npos;
+            close_scan_ -= std::min(close_scan_, keep);
+        }
+    }
+
+    void SkipUntil(size_t index, const char *data) {
+        index_ = index;
+        skip_ = data;
+        skip_len_ = strlen(data);
+    }
+
+    /**
+     * continues a pending SkipUntil.
+     * @return false when the end of data was reached before the delimiter
+     */
+    bool SkipPending(bool final) {
+        size_t pos = Find(index_, skip_, skip_len_);
+        if (pos == std::string::npos) {
+            if (!final) {
+                // keep a delimiter split across chunks
+                if (length_ + 1 > index_ + skip_len_) index_ = length_ + 1 - skip_len_;
+                return false;
             }
+
+            index_ = length_;
+        } else {
+            index_ = pos + skip_len_;
+        }
+
+        skip_ = NULL;
+        if (span_open_) {
+            HtmlSourceSpan *span = span_open_->span.get();
+            span->inner_begin = span->inner_end = span->outer_end = base_ + index_;
+            span_open_.reset();
+        }
+        return true;
+    }
+
+    size_t Find(size_t index, const char *data, size_t len) const {
+        while (length_ >= index + len) {
+            const char *p = (const char *) memchr(stream_ + index, data[0], length_ - index - len + 1);
+            if (!p) break;
+
+            index = p - stream_;
+            if (memcmp(p, data, len) == 0) return index;
+            index++;
         }
-        
-        return index;
+
+        return std::string::npos;
+    }
+
+    char At(size_t index) const {
+        return index < length_ ? stream_[index] : '\0';
     }
 
 private:
     const char *stream_;
     size_t length_;
-    std::set<std::string> self_closing_tags_;
+    size_t index_;
+    const char *skip_;
+    size_t skip_len_;
+    bool done_;
+    bool feeding_;
+    std::string buffer_;
+    std::vector<Frame> stack_;
+    std::unordered_map<std::string, SkipRule> skip_tags_;
+    std::vector<HtmlSelectStep> targets_;
+    std::vector<char> matched_;
+    std::string boundary_;
+    bool stop_;
+    size_t stop_offset_;
+    size_t remaining_;
+    std::unordered_map<std::string, size_t> open_;  // names of the elements in content, for end tag recovery
+    size_t close_at_;       // the end tag whose name is in close_name_
+    size_t close_scan_;     // searched up to here for its '>'
+    size_t close_end_;
+    std::string close_name_;
+    bool close_cut_;
+    HtmlParseLimits limits_;
+    bool lazy_attributes_;
+    size_t lazy_depth_;
+    size_t lazy_min_bytes_;
+    shared_ptr<HtmlLazySource> source_;     // set while a lazy parse runs
+    std::vector<shared_ptr<HtmlElement> > spare_;
+    size_t floor_;          // stack size of the element Expand builds, 0 otherwise
+    bool spans_;
+    bool hashes_;
+    bool fingerprint_;
+    size_t minhash_;
+    size_t shingle_;
+    HtmlFingerprinter fingerprinter_;
+    const char *input_;     // what the spans point into
+    size_t base_;           // offset of stream_ in the input, Feed drops the parsed part
+    size_t line_;           // line of line_at_
+    size_t line_at_;        // lines are counted up to here
+    size_t line_start_;     // offset of the first byte of line_
+    shared_ptr<HtmlElement> span_open_;     // closed by "/", its span ends with the next '>'
+    size_t nodes_;
+    unsigned exceeded_;
+    HtmlEntityMode entities_;
+    HtmlStrictMode strict_;
+    size_t strict_error_;
+    ElementCallback callback_;
     shared_ptr<HtmlElement> root_;
 };
 
+inline void HtmlElement::ExpandChildren() {
+    Once(children_pending, LAZY_PENDING, LAZY_BUILDING, LAZY_BUILT, [this]() {
+        // the parser is shared by the document, other subtrees wait for it
+        // the copy keeps the lock alive when source is reset
+        shared_ptr<HtmlLazySource> lazy = source;
+        std::lock_guard<std::mutex> lock(lazy->mutex);
+        lazy->parser->Expand(shared_from_this());
+        source.reset();
+    });
+}
+
+inline size_t HtmlElement::SourceHeap(const HtmlLazySource &source) {
+    // with the control blocks of the source and its parser, see MemoryCounter
+    return sizeof(HtmlLazySource) + StringHeap(source.data) + sizeof(HtmlParser) +
+           2 * (sizeof(void *) + 2 * sizeof(long));
+}
+
+/**
+ * class HtmlParseSession
+ * a parse of a whole buffer done in steps, for callers that may not block
+ * for the time a large document takes. each Step reads up to a number of
+ * bytes or until a deadline and returns, all state stays in the parser so
+ * the next Step goes on where it stopped. data has to outlive the session,
+ * the parser is not used for anything else until the session is done.
+ *
+ *     HtmlParseSession session(parser, data, len);
+ *     while (!session.Step(steady_clock::now() + milliseconds(1))) { ... }
+ *     shared_ptr<HtmlDocument> doc = session.GetDocument();
+ */
+class HtmlParseSession {
+public:
+    HtmlParseSession(HtmlParser &parser, const char *data, size_t len)
+            : parser_(parser), size_(len), end_(0) {
+        parser_.Begin(data, len);
+        parser_.length_ = 0;
+    }
+
+    HtmlParseSession(HtmlParser &parser, const std::string &data)
+            : HtmlParseSession(parser, data.data(), data.size()) {}
+
+    /**
+     * reads up to bytes more of the input. a token that does not end in
+     * them is read by the following steps.
+     * @return true when the document is complete
+     */
+    bool Step(size_t bytes) {
+        if (doc_) return true;
+
+        end_ += std::min(bytes, size_ - end_);
+        parser_.length_ = end_;
+        if (end_ < size_) {
+            parser_.Run(false);
+            if (!parser_.done_ && !parser_.stop_) return false;
+        } else {
+            parser_.Run(true);
+        }
+
+        doc_ = parser_.End();
+        return true;
+    }
+
+    /**
+     * reads until the deadline passes, checked every slice bytes.
+     * @return true when the document is complete
+     */
+    bool Step(const std::chrono::steady_clock::time_point &deadline, size_t slice = 16 * 1024) {
+        while (!Step(slice)) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+        }
+
+        return true;
+    }
+
+    bool Done() const {
+        return doc_.get() != NULL;
+    }
+
+    /**
+     * @return bytes of the input read so far
+     */
+    size_t GetOffset() const {
+        return doc_ ? size_ : parser_.index_;
+    }
+
+    /**
+     * @return the document once Step returned true, null before
+     */
+    shared_ptr<HtmlDocument> GetDocument() const {
+        return doc_;
+    }
+
+private:
+    HtmlParser &parser_;
+    size_t size_;
+    size_t end_;        // the parser sees the input up to here
+    shared_ptr<HtmlDocument> doc_;
+};
+
 #endif
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Content-hash keyed cache of parsed documents for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_CACHE_HPP_
+#define HTMLPARSER_CACHE_HPP_
+
+#include "html_parser.hpp"
+
+#include <stdint.h>
+#include <list>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+/**
+ * class HtmlDocumentCache
+ * thread-safe LRU cache of parsed documents, bounded by memory and entry
+ * count. entries are found by a hash of the input with a seed drawn per
+ * process and keep a copy of the input, which a hit is compared with, so
+ * only byte-identical inputs share one immutable document.
+ */
+class HtmlDocumentCache {
+public:
+    struct Stats {
+        Stats()
+                : hits(0), misses(0), evictions(0), entries(0), bytes(0) {}
+
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+        size_t entries;
+        size_t bytes;       // HtmlDocument::MemoryUsage of the cached documents and their inputs
+    };
+
+    /**
+     * @param max_bytes memory bound of the cached documents and their inputs
+     * @param max_entries entry bound
+     * @param parser options and limits every document is parsed with, it is copied
+     */
+    HtmlDocumentCache(size_t max_bytes, size_t max_entries, const HtmlParser &parser = HtmlParser())
+            : max_bytes_(max_bytes), max_entries_(max_entries), seed_(Seed()), parser_(parser) {}
+
+    /**
+     * returns the cached document for this input, parsing it on a miss.
+     * documents larger than the memory bound are returned uncached.
+     */
+    shared_ptr<const HtmlDocument> Parse(const char *data, size_t len) {
+        Key key(Hash(data, len, seed_), len);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Index::iterator it = index_.find(key);
+            if (it != index_.end() && Same(*it->second, data, len)) {
+                stats_.hits++;
+                lru_.splice(lru_.begin(), lru_, it->second);
+                return it->second->doc;
+            }
+
+            stats_.misses++;
+        }
+
+        // parse outside the lock, a racing miss for the same page is harmless
+        HtmlParser parser(parser_);
+        shared_ptr<const HtmlDocument> doc = parser.Parse(data, len);
+        size_t bytes = doc->MemoryUsage().Total() + len;
+        if (bytes > max_bytes_ || max_entries_ == 0) return doc;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        Index::iterator it = index_.find(key);
+        if (it != index_.end()) {
+            // a colliding input stays uncached, the entry is kept
+            return Same(*it->second, data, len) ? it->second->doc : doc;
+        }
+
+        lru_.push_front(Entry(key, std::string(data, len), doc, bytes));
+        index_[key] = lru_.begin();
+        stats_.entries++;
+        stats_.bytes += bytes;
+
+        while (stats_.bytes > max_bytes_ || stats_.entries > max_entries_) {
+            Entry &victim = lru_.back();
+            stats_.bytes -= victim.bytes;
+            stats_.entries--;
+            stats_.evictions++;
+            index_.erase(victim.key);
+            lru_.pop_back();
+        }
+
+        return doc;
+    }
+
+    shared_ptr<const HtmlDocument> Parse(const std::string &data) {
+        return Parse(data.data(), data.size());
+    }
+
+    Stats GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index_.clear();
+        lru_.clear();
+        stats_.entries = 0;
+        stats_.bytes = 0;
+    }
+
+    /**
+     * MurmurHash64A, 8 bytes per step. it is not collision resistant, the
+     * cache compares the input on a hit.
+     */
+    static uint64_t Hash(const char *data, size_t len, uint64_t seed = 0x9747b28c) {
+        const uint64_t m = 0xc6a4a7935bd1e995ULL;
+        const int r = 47;
+        uint64_t h = seed ^ (len * m);
+
+        const char *end = data + (len & ~(size_t) 7);
+        for (const char *p = data; p != end; p += 8) {
+            uint64_t k;
+            memcpy(&k, p, 8);
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+
+        const unsigned char *tail = (const unsigned char *) end;
+        switch (len & 7) {
+            case 7: h ^= uint64_t(tail[6]) << 48;
+                // fall through
+            case 6: h ^= uint64_t(tail[5]) << 40;
+                // fall through
+            case 5: h ^= uint64_t(tail[4]) << 32;
+                // fall through
+            case 4: h ^= uint64_t(tail[3]) << 24;
+                // fall through
+            case 3: h ^= uint64_t(tail[2]) << 16;
+                // fall through
+            case 2: h ^= uint64_t(tail[1]) << 8;
+                // fall through
+            case 1: h ^= uint64_t(tail[0]);
+                h *= m;
+        }
+
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+
+private:
+    /**
+     * a seed per process, so colliding inputs can not be prepared in advance.
+     */
+    static uint64_t Seed() {
+        static const uint64_t seed = []() {
+            std::random_device random;
+            return (uint64_t(random()) << 32) ^ random();
+        }();
+        return seed;
+    }
+
+    struct Key {
+        Key(uint64_t h, size_t l)
+                : hash(h), len(l) {}
+
+        bool operator==(const Key &other) const {
+            return hash == other.hash && len == other.len;
+        }
+
+        uint64_t hash;
+        size_t len;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return (size_t) key.hash;
+        }
+    };
+
+    struct Entry {
+        Entry(const Key &k, const std::string &i, const shared_ptr<const HtmlDocument> &d, size_t b)
+                : key(k), input(i), doc(d), bytes(b) {}
+
+        Key key;
+        std::string input;
+        shared_ptr<const HtmlDocument> doc;
+        size_t bytes;
+    };
+
+    static bool Same(const Entry &entry, const char *data, size_t len) {
+        return entry.input.size() == len && memcmp(entry.input.data(), data, len) == 0;
+    }
+
+    typedef std::list<Entry> List;
+    typedef std::unordered_map<Key, List::iterator, KeyHash> Index;
+
+private:
+    size_t max_bytes_;
+    size_t max_entries_;
+    uint64_t seed_;
+    HtmlParser parser_;
+    List lru_;
+    Index index_;
+    Stats stats_;
+    mutable std::mutex mutex_;
+};
+
+#endif
@@ -0,0 +1,1608 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Charset sniffing and transcoding to utf-8 of the input of html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_CHARSET_HPP_
+#define HTMLPARSER_CHARSET_HPP_
+
+#include "html_parser.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+enum HtmlCharset {
+    HTML_CHARSET_UNKNOWN,       // sniffed from the input
+    HTML_CHARSET_UTF8,
+    HTML_CHARSET_UTF16LE,
+    HTML_CHARSET_UTF16BE,
+    HTML_CHARSET_WINDOWS_1252,  // also iso-8859-1 and ascii, as html5 reads them
+    HTML_CHARSET_GBK,           // code page 936, four byte gb18030 sequences are not decoded
+    HTML_CHARSET_BIG5,          // code page 950, without the hkscs extensions
+    HTML_CHARSET_SHIFT_JIS      // code page 932
+};
+
+/**
+ * class HtmlDecoder
+ * decodes input in any HtmlCharset to utf-8 in bounded chunks straight into
+ * an incremental HtmlParser. the charset is taken from a byte order mark,
+ * then the one given by the transport, then a <meta> in the first 1024
+ * bytes, else utf-8 when those bytes are valid utf-8 and windows-1252 when
+ * not. valid utf-8 is passed to the parser as it is, without a copy.
+ * malformed input is replaced by U+FFFD.
+ */
+class HtmlDecoder {
+public:
+    /**
+     * @param parser receives the utf-8 bytes through Feed
+     * @param charset the one the transport declares, e.g. Lookup(content-type charset)
+     * @param chunk size of the output buffer
+     */
+    explicit HtmlDecoder(HtmlParser &parser, HtmlCharset charset = HTML_CHARSET_UNKNOWN, size_t chunk = 64 * 1024)
+            : parser_(parser), given_(charset), charset_(HTML_CHARSET_UNKNOWN), out_(std::max<size_t>(chunk, 16)),
+              used_(0), carry_len_(0), replaced_(0), index_(NULL) {}
+
+    void Write(const char *data, size_t len) {
+        if (charset_ == HTML_CHARSET_UNKNOWN) {
+            // with a given charset only a byte order mark is looked for
+            size_t sniff = given_ == HTML_CHARSET_UNKNOWN ? 1024 : 3;
+            size_t take = std::min(len, sniff - head_.size());
+            head_.append(data, take);
+            data += take;
+            len -= take;
+            if (head_.size() < sniff) return;
+
+            Start();
+        }
+
+        Decode(data, len);
+    }
+
+    void Write(const std::string &data) {
+        Write(data.data(), data.size());
+    }
+
+    /**
+     * the input ended, an unfinished sequence is replaced.
+     */
+    void Close() {
+        if (charset_ == HTML_CHARSET_UNKNOWN) Start();
+        if (carry_len_) {
+            Replace();
+            carry_len_ = 0;
+        }
+        Flush();
+    }
+
+    /**
+     * @return HTML_CHARSET_UNKNOWN until the charset is decided
+     */
+    HtmlCharset GetCharset() const {
+        return charset_;
+    }
+
+    /**
+     * @return malformed sequences replaced by U+FFFD so far
+     */
+    size_t GetReplaced() const {
+        return replaced_;
+    }
+
+    /**
+     * the charset of an encoding label such as "Shift_JIS" or "latin1".
+     * @return HTML_CHARSET_UNKNOWN for a label that is not supported
+     */
+    static HtmlCharset Lookup(const std::string &label) {
+        static const struct {
+            const char *label;
+            HtmlCharset charset;
+        } labels[] = {
+            {"utf-8", HTML_CHARSET_UTF8}, {"utf8", HTML_CHARSET_UTF8}, {"unicode-1-1-utf-8", HTML_CHARSET_UTF8},
+            {"utf-16", HTML_CHARSET_UTF16LE}, {"utf-16le", HTML_CHARSET_UTF16LE}, {"utf-16be", HTML_CHARSET_UTF16BE},
+            {"windows-1252", HTML_CHARSET_WINDOWS_1252}, {"cp1252", HTML_CHARSET_WINDOWS_1252},
+            {"x-cp1252", HTML_CHARSET_WINDOWS_1252}, {"iso-8859-1", HTML_CHARSET_WINDOWS_1252},
+            {"iso8859-1", HTML_CHARSET_WINDOWS_1252}, {"iso_8859-1", HTML_CHARSET_WINDOWS_1252},
+            {"latin1", HTML_CHARSET_WINDOWS_1252}, {"l1", HTML_CHARSET_WINDOWS_1252},
+            {"ascii", HTML_CHARSET_WINDOWS_1252}, {"us-ascii", HTML_CHARSET_WINDOWS_1252},
+            {"cp819", HTML_CHARSET_WINDOWS_1252}, {"ibm819", HTML_CHARSET_WINDOWS_1252},
+            {"gbk", HTML_CHARSET_GBK}, {"gb2312", HTML_CHARSET_GBK}, {"gb18030", HTML_CHARSET_GBK},
+            {"x-gbk", HTML_CHARSET_GBK}, {"csgb2312", HTML_CHARSET_GBK}, {"chinese", HTML_CHARSET_GBK},
+            {"cp936", HTML_CHARSET_GBK}, {"ms936", HTML_CHARSET_GBK}, {"windows-936", HTML_CHARSET_GBK},
+            {"big5", HTML_CHARSET_BIG5}, {"cn-big5", HTML_CHARSET_BIG5},
+            {"csbig5", HTML_CHARSET_BIG5}, {"x-x-big5", HTML_CHARSET_BIG5}, {"cp950", HTML_CHARSET_BIG5},
+            {"shift_jis", HTML_CHARSET_SHIFT_JIS}, {"shift-jis", HTML_CHARSET_SHIFT_JIS},
+            {"sjis", HTML_CHARSET_SHIFT_JIS}, {"x-sjis", HTML_CHARSET_SHIFT_JIS},
+            {"ms_kanji", HTML_CHARSET_SHIFT_JIS}, {"csshiftjis", HTML_CHARSET_SHIFT_JIS},
+            {"windows-31j", HTML_CHARSET_SHIFT_JIS}, {"ms932", HTML_CHARSET_SHIFT_JIS},
+            {"cp932", HTML_CHARSET_SHIFT_JIS},
+        };
+
+        std::string::size_type begin = label.find_first_not_of(" \t\r\n\f");
+        if (begin == std::string::npos) return HTML_CHARSET_UNKNOWN;
+
+        std::string name = label.substr(begin, label.find_last_not_of(" \t\r\n\f") + 1 - begin);
+        for (size_t i = 0; i < name.size(); i++) name[i] = (char) tolower((unsigned char) name[i]);
+        for (size_t i = 0; i < sizeof(labels) / sizeof(labels[0]); i++) {
+            if (name == labels[i].label) return labels[i].charset;
+        }
+
+        return HTML_CHARSET_UNKNOWN;
+    }
+
+    /**
+     * the charset declared by <meta charset> or <meta http-equiv="content-type">
+     * in data, utf-16 declared there is read as utf-8 like html5 does.
+     * @return HTML_CHARSET_UNKNOWN when there is none
+     */
+    static HtmlCharset Sniff(const char *data, size_t len) {
+        const char *end = data + len;
+        const char *p = data;
+        while ((p = (const char *) memchr(p, '<', end - p)) != NULL) {
+            if (end - p >= 4 && memcmp(p, "<!--", 4) == 0) {
+                const char *close = p + 4;
+                while ((close = (const char *) memchr(close, '-', end - close)) != NULL &&
+                       (end - close < 3 || memcmp(close, "-->", 3) != 0)) {
+                    close++;
+                }
+                if (!close) break;
+                p = close + 3;
+                continue;
+            }
+
+            const char *gt = (const char *) memchr(p, '>', end - p);
+            if (!gt) break;
+
+            if (gt - p >= 6 && Lower(p + 1, 4) == "meta" && strchr(" \t\r\n\f/", p[5])) {
+                const char *last = gt[-1] == '/' ? gt - 1 : gt;
+                std::map<std::string, std::string> attribute;
+                HtmlParseLimits limits;
+                HtmlAttributeReader reader(limits);
+                reader.Read(p + 5, last - p - 5, attribute);
+                reader.End(attribute);
+
+                HtmlCharset charset = Declared(attribute);
+                if (charset == HTML_CHARSET_UTF16LE || charset == HTML_CHARSET_UTF16BE) return HTML_CHARSET_UTF8;
+                if (charset != HTML_CHARSET_UNKNOWN) return charset;
+            }
+
+            p = gt + 1;
+        }
+
+        return HTML_CHARSET_UNKNOWN;
+    }
+
+    /**
+     * @return the length of the longest valid utf-8 prefix of data
+     */
+    static size_t ValidUtf8(const char *data, size_t len) {
+        const unsigned char *begin = (const unsigned char *) data;
+        const unsigned char *end = begin + len;
+        const unsigned char *p = begin;
+        while (p < end) {
+            p = SkipAscii(p, end);
+            if (p == end) break;
+
+            int n = Utf8Sequence(p, end);
+            if (n <= 0) break;
+            p += n;
+        }
+
+        return p - begin;
+    }
+
+private:
+    void Start() {
+        const unsigned char *b = (const unsigned char *) head_.data();
+        size_t bom = 0;
+        if (head_.size() >= 3 && b[0] == 0xEF && b[1] == 0xBB && b[2] == 0xBF) {
+            charset_ = HTML_CHARSET_UTF8;
+            bom = 3;
+        } else if (head_.size() >= 2 && b[0] == 0xFF && b[1] == 0xFE) {
+            charset_ = HTML_CHARSET_UTF16LE;
+            bom = 2;
+        } else if (head_.size() >= 2 && b[0] == 0xFE && b[1] == 0xFF) {
+            charset_ = HTML_CHARSET_UTF16BE;
+            bom = 2;
+        } else if (given_ != HTML_CHARSET_UNKNOWN) {
+            charset_ = given_;
+        } else {
+            charset_ = Sniff(head_.data(), head_.size());
+        }
+
+        if (charset_ == HTML_CHARSET_UNKNOWN) {
+            // a sequence may be cut at the end of the window
+            size_t valid = ValidUtf8(head_.data(), head_.size());
+            bool utf8 = valid == head_.size() ||
+                        Utf8Sequence(b + valid, b + head_.size()) == 0;
+            charset_ = utf8 ? HTML_CHARSET_UTF8 : HTML_CHARSET_WINDOWS_1252;
+        }
+
+        index_ = Index(charset_);
+        std::string head;
+        head.swap(head_);
+        Decode(head.data() + bom, head.size() - bom);
+    }
+
+    void Decode(const char *data, size_t len) {
+        const unsigned char *p = (const unsigned char *) data;
+        const unsigned char *end = p + len;
+        while (carry_len_ && p < end) {
+            // no sequence is longer than carry_, it is decided once carry_ is full
+            size_t take = std::min<size_t>(end - p, sizeof(carry_) - carry_len_);
+            memcpy(carry_ + carry_len_, p, take);
+            size_t total = carry_len_ + take;
+            size_t used = Run(carry_, carry_ + total);
+            if (used >= carry_len_) {
+                p += used - carry_len_;
+                carry_len_ = 0;
+            } else {
+                memmove(carry_, carry_ + used, total - used);
+                carry_len_ = total - used;
+                p += take;
+            }
+        }
+
+        if (carry_len_) return;
+
+        p += Run(p, end);
+        memcpy(carry_, p, end - p);
+        carry_len_ = end - p;
+    }
+
+    /**
+     * decodes data up to a sequence cut at its end.
+     * @return bytes used
+     */
+    size_t Run(const unsigned char *begin, const unsigned char *end) {
+        switch (charset_) {
+            case HTML_CHARSET_UTF16LE:
+            case HTML_CHARSET_UTF16BE:
+                return DecodeUtf16(begin, end);
+            case HTML_CHARSET_WINDOWS_1252:
+                return DecodeWindows1252(begin, end);
+            case HTML_CHARSET_GBK:
+            case HTML_CHARSET_BIG5:
+            case HTML_CHARSET_SHIFT_JIS:
+                return DecodeDoubleByte(begin, end);
+            default:
+                return DecodeUtf8(begin, end);
+        }
+    }
+
+    /**
+     * valid runs go to the parser as they are.
+     */
+    size_t DecodeUtf8(const unsigned char *begin, const unsigned char *end) {
+        const unsigned char *p = begin;
+        const unsigned char *run = begin;
+        while (p < end) {
+            p = SkipAscii(p, end);
+            if (p == end) break;
+
+            int n = Utf8Sequence(p, end);
+            if (n > 0) {
+                p += n;
+                continue;
+            }
+
+            Pass(run, p - run);
+            if (n == 0) return p - begin;
+
+            Replace();
+            p -= n;
+            run = p;
+        }
+
+        Pass(run, end - run);
+        return end - begin;
+    }
+
+    size_t DecodeUtf16(const unsigned char *begin, const unsigned char *end) {
+        bool le = charset_ == HTML_CHARSET_UTF16LE;
+        const unsigned char *p = begin;
+        while (end - p >= 2) {
+            uint32_t unit = le ? (p[0] | p[1] << 8) : (p[0] << 8 | p[1]);
+            if (unit >= 0xD800 && unit <= 0xDBFF) {
+                if (end - p < 4) break;
+
+                uint32_t low = le ? (p[2] | p[3] << 8) : (p[2] << 8 | p[3]);
+                if (low >= 0xDC00 && low <= 0xDFFF) {
+                    Put(0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+                    p += 4;
+                    continue;
+                }
+            }
+
+            if (unit >= 0xD800 && unit <= 0xDFFF) {
+                Replace();
+            } else {
+                Put(unit);
+            }
+            p += 2;
+        }
+
+        return p - begin;
+    }
+
+    size_t DecodeWindows1252(const unsigned char *begin, const unsigned char *end) {
+        const unsigned char *p = begin;
+        while (p < end) {
+            const unsigned char *run = p;
+            p = SkipAscii(p, end);
+            Copy(run, p - run);
+            if (p == end) break;
+
+            Put(HtmlEntity::Numeric(*p++));
+        }
+
+        return end - begin;
+    }
+
+    /**
+     * gbk, big5 and shift_jis: ascii, a few single bytes and lead/trail
+     * pairs looked up in the index. an ascii trail of a bad pair is read again.
+     */
+    size_t DecodeDoubleByte(const unsigned char *begin, const unsigned char *end) {
+        const unsigned char *p = begin;
+        while (p < end) {
+            const unsigned char *run = p;
+            p = SkipAscii(p, end);
+            Copy(run, p - run);
+            if (p == end) break;
+
+            uint32_t single = Single(*p);
+            if (single == 0xFFFD) {
+                Replace();
+                p++;
+                continue;
+            } else if (single) {
+                Put(single);
+                p++;
+                continue;
+            }
+
+            if (end - p < 2) break;
+
+            int pointer = Pointer(p[0], p[1]);
+            uint32_t cp = pointer < 0 ? 0 : index_[pointer];
+            if (cp) {
+                Put(cp);
+                p += 2;
+            } else {
+                Replace();
+                p += p[1] < 0x80 ? 1 : 2;
+            }
+        }
+
+        return p - begin;
+    }
+
+    /**
+     * the code point of a single non-ascii byte, 0 when it leads a pair.
+     */
+    uint32_t Single(unsigned char b) const {
+        switch (charset_) {
+            case HTML_CHARSET_GBK:
+                return b == 0x80 ? 0x20AC : (b == 0xFF ? 0xFFFD : 0);
+            case HTML_CHARSET_BIG5:
+                return (b == 0x80 || b == 0xFF) ? 0xFFFD : 0;
+            default:
+                if (b == 0x80) return 0x80;
+                if (b >= 0xA1 && b <= 0xDF) return 0xFF61 + b - 0xA1;
+                return (b == 0xA0 || b >= 0xFD) ? 0xFFFD : 0;
+        }
+    }
+
+    /**
+     * @return index of the pair in index_, -1 when trail is out of range
+     */
+    int Pointer(unsigned char lead, unsigned char trail) const {
+        switch (charset_) {
+            case HTML_CHARSET_GBK:
+                if (trail < 0x40 || trail == 0x7F || trail == 0xFF) return -1;
+                return (lead - 0x81) * 190 + trail - (trail < 0x7F ? 0x40 : 0x41);
+            case HTML_CHARSET_BIG5:
+                if (trail < 0x40 || (trail > 0x7E && trail < 0xA1) || trail == 0xFF) return -1;
+                return (lead - 0x81) * 157 + trail - (trail < 0x7F ? 0x40 : 0x62);
+            default:
+                if (trail < 0x40 || trail == 0x7F || trail > 0xFC) return -1;
+                return (lead - (lead < 0xA0 ? 0x81 : 0xC1)) * 188 + trail - (trail < 0x7F ? 0x40 : 0x41);
+        }
+    }
+
+    /**
+     * the length of the valid sequence at p, 0 when p to end is the valid
+     * start of one and -n when its first n bytes can not start one.
+     */
+    static int Utf8Sequence(const unsigned char *p, const unsigned char *end) {
+        unsigned char c = p[0];
+        unsigned char lo = 0x80, hi = 0xBF;
+        int need;
+        if (c < 0x80) {
+            return 1;
+        } else if (c >= 0xC2 && c <= 0xDF) {
+            need = 1;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            need = 2;
+            if (c == 0xE0) lo = 0xA0;
+            if (c == 0xED) hi = 0x9F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            need = 3;
+            if (c == 0xF0) lo = 0x90;
+            if (c == 0xF4) hi = 0x8F;
+        } else {
+            return -1;
+        }
+
+        for (int i = 1; i <= need; i++) {
+            if (p + i == end) return 0;
+            if (p[i] < lo || p[i] > hi) return -i;
+            lo = 0x80;
+            hi = 0xBF;
+        }
+
+        return need + 1;
+    }
+
+    /**
+     * @return the first byte from p that is not ascii, or end
+     */
+    static const unsigned char *SkipAscii(const unsigned char *p, const unsigned char *end) {
+#if defined(__SSE2__)
+        while (end - p >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) p))) p += 16;
+#else
+        uint64_t word;
+        while (end - p >= 8 && (memcpy(&word, p, 8), !(word & 0x8080808080808080ULL))) p += 8;
+#endif
+        while (p < end && *p < 0x80) p++;
+        return p;
+    }
+
+    static std::string Lower(const char *data, size_t len) {
+        std::string s(data, len);
+        for (size_t i = 0; i < len; i++) s[i] = (char) tolower((unsigned char) s[i]);
+        return s;
+    }
+
+    static HtmlCharset Declared(const std::map<std::string, std::string> &attribute) {
+        std::string equiv;
+        std::string content;
+        std::map<std::string, std::string>::const_iterator it = attribute.begin();
+        for (; it != attribute.end(); ++it) {
+            std::string key = Lower(it->first.data(), it->first.size());
+            if (key == "charset") return Lookup(it->second);
+            if (key == "http-equiv") equiv = Lower(it->second.data(), it->second.size());
+            if (key == "content") content = Lower(it->second.data(), it->second.size());
+        }
+
+        if (equiv != "content-type") return HTML_CHARSET_UNKNOWN;
+
+        // "text/html; charset=gbk"
+        std::string::size_type p = content.find("charset");
+        if (p == std::string::npos) return HTML_CHARSET_UNKNOWN;
+
+        p = content.find_first_not_of(" \t\r\n\f", p + 7);
+        if (p == std::string::npos || content[p] != '=') return HTML_CHARSET_UNKNOWN;
+
+        p = content.find_first_not_of(" \t\r\n\f\"'", p + 1);
+        if (p == std::string::npos) return HTML_CHARSET_UNKNOWN;
+
+        return Lookup(content.substr(p, content.find_first_of(" \t\r\n\f\"';", p) - p));
+    }
+
+    void Pass(const unsigned char *data, size_t len) {
+        if (!len) return;
+
+        Flush();
+        parser_.Feed((const char *) data, len);
+    }
+
+    void Copy(const unsigned char *data, size_t len) {
+        while (len) {
+            if (used_ == out_.size()) Flush();
+            size_t n = std::min(len, out_.size() - used_);
+            memcpy(&out_[used_], data, n);
+            used_ += n;
+            data += n;
+            len -= n;
+        }
+    }
+
+    void Put(uint32_t cp) {
+        if (out_.size() - used_ < 4) Flush();
+
+        char *o = &out_[used_];
+        if (cp < 0x80) {
+            o[0] = (char) cp;
+            used_ += 1;
+        } else if (cp < 0x800) {
+            o[0] = (char) (0xC0 | (cp >> 6));
+            o[1] = (char) (0x80 | (cp & 0x3F));
+            used_ += 2;
+        } else if (cp < 0x10000) {
+            o[0] = (char) (0xE0 | (cp >> 12));
+            o[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+            o[2] = (char) (0x80 | (cp & 0x3F));
+            used_ += 3;
+        } else {
+            o[0] = (char) (0xF0 | (cp >> 18));
+            o[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+            o[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+            o[3] = (char) (0x80 | (cp & 0x3F));
+            used_ += 4;
+        }
+    }
+
+    void Replace() {
+        Put(0xFFFD);
+        replaced_++;
+    }
+
+    void Flush() {
+        if (used_) parser_.Feed(&out_[0], used_);
+        used_ = 0;
+    }
+
+    /**
+     * the index of a double byte charset, unpacked on first use.
+     */
+    static const unsigned short *Index(HtmlCharset charset) {
+        switch (charset) {
+            case HTML_CHARSET_GBK: {
+                static const std::vector<unsigned short> index = Unpack(GbkIndex(), 126 * 190);
+                return &index[0];
+            }
+            case HTML_CHARSET_BIG5: {
+                static const std::vector<unsigned short> index = Unpack(Big5Index(), 126 * 157);
+                return &index[0];
+            }
+            case HTML_CHARSET_SHIFT_JIS: {
+                static const std::vector<unsigned short> index = Unpack(ShiftJisIndex(), 60 * 188);
+                return &index[0];
+            }
+            default:
+                return NULL;
+        }
+    }
+
+    /**
+     * packed is generated from the code pages: "#n" is n + 1 pairs without
+     * a character, "!abc" a code point in base 85 and any other digit d
+     * the previous code point plus d + 1. digits run from '(' to '~'
+     * leaving out '?' and '\\'.
+     */
+    static std::vector<unsigned short> Unpack(const char *packed, size_t size) {
+        std::vector<unsigned short> index;
+        index.reserve(size);
+        unsigned cp = 0;
+        for (const char *p = packed; *p; p++) {
+            if (*p == '#') {
+                index.insert(index.end(), (size_t) Digit(*++p) + 1, 0);
+            } else if (*p == '!') {
+                cp = Digit(p[1]) * 85 * 85 + Digit(p[2]) * 85 + Digit(p[3]);
+                p += 3;
+                index.push_back((unsigned short) cp);
+            } else {
+                cp += Digit(*p) + 1;
+                index.push_back((unsigned short) cp);
+            }
+        }
+
+        index.resize(size);
+        return index;
+    }
+
+    static unsigned Digit(char c) {
+        return c - '(' - (c > '?') - (c > '\\');
+    }
+
+    static const char *GbkIndex() {
+        return
+            "!*jz)((0*,/(()**,()))),+(())+.+)*(.((()()(((((*)((((((((()(((((()*--()*((,.,((*)(((*((1+*()/((+)+()+"
+            "(()*+(())))((((((*(-((((-(+),(*((*)))))*(((()()(((((-))2(+))()(*(*)(((**((*((*))))()()(())()().)*((("
+            "()(((((((()((+((()((,((((*),))()+(+))((())(()((((((((((((*)())((+)())((*++(((((((((()))((()((*(()*(("
+            "(()((())((((((()((((()((((((((*(()(+((()()((()(((((((((((((((((((())+()(((()((((((*((((((((((((((((("
+            "()((((()(()((((((((((*(((+((())(((()(((((((((*(()((((()((((((((((((()((((((((((((((((((((((((((((+,*"
+            "))(()(+(())(((()()()(,*/+(+()(*(*((()(+)*(())*((((*(-+((+()(()*)*())(((((((())(*()((((())*()*.-(+)(*"
+            "(*((.)()(()((*)*)()(.)-((((()*(*())(((())()(())*((()()((((((((())*(((()(((((()()(((((()/(((.((+((((("
+            "((((*(()(()))((())(())((((()((()(((((((((()(((((((*((+(((*)((()*(((+*()(*)()(()(()(((((((((+(*))),(("
+            "*++())/*))(,+*)((()()+()+(((((()())())(***((()(((((()((()(()*((((.(()(),)((*(,4-+(()*)+0+(()-)(,-**("
+            "**))()())*((()0*(((())))(((((((+,(+())))(((*+)+(+)((((*0))*(()()),),(2)*,((((.(*((*((((()*))(((*)((("
+            "(+()((((()((()+()()),)(()((()*)*)(*(((()(((*(((()((()(,()+(((((,(*)-(-(())()((*(*)(((((()(((((((()))"
+            ")))*((((*(()(*((,)((((*)),)+()(*))((((**(((((*()*((((((()()(*((*()(((*((*))())(()(((((((((((+(((()(+"
+            "()(((())((-((()((()(((*(((((((*((((((*(()(((((((((((((()(((((((((()(((((()((()(((((((((((()(((((((()"
+            "()(*.)((((())(*(*((*(+((*)+(((((((((((((((()()(()(((+-()((((+()))((()().(((()(0()),))(()(*((*((((-(("
+            "(*((((*(((((()(((-*))*(())(()((((((((*(((((()(*()*(+()*(()((((((())((()((+()())((*(())(()(()(()((()*"
+            "()(((()(((()((()((((((((((((()((((((*(()()(()(((()((((()((((*(((((((((((((((()*))(()(((((((*((((*((*"
+            "(((((((*((((((((((((((((()((()(()(((((((((()(()((((((((((((()(((((*))()()()((((((())()(((())(((+(*)("
+            ")(((*)++)()(,)(((*)(+)(*)(-)(((())()((((((((((((*)*(()((,+)()(((*(*)((()(((+(,(*()((((())()(((((()(("
+            "*(((-(*)*(((())()(()((((((((((())(())/()((())((()(()(*())(()((((((*))(((()(()(((()(*((((((((()((()(("
+            "(((()((()()((((((((,()((()((((((((((((((((()((((((*((((((((((((()((((((*)()(((()(*((((()()(((())))(("
+            ")((*)()())(((()(((((((((((((((((((((()(((((((((((*((((((((((((((((((((((((())()((((((()((((((((((((("
+            "(*+/)(-(*)((*))((()()(*++*()(())0/((*((()(,*((+(),((()(()*((((((((+)(*()(((())((((((-())())(*((())(+"
+            "))*((()*)((()((()()((3()(,(,(()(()((()*)*((((((*)((((((*((()*(((()((*(*()/((((*(((()+(()))*((()))()("
+            "(((()((((()((((()(((((()(+))()()((((((((()(((((*(*((((()(((())((()()(((()*)((*(((()(((((((*((((((()("
+            "+(((((((((()())(((((((((()*()((()(((((((((((()((((((((((((((((((((()(()(((((((((((((((((((((((()(((("
+            "(((((((()(((((()(((((((((((()*(*(-)(*,()((((*(+*)(()(+(+.(((((((*((((*()((((*(+((()*((((()((((((*((("
+            "()()(*((((((((((((((+)),*(()*(*((+-*)+(((+(((()(((()-((()(((((((((*(((((+()((()((((((((((())(((((((("
+            ")*()((/(()*(())))*()((*(((+*()))((((((*)(()(((((((((((((()*,((()((*))(**(*)(())*((+*.(())()+()((()(("
+            "((())(*((((())(((*((((,()(*,((,(()(*()()(**()(()()()2(()(+()+()+(*((/(()(((()((((*()+(((((())())()(("
+            "*()(((+(/*()().)((*((()(*((()))((*)*()())(+)*)(()(*(((((((*((*(((()(()())**((((,.(*)(*((((*((()*((+("
+            "((()((()(((*(**(()(((((((((((((((((()((((((())))()(()(((((()((()(((*(((((()((())(((((((((((((((((()("
+            ")(((()((((((()((((((((+()((((((((()((((()(()(((()*((((*)(((((((((((((((()((((((((((((()(((((((()(((("
+            "())1(,*(()**((()))(((*()((((-)((+,(,(()()(((((()(*0()()()()+(()(((*(((((+,*((,*()(*((()(()(()+)()/+)"
+            "+/()(*-(,)**(((,*(((+((()()((()((*1()*(()()(((((*()(((**().((()(((((((*+(())((*()(((*(*((())(((,)+)("
+            "())(((((()*),+)(*(*)))(((())()((,)(()(((((()*)((((*()((())))(((),()((((*(*(*(((((*)*((()(()*((((()(("
+            "(()()))(-)(((((())(()(((()((((((())(()(((((((((+(((((()*)((((((((*(*()((()(((()((()(+)((()*))(())()("
+            "(((((*))(((*(((()(()))(((((((((((((((((((((((()((((((()((((((()(((()((((((((((()(((()(*(((+*)(*(((()"
+            "(*()())((*())*((*()(((*(()))()(((((((((((((()((*((*)(())*())(*))))*((((((()(*((),(((**()((*((((((())"
+            "(-(.(((*()(((()*()(())*((+(()(()*((()*((()))(+(((())())((((((*()(.()((())()))((((+(()*()(()(())()((("
+            ")((()(((*(((()((((((((*(((()(((()((()((()((((((((((((((((((((((((()+((((((()()((((()+())()+((((((,)("
+            ")((*)(()))((((()),))(*((()()()*()*(),)()((((),(()(+()**))((()*)()()))((()((()*)+((*)**)*(),((((((()*"
+            "(((((((((.((++))()(()()(+*((((((()*((().*))(*(((()(()((((((*((((((*((+(+/+))*+(((((((((2)((((((()*(("
+            "(((((())*((((((()(()(()((((((((()((+((()*())((((((((())((((()))((()()())(((()()((((((((()*(()((*)((("
+            ")(()(((()*))(((((((((((*(()((((((()()(()((()(())()(((((((((((((((()()()(*)()()((()()()((((+()(())),("
+            "()(((((*()(*(((((((((*())(()()()(()(((()((((((())))(()((((()((*((((((((((()((()((((((((())((((((((()"
+            "(((((((((((*((((())((((())((())(()((((((*(((()()((((((()((((((*)(((()(()(((((((((()(((((()()(()(()(("
+            "(((((()*(((()((((((()((((((()*(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((-()((((((((()((()*(()((()(*)()((((((((((()(((((((.()(((("
+            "((((((((()*(((,*+)(((*()((*(((()((((((()(((((((+)(((((()*()(((()))(.))(((()(((((((*(()(())(()(()(((("
+            "((+(((()+,,(()*)-((+)*()((()(+((**(((()((*)((/()((+(((())))()((*(+**()(*(*((())(())-+*(+(((*-(((*((*"
+            ")(()(-(()(),)()*(,),-()()()((*)(()((()+()((((())(*()(+)((),()),*+,(((*)))()()(*((*((()(*(()(((()()(*"
+            "())()+(((()-*.(*()()()(((((*((,((*((()((()*((**())(((*)())(())*((((((()((()+*()*()()(*+(())))())(())"
+            "(((((((*(((((((*(((*))()(()(((((((((()()((((((((((((((*(()*()((((*(((((()(()()()())()((()*)*(*)((*(("
+            "()(()(())+)()((-+*((((((((()((()((((((()(()()(((()((+((((((((()(()(((+))))()(((((()((((((*(())(((((("
+            "((()(())(()(()(((((*(())(()))(((((()((*(+(((((((((((()((()(((()(((((((((()()()((((())((((()((((((*(("
+            "(((((((()*(((((((((((*(((((((((((((((((((((((((((((((()(((((((*(((((()(((((((((((((((()(()(((((((((("
+            "((((((()()((((((((((((()(((((((((((+*(((*)(()+((()((*(()(()+()(*((((((((((((-))((++(,((())(((((((((("
+            "((*)(()(((),+)(((((())(()((((((((((*(((()()*+(((((((((()(((((((+((()((((((((((((()((()))(((((((((((("
+            "))(((()+(((()((*((())()((((()(((()((()((()((*((((*(((((()(()((((())(()(((((((()((((((((()((((*(((((("
+            "((()((())((((()((((((((()((((((((((()((((((((((((((((((((()((((((((()))((*((-)))((((((*((*((()(()())"
+            "))*((*)(((*()()((*((,()((((*))()((((((((((()(((((((((((**((),((((((,(()(((*))((())(#~#2!)eY((!(*5!(0"
+            "J!(0H!()}!)e])!)3^!1,1!)3`7!)3b(*(!)en(!)eb(((((((.(!)ej(!(*/NH!):+!)9s(!)9]!)9ZC!)9u!)9SW!)9f!);F!)"
+            "9q!)9l!)<_!);9!)9w*[!):B!):=!):2!)9il5(!):Z(!)9j>!):)!)G;!)G9!(*.!)3|(!)6M!1+,!()y!1-`(!)3z!()|!)6a!"
+            ")FU!)FT!)Ep+!)Es!)El!)Ek!)EE!)ED:!)EV!)4.!)81!)8/()!)em#~#2!)7f(((((((((#-!)B*(((((((((((((((((((!)A"
+            "m(((((((((((((((((((!)AX(((((((((#)!)k|(((((((((#)!)7U(((((((((((#~#4!1+)((!1-e!1+-((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!1-c#~#2!)fE((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#~#=5(((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((#~#:!(2i(((((((((((((((()((((((#//((((((((((("
+            "((((()((((((#.!1(^(*(,(!1(f(*(((#)!1(d(!1(`(!1(Y#()(#~#;!(4<(((((!(4-<(((((((((((((((((((((((((#6((("
+            "(((D!(4d(((((((((((((((((((((((((#4!(0K(5!)3])77!)6O+!)85(((!)9a1+W;(!);a!)DI((((((((((((((((((((((("
+            "((((((((((((5((((((((((((((+((O(M(((L!);5!)el2(#2!(+*!(*a!(-N!(*`[!(*iZ!(*hl!(*m!(-P!(*l!(+x!(*s!(-R"
+            "!(*r!(,@!(*z!(-T!(*y!(-V)))!(*|!(*j!(.}#(!(+o+#(!(/6#+!)h`((((((((((((((((((((((((((((((((((((#<!)e{"
+            "((((((((!)mT!)p@(4((*K1*(*!1(X!1-b)#(!)6l!)l6#(!)3Y#*!)hV!)gJ(!)hW(!)e`!)gL(!1(r((((((((()((()(((((("
+            "((((((()(((#4!)ea#4!)CN(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#6"
+            "!,-y()*(((((*(1(*+((())((((()(()((()+((,(*()((,)()()(+(((*(((((((((((()())((()((((((()((((((((((*)(#"
+            "~#0(((((((((((()(((()()))()()((()((()(()()((((())(+*(()(*((())((((+()+(((((()((())((()))(()((()((((#"
+            "~#0((((((((((()*(*(((*((((((((*((((()(*)))))(,(((()((()(((((((((((((((((()),*(((((((((((()()((((*((#"
+            "~#0((()*)(()(()())(((((((((())(((((((+((((((((((((((()(((((((((((((((((((((()(((((((()))+)((((((*((#"
+            "~#0()*(((((()((()((((((())))(((+)()(((()(*+-)**())((()()(**((()(((,(((((((*(()(((((())((*(((()(()()#"
+            "~#0((()(()*)**()++((((*0(*(+((,,()((()+)()()((++*(((*()((()()(+))((())(()((()+)((*)+(+)()(+()(()+()#"
+            "~#0(((((((*((((())(((())((()(((((()(()((((((()()*(())+()()())()()((((((((()(((((((()(*)((((((((()()!"
+            "+)t!-DT!+1D!+T`!+(Ld!+(=!,90!,8A!,g@!,=9!,_)!,@.!,+x!-EX!-HN!+pi!+<d!*pt!+T@!+_}!+A=!,YO!+e.!,XX!+^;"
+            "!,9o!*vu!+[9!,*G!,VE!,q5!*s+!+6<!+PU!+{L!,_Y!+U-!+R2!*|kc!,GU!*u:!,6C!+D|!+Sa!-*,!-H6!+Rl!,Vn!+02!-G"
+            "N!,Ta!,,(!,8s!+ca!,8t!+X(!*o=!-(0!+Si!,Df!+[v!,14!+We!+RT!,^,!-KC!+bf!,,8!+RO!+SX!*nW!,4+!*zr!*xp!,R"
+            "s!-2a!+Ea!+en!+i.!,[*!,Rz!+fe!,@h!,k;!-Af!*r]!,|.!,`4!,Y2!*z+!,rp!*x5!,9e*))(.)+()(()(((()(((((((**)"
+            "((*())()()(+))((((((((((*(((*)(()*(())((((,))((*)(()(((((((*(((((((*!,h2!-Fe!*pV!+2M!-N3!+<x!+S<!+S0"
+            "!+`D!,}.!-WS!,+L!+bU!,@2!+M;!*zy!*z=!-/A!,Xw!-((!->`!*q0!,-e!+53!+Mv!,(_!,q^!+6+!,`F!+ah!,Gx!+BZ!,SJ"
+            "!,4w!+s5!-+t!-0]m!-`Y!+oj!-4(!,Gd!+IZ!,@I!,f.!,gA!+ok+!+ol!+E2!+Fe!,7C!-CW!+[A!+H<!+JN!-/X!+4C!,[n!-"
+            "28!-Dq!-Ho!-/s!,Sj!-(7!+Qx!*p7!*|U!*{/!-/b()!-1]!+dC!+IH!,[C!,pp!-XG!+Ol!*wQ!,7u!+IJ!+[q!+{l!+y*!+=C"
+            "!+X*!*uEd!+cU!*k:!,Cm!-N>!+~M!,;S(((+*)(*((((((((((()((,((*(((((+(*(((((((((((*)())*)(()())(((()))(("
+            "(((((((((()(((((((()((*((((*!,6e!+FS!,0X!,c7!+Y:!+Su!->t!+ry!*{+!*y>!+WG!-@*!,I8!*nR!+EM!,^6!,Yl!,[4"
+            "!+vg!+ra!-Q6!+U6!*{-!+(y!,pm!+1b!*k.!+E4!+nO!,K9!-3M!+KJ!+Yu!,.d!,qt!+b5!+R-!-(-!,;c!-+5!-6,!+IG!,c3"
+            "!,f{!-L~!*|>!,kE!+nv!+Mx!+Ms!+}o!,_z!,^1!*mK!+r<!,i(!+Y[!,M)!+j:!+a3!,aK!*{h!,HP!*ov!*u]!+t6!+>s!-+{"
+            "!+V`!*|F!,a-1!+cw!,@V!+Wv!+=e!+@p!+Dv!,{G!+SR!+d/!,}/!+W7!+VG!,mO!-NN!,{x!,St!-@[!*lu!-C{!-Kg!+^F!,."
+            "^!,=1)),((()())(((.((((()(*((*)+)*)(()+)(*()(()(.))((())((())))(+(((()(((((((((((-((((((()((()(((((("
+            "!+/f!+>M!+Ek!-B=!*rN!,XJ!*{T!+[B!,58!+)Z!*qE!-);!+Rf!->]!+aX!+,]!+z]!+Dj!*}^!+~+!-.u!+RP!+Y1!+V/!+IY"
+            "!+zw!-3Y!,]8!-/j!+>H!+_M!+J{!+qu!-D^!-)7!,pt!+Xu!,D=!+1O!+kB!+QF!*}q!*k{!,DY!+Mt!+zs!,{9!+Ra!-1,!-QO"
+            "!,D1!*}*!,7=!+T7!*z@!+qK!-0C!+HN!-Q3!,W9!-aH!*oV!+>k!-(q!,Uo!+]3!+~W!*tk!*v,!,jq!+B7!+<{!+SI!-4}!,5i"
+            "!-*o!,Do!+N5!,Ht!*m>!,SK!,;|!*k2!,]C!*wC!*vv!+kZ!*{{!-,>!-@n!-F9!+xY!-Dz!+hB!,>|(())(+())((*+()))))("
+            "((((((-((()((()()(()((+((()((*(()((((((((((((()(()(((())()()((((()(()((((((!,>6!*rx!,<y!+WH!,uD!+50!"
+            "+Vq!+De!,Ey!+g{!*nC!,^9!+*m!*kT!,6M!,F:!+F>P!-CY!*wA!*}b!+}z!+UX!-A7!+0X!+^`!+g}!-5B!+)/!+v4!,RW!,p("
+            "!+Qj!,SC!,6T!,a)!,@d!-F6!-/W!+N~!,4@!,{,!+nN!*wa!-(]!+ma!,Wj!,du!+.r!*z,!*mF!*k<!*vL!,L<!-5F!,JW!*p;"
+            "!-,6!,J0!,F@!+XJ!+BE!*r|!,Y[!,7K!,L`!+v-!,V3!+b6!+<1!+=~!,@n!+Y;!+WK!+V6!+Tc!-A,!+Wf!-/x!,HN!,7t!+R3"
+            "!+5T!*}o!+nd!*rs!+Qk!+EX!+nq!*m[!-(C!,q<!+Id!-1<!,AZ((((()((((((((()(((()(((((((((((((()((((+)*((()*"
+            "(((((((()(*(/)()*((())((((((*)((((*(*((()((()((!+KT!,W;!+SQ!*k[!*z}!-3^!+VE!,Xq!+]v!+po!*nj!+My!+uy!"
+            ",{=!+Hm!,k|!+I0!+TX!*u)!,ad!+eJ!*v|!+UE!-+U!*q5!+@w!,Bp!+>+!*wV!,E3!+MF!-1c!,9x!+J@!+Iv!,8z!-+z!+}_!"
+            ",8q!,HC!,<K!*vo!-2M!+2P!*nr!+y6!-0N!+[/!,Gk!,-a!+u:!,V2!+:f!+SA!+Fs!+/[!,e/!,G|!+EO!+HR!-0w!,Sh!-Kc!"
+            "+Ue!+x`!,@9!+~S!*uH!-Gr!+1+!,5(!*ng!,5+!+Fu!+Mq!+67!+uW!+oT!,@*!*|z!-F@!*vF_!+Ul!*}1!->Q!,{d!-*-!,,)"
+            "!,@A!,m}!-0Q!,{n!*|^!,C5(((((()((((((((((()(((((((((()((((+**)()()))((*()()((((()((**)))*(((((()())("
+            ")*()((()*(((()()()(!*jy!,:9!*|l!->G!-K7!-`+!-AA!+<u!,zW!*kD!*k=!*u}!,dg!+PM!*xz!+dG!*of!+LJ!*v5!+s`!"
+            "*u+!+Rx!+[|!-Dw!,|Q!-0|!,6x!-3c!,;Y!+oh!,,|!,.2!,{[!+2b!,;p!-(X!+bB!-AT!,XD!+G-!+vd!+6k!,G=!,=8!-AO!"
+            "+oJ!+];!,Sb!+21!*tw!-D3!+>(!+4*!*}P!-,)!+[J!-KA!+.e!->[!,:I!-1P!+Uj!+(D!+5GH!+0r!-,k!+aq!-*]!,^5!*wh"
+            "!+M{!+2A!,lY!+Ao!-]c!*p<!-K`!,zo!+8S!+LU!*{V!+R^!-1_!-3h!-NB!+LH!,Va!*te!,W1!+>D!-N7!+ss!*lY!,Dl))()"
+            "(((((((((((((()(())+)((((()((((((((()(((()((((((((((((((((((((((()(()-(((+*))((()((*(,((**(!-(;!*|N!"
+            ",TX!,HI!*n2!*kr!-Ck!+rl!,0n!,iC!+E7!,5_!,VO!+jH!,=J!->P!,Q=!*v]!,(*!*|J!-07!,`Z!-(4!,-K!-N/!+rr!+/v!"
+            ",_`!+]H!,XT!+Qv!-DG!+7*!*mx!,zu!,Rc!+Zx!,cJ!-Gu!+*4!-LK!,XO!*zQ!,{^!*}H!,Xe!+F}!+rN!-(E!,_X!-4k!*}Q!"
+            "+p[!*w+!,R`!+04!,(`!+qj!,L.!+5y!*mv!+K2!+NY!,LP!*kR!+>0!+c;!,l^!+Aw!-@u!-L:!,6N!,(B!-10!*v)!,Sq!,zs!"
+            "+5w!*v`!*o(!*}N!+5X!+[[!,XN!+<O!+RWu!-/I!+Ex!+p`!,Gv!*n1!*pQ!+aH!,FG(*)((*(((()(((((((((()(((((((((("
+            ")((((((((()()(((+()*((((())((((((((*())((*))*(())(*(())())((+)+!+tZe!,C1!,qd!+HJ!,4u!+R|!-/=!*pi!-6B"
+            "!+]5!,Z.J!+Fz!,ZP!-)*!*x@!,t8!-(W!+59!*rT!*mP!-D0!,+}!,Zz!-(*!+=Q!,zX!-DY!+6`!,Sn!*~d!+-K!+,7!,{E!+Z"
+            "s!+hk!->W!,9w!+ww!+FO!,4b!+b+!+cc!,GN!,XG!-),!+NT!,Cj!+[F!-(p!*uX!*w@!->a!,T5!,XE!,RZ!+@s!+vr!+bF!,J"
+            "(!,9*!-RG!,[9!,U<!,L|!+WV!-Ae!,E7!*}s!+(d!+n5!+W8!+Q=!-]Z!,YH!,67!*xC!-H)!,d_!+dy!,l>!-Cl!-ET!-@U!*k"
+            "L!*}+!,S+!+dv!-*A!,Vj!+a.!+Fx!,Uc!,H(())((())))((((()))*(,)))*)())(((((((((()(*())))())((()(((((()()"
+            "((*)(((*((*((0(()()(()((((((()((!+1C!,W=!+f(!+Dm!+Zu!*xq!+LL!-ad!*oj!-,e!*u;!+=/!+HF!+Dq!+qI!+S~!-(,"
+            "!*uA!->h!*y{!+r4!,`5!,-t!+0y!+bk!-(8!+5L!-/U!,bu!*~i!,I1!*nS!+rS!+<=!+7T!-`0!*|b!,k{!-Qm!,|B!,XK!+[("
+            "!-K@!+.{!-F1!*wT!,3{!*ww!+=g!+T8!,r`!*ky!+S]!+K_!+g6!*uC!+<s!*uq!,tv!,IF!-NI!,TN!+Mz!+}:!-(:!*to!+F]"
+            "!-1)!,2d!,tx!+/X!,>;!+I/!-ai!-Ce!-.w!-SV!,{A!,8n!+e(!+cn!-*L!-(A!*wd!-/C!+xs!+f`!-@o!-3R!+.~!+c,!,rV"
+            "!-0*!+(F!,Ik*((()((())((((*()(()((*(()(()()(((()((())((((((()((*()((((()((((((()(((((*()(((((((((((("
+            ")(((((+!-Q}!+<C!+td!+pg!*ls!+=7!-QK!-4t!+P2!-2j!-IU!*}S!+uL!+=W!*vy!+*_!,TS!,VD!+YJ!+U.!+^*!+PI!+Lm!"
+            ",(O!+qB!+q3!+5]!+bS!,^*!+4W!+-d!,|v!+p*!-3B!+6U!,Vl!*|u!+tU!*~H!+*r!,az!,b}!+du!,Cb!*~`!*ny!*}/!,9s!"
+            ",}>!-Cm!+rI!+uO!-(x!,rn!-^+!-(F!+,j!-_D!,6u!+Ig!,-}!+LG!+({!*lv!+ji!,pi!+L0!-/(!+(B!+~s!,k(!-]]!+sl!"
+            "+<j!+HK!,RJ!+*^!*o~!,.|!*}e!*{m!*q<!*}5!*~O!*kq!+K0!,2M!+4y!,do!,Y5!,m{!,-m!,Lq!+wC!,K=((((((((()((("
+            "(((((((((((((((((((((((((((((((((*(((((+(((((((((()((((((*()*((,()*((()(()(+(((()(!+HZ!,jS!+)U!+S/!*"
+            "l`!+r@!+Qn!,_^!+(U!*zv!,//!+xj!,5.!*w7!*z<!,{<!+id!+Ii!+K3!+v/!+/{!+mb!,0L!+e9!-0;!,Sg!+UD!+M,!+)M!,"
+            "73!,|n!,(Z!+u9!+=*!+FX!,aT!+O+!-_6!,AG!,m^!,Jx!,8}!*vl!+N*!,);!+^~!+F(!+L+!,{o!+}`!+T]!-/B!+JF!+LA!,"
+            "l.!+._!+oV!+Lt!+OG!*zq!+Mk!+_K!-(K!,DK!*n<!,(-!+q1!,zih!,S*!,ag!+^I!+92!-S]!+t<!+v8!,|L!+s}!*n;!+}Z!"
+            ",be!+QL!+M[!-Fy!-(2!,Bq!*vw!+/j!+1|!+av!,5m!,E5!,D<!,I9!,Lf()(()*)*((((((+)()(*(((((()((((()((((((()"
+            "()((((((((((((()(((((((((((((((((((())((()(()(()((((((!,X5!-M~!-0^!+{Y!,zZ!-]=!+7p!,S;H!*}0!+bh!+fk!"
+            "-/J!,KH!-F0!*|G!+KY!,6^!+q^!*{E!+:M!,RO!+T[!*v[!,Y`!+Dy!,f7!+Rb!*uP!+<<!*n0!,Bf!*wi!+MB!+t9!+=I!+=G!"
+            ",zV6!+]r!+JU!-DZ!+6l!,S9!,RR!+,2!+cH!+5g!*oA!+=:!*xr!,a]!-KL!-(J!,4|!->}!*ql!,E4!*mp!+cG!-QB!+:E!+ng"
+            "!,9r!+0/!+>F!,H3!-C_!,)=!*uL!,XS!,^r!+6P!,SW!,a(!+fR!+c~!,@S!,>o!+Sp!+UC!,H{!*pg!*x:!*vJ!,aR!+io!-8/"
+            "!-*W!-(<!,tu!-AB!,IR!*mo!,N2(((((((((((((((((((((((((((((((((((((((((((((((((((((()((((((()((((((((("
+            "(((((((((((((((((((((((!*r3!,^0!*wx!-N1!+vR!+ws!+u=!+H,!*sp!+7`!+>5!+t1!+qJ!,5{!,e8!+eO!+6-!,zh!*zG!"
+            "-5+!-Dc!,gM!+gO!,AN!,(l!,YK!*lr!-3.!+t2!-QH!+84!+.;!+W<!-@Y!,=6!*ot!,Yp!,-~!,u/!-N<!,T1!,S0!*xP!+[<!"
+            "-5/!-/7+!*|i!,F9!+V{!+V1!,8|!,DF!,p_!-DK!+Qa!*x}!,_-!+e:!+bV!+UY!,;b!,G;!+sB!,R|!,uA!+7S!+QH!,hy!,_Q"
+            "!,5@!*qC!*mC!,6D!,{K!+>{!+E/!,HE!+]2!-66!*mB!+sg!,sh!,My!-A9!*m<!,|2!-0>!-H3!+_/!,Bz!-04!,(0!+te!,O@"
+            "(((((((((((()(((((()(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!+>n!"
+            "*y-!,aH!*u1!,`f!,;Q!+_[!-X(!*lz!+MT!,Le!,LY!,Rx!*lc!,yq!+_T!-KJ!-Gp!+3Z!+[P!-Aq!+Ic!,6i!-Gm!,G-!,G,!"
+            "*v:!+~I!,F;!+Vx!,Ep!,RH!,02!-IY!*kh!+}h!*l)!-4c!*{|!+[4!+]w!,]R0!*~b!+>b!,68!-Hb!+Se!,-v!,6]!+>v!-Q<"
+            "!,bx!+>q!*~S!,=4!*ka!+rD!,WY!+S_!+UP!+Dp!*uG!-*>j!-AC!*pk!*|c!+Mr!+~F!*x7!+U1!-]a!+8M!*qJ!,;,!*{I!,S"
+            "4!+Xi!+Ze!+Rk!+U{!*q7!,+|!,t}!*v-!,zv!,S/!+/s!,bz!->f!*ul!*}C!+B+!,PM((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((()(((()(((()(((((((((((((((((((((!*pC!,G1!+tF!-3F!-QS!+*T!*~j!*{2!+(,"
+            "!+H2!+Vw!+h`!*vk!+OH!*w/!+2V!*yT!+/z!,=Y!,:V!+G>!+OW!,M0!+R;e!*lp!+~.!,VW!+T-!,((!-Gw!+0M!,`1!+d*!+g"
+            "1!,@x!-KY!,Cu!+4v!+(0!*|m!+vw!*tq!*wb!+<}!,{_!,XY!+)m!+0}!+LR!+/}!*}U!,Et!+L.!+<-!+V3!+S+!*|a!+RD!+="
+            "L!+c@!+(l!,FC!,`<!-51!+Fq!,rA!+5f!+1.!+TE!-*J!,YD!+0,!,Hr!*ox!+Ju!+=B!+m~!*zH!,HJ!,-_!+e,!,=K!,;+!+^"
+            "0!*v/!*l]!,9u!+AE!,FI!,dy!+5|!-S[!*rO!,Q[((((((((((((((((((((((((((((((((((()((((((((((((((((((((((("
+            ")((7-.(B5/48-5A))(((((()*(((((((((*(!-NK!+N]!+wq!+09!+^@!+T~!+.q!+Sy!+RJ!+G[!-D(!+0Y!+SU!+*[!,l}!,ZJ"
+            "!-/]!+*9!,b_!+bK!-(c!,f5!+9C!+dK!+Ss!,J=!-C|!*u@!+{4!,|:!+W4!,t|!+P^!,SY!+~]!+x~!,1M!+h}!,.C!+GR!-32"
+            "!+aR!+tV!+U@!*y.!,,S!,VU!*o9!+7i!-4{!+~t!+u3!*yN!*ks!-Fc!-B+!,h,!,@m!,N*!*tF!+0i!+YP!,X4!,Kw!+s*!+g-"
+            "!+hF!*v1!*{k!+f9!,,s!-_A!,JA!,.>!,C_!+yV!,1N!+b3!-61!-Wk!,B3!,b5!,aV!*}6!+dS!*k`!*{[!*y,!,>4!*{X!*wO"
+            "!*rW!*oYn!,TT*)((()*((((+(()(*)((()((()()((((((()))(((()(((()(+)()()((((((*)((((*(*))(()((()))((((*("
+            ")(((((+(!,7+!,Fp!,L7!+r:!-Ew!*xm!,2w!+(h!*pc!,WS!,b`!-0B!-B.!+GQ!+KP!+u5!+EJ!+[>!,Z7!-@h!+L)!+~V!,Rl"
+            "!,LT!*vD!+ei!,LW!,^q!*kF!-/>!-64!+_d!*l|!,{f!+Y6!,WI!*sT!,65!,*j!+=k!-/w!+zT!*lS!+Xf!-Ax!+G_!+[~!*w<"
+            "!,qu!+~c!*xu!,.U!,1|!+b~!,AD!-G+!*kV!-2v!-XO!+uc!*vV!-(M!*}E!+SZ!,0O!,cI!-Fb!-aM!-@+!*nY!,UC!*vG!+}e"
+            "!-E4!+A2!-KH!*|d!*m]!+x3!,1Q!+iG!,>c!-NR!,5M!*w=!,7o!+t,!+d.!*u<!-ac!,WJ!*~m!,H5!,Fd!,V7*()((()*)((("
+            "(((*((*,(((+()).()(())(.((((()),()))(*()((,((())(())(((((((((((((*((((()(((((((((((!-EF!+0Z!+So!-D]!"
+            "+he!+81!+W9!,Iy!+yR!-Da!,_R!*{3!-KG!+Fn!+}y!+V@!*{5!,jT!-WG!-^[!,@-!-GH!-*Q!-(N!-^G!+zL!,B}!+I2!-D[!"
+            "+Qe!-Q7!*}<!-@F!*or!+]T!+@@!+@;!,Si!,jV!+pp!+Ij!,/z!+x}!,SR!+Am!+TR!+<D!+y(!*{G!*l=!+V,!,5Y!+S,!-.}!"
+            "*nI!*mI!+r;!,R_!,zp!,cv!,nl!,TU!-1J!-A6!,IN!-Qf!,rU!,d@!+s]!-QJ!,S.!+6a!-_-!,07!,=M!,k1!-Q/=!+,E!*}>"
+            "!+1L!*l<!-^o!*z~!-0+!,Y_!,<2!-NU!,lI!+xz!,fm!+a6!+OB!+yo!,W~*(**)*((((()()),,*((++*)()()1)((((+((((("
+            "(*.()(*/.)))*((()(()(*(0)))(()(((((((((((()()*(())(((()!,|3!,_=!,a,!,:<!+pS!+Jc!,bk!,.s!,`]!-A-!+oq!"
+            ",<}!-@.!*{A!,`Y!*uc!+Ep!,}B!-(D!*kk!,0H!+c*!+em!-50!-Fu!,)T!+r6!,:T!+9l!-AU!+oe!,U6!+^b!+=U!+7;!+9t!"
+            "-CR6!*me!,ce!,eG!+l@!,:)!-AD!,.c!+f7!+<8!,:{!-5U!-Gx!,M,!-0[!,{}!+HX!,Ko!,C|!,ty!+rc!,lx!+=K!+Eu!+f["
+            "!,:l!,SH!*uf!*ts!*yE!+8W!,SX!-Gy!,`-!+V]!,;{!,i)!,Cv!+v}!+Fw!+6r!,fk!+}]!+pQ!+SK!,9`!+[2!+M8!-Ch!+^H"
+            "!,nP!-]@!-@V!*}4!*~P!,|6!+X[!,Z@((((())+((*+((*(((()((()))((**()(((0)(((())((())((((()(+(((()()))((("
+            "(((()(((((*(((,()(())((((((!+X]!,il!+j`!,[G!,A4!+XL!-So!+SE!+ag!,bX!+4)!-_K!+rA!+yd!+=d!-Db!,{l!,,P!"
+            "+cb!+SS!,,R!*lw!+7I!+oc!+3k!+`=!+F1!*y[!+O4!+ad!,:8!,;]!,,X!,E>!+T5!+(i!*}y!->_!-2^!+8J!,R[!+pV!*kf!"
+            "+6N!,Ve!+5v!*{(!,5*!-F(!+.J!+TW!,Yg!+L[!-Cd!+un!*~4!-ND!*uU!+:n!,YR!+70!-G(!*qN!+r|!+>m!+Sl!*o-!*zg!"
+            ",Z|!-0k!+xR!,g.!+ST!+FQ!,@a!+YC!+U^!+K(!+8F!-59!-];!+>p!+U0!,WA!+<W!+*B!-A_*!+tr!+M1!+cr!,-{!*vX!+<["
+            "!,])(((((((((((((()(()()*((((*(((((*)++((((*()))(((((**+(((),+/)()(((()()))(()((((((())((()((((((()!"
+            "+St!+ru!,,L!+RN!->m!,Rf!,Yi!+t>!*um!+H6!+6L!*x|!+KF!+6K!+_|!,jU!,6=!+Tb!+Pr!,M@!,{Z!+(e!+mg!-]B!+oI!"
+            ",i.!*}~!*rE!+r9!+*=!-)l!,+s!+EG!+KI!,2(!+SY!+Uu!,,<!+Iw!+w/!+t)!+Z8!+zF!,9y!,@s!,:G!,5H!*wJ!*|X!*kv!"
+            "+F|!+]P!,W(!,Y*!+R}!*~Y!*wN!+~H!,q>!-*2!+rx!*~K!,Y.!+1{!,rQ!-(a!-E)!-4^!*o6!+r0!++5!,9g!,=}!+S3!,(=!"
+            "+z}!+IK!,fE!+fm!,>t!,JG!,[S!+aF!-]m!+UI!,@R!+0E!,=_!-GO!+RZZ!*xY!,1~!+om!,^l(((++(((*(+())(()*+*(((+"
+            "(*))(+2*(+((*()()(*.-*(*,,((()(())()()))((((1()*)(*)(+(((((((((*(+)),+)!+*7!,Z=!,6Q!,9N!*za!,6~!*sv!"
+            "+>r!,yw!,Im!*qt!,,7!-Q[!-LE!+yE!,4*!,Ba!+Xk!,<F!+T2!-KS!-(6!+(>!,WW!*ku!+0@!,`P!,cf!+FP!*vi!,4>!,zz!"
+            "+@)!+06!+s<!-KI!+8u!,>*!-S_!-0O!,L:!*w}!+R1!-@d!*m=!,b2!,de!,cA!,ea!+1U!+ap!+/-!+_S!+tR!,|;!+`n!+|U!"
+            "+aZ!+mz!+dR!+QP!+7=!*j{!*v>!+yI!+cd!+q{!*uF!+f^!+5u!+nQ!,5Z!+B>!,Yf!-`o!+]g!,B@!,B8!-QU!-)-!+@^!*l*!"
+            "*mz!*}W!+6(!,=X!+-<!+pT!-/~!+H5!+qi!+rz!,za!+Us!,a@()()(*)((((,)((((+,5((((((*(+((((((*()((()((*((()"
+            "(*))((((((,(((--*(*(())())()((()))((*+(()((*((!+LO!+t(!,,g!+RG!->L`!*zk!-/{!,Hy!*mW!,|0!*lK!-_G!->p)"
+            "!*wt!+zJ!-1s!+t0!,|>!+2<!+B~!+m`Q!+c:!*~-!,ZT!,U4!+3q!,g:!+Hn!+S-!+k/!-AM!+[V!+Ld!+eL!,<H!*kw!*ow!+D"
+            "o!-HY!+Y9!,V+!+At!*pH!,F0!*w,!,`[!*k5!+Kd!,E}!->e!*p-!*m)!,D3!,1}!*ya!,_f!+Ya!,Ca!+=c!+qm!-Gi!-/3!+p"
+            "c!*qc!*{Q!+vG!+Y]!+_Y!+pq!+MO!-K8!,{W!+Fd!,2.!,Eq!,Co!*k9!-2l!,1K!+q,!+.Z!-4[!+r[!-)B!*zb!,kw!+a,!-,"
+            "h!+>y!-Q4!+vc!,cF(+((((*(()(()*)(((-)((((()((*(((((-((((((()((((()((*((((((()((((((((()((((),((())(("
+            "(()+(())*))(!*|S!+8e!-aT!-)Z!*|7!+/2!-Kj!+b(!-5V!+r`!*u7!,6j!+T)!,-H!*w_!*xo!,T7!+~-!,8,!*{F!-]h!+iJ"
+            "!,>f!-F*!,r5!,UM!,(|!,*_!*uY!+ce!,4,!+4g!+ZQ!+.6!,z_!-N8!+RQ!,R~!+N-!,(1!+4o!*m8!*m1!+JV!-IS!*mt!,zY"
+            "!*w(!+6c!,RS!+R4!*mE!+]u!+QD!,a9!,ex!,af!,n=!,*.!+xN!+==!,R{!*uh!+VV!+cf!,X2!,a:!,or!*t6!+<T!+6Z!-/k"
+            "!*l@!+qH!*u4!,s,!-.~!-DC!,gN!,2Q!-@z!-CZ!+u<!,`;!+He!+Xv!+sS!,d*!,Zo!-X3!+34!-(h!*k*!*|=!,e*(((()((("
+            "+*)((((((())()((()(((((((((((()())((+()))()(((*()(*)()((((()*()*(((()(()(((((((((()()((!*nA!+[G!+e7!"
+            "++R!*kI!+WL!-Q_!+RL!+:F!,2R!,^t!+u@!+g*!*sb!,b:!,=N!+a|!*w`!+r.!,RY!*s4!+*8!,)N!,HU!+_6!,0h!,`B!+b.!"
+            "+@L!*wF!,)n!,ps!-CT!-Dk!+YS!-(n!,[_!+*X!+q@!+Q~!,T+!+3j!*nG!+)p!-([!+_0!*k+!+>J!,rP!+f3!+U/!,D[!,(+!"
+            ",_8!*yw!-Ic!+>A!+(g!-2p!,Rv!+69!-(V!,kx!,]c(!-(s!+W}!+>3!+O0!+tv!,B5!,zt!,>-!,4}!*~N!*n[!-,d!+v2!+8N"
+            "!,Rn!,BV!+qt!+<|!+9O!,4d!,Xi!+O-!+vY!+4s!,4i-!,,d!*zo!,SF!,f](((((((()((())(()()((())((((((((*(((((("
+            "(((/(((()(((+(((((((((()()((()(((()(()(((((((())(((+()((!,:L!,9|!*x9!,Y0!+/N!+E9!+5_!,.4!+]L!+wm!,{6"
+            "!+>i!,jw!*zi!,=>!+T4!+^/!*m7!-LL!,k/!+<y!,z|!*|p!,=-!*oM!+@(!-Q9!+7N!+HB!,B1!+4n!*k7!+d:!*lX!+Sz!,wG"
+            "!-1+!*y:!+^j!++[!+-A!-0g!*mM!*o[!-6/!-N2!+pO!+E3!+Kx!+=(!,tz!,{4!+Zp!+R+!-NY!+<c!+>.!+Uk!+)W!*|T!,7q"
+            "!*uM!,g/!+c2!+fE!+nu!+Rt!-/L!*|Q!,]i!+ui!,6-!*l2!-(Z!+<J!,*9!,h_!+_wq!,Tq!,l[!-_@|!+@8!+ak!-0T!+dM!+"
+            "bE!+QC!,F{!+3]!+G=!+[T!+yu!,h0(*)(((((()((((((((((*(((((()(())((+((((())(((((()(((((()((((*())((((()"
+            "(((((()((()((((((((((((((!+L3!*w^!,Vb!+X6!,px!,4s!+E6!+dO!+T*!-G1!*|I!,,-!,{b!+pu!,;W!,D]!*}V!,<M!-K"
+            ";!,]s!,{T!,>L!+aO!+~[!+]=!+Xy!+,a!+KQ!,Ce!*|v!*k>!+nf!,X/!+>)!++c!+.[!*n^)!-N4!+D{!+be!,W6!+K5!-KD!-"
+            "0f!+<f!,zrb!+WT!,^Y!+Ym!++}!,_|!-4v!*pP!,Mr!-1-!,LE!*sn!+2~!+xG!+=D!,{(!,X,!-52!,eJ!,I;!,k,!-EK+!,S7"
+            "!-RB!,@/!+@]!,EP!-1Q!-Eh!,BW!+<2!+UA!,GZ!,f)!+f>!+).!,S}!,1X!,Mt!-@k!+Qw!+2y!*mN!+<^!+6Q!+3*!,iS()(("
+            ")(((()(((((((((()((()((((((((((((((())((((((((((((()(()(((((((((((((((-()(((()(()(()(((((((!,/`!+TU!"
+            "-+X!-*r!,Xy!,`*!+S7!*|n!+s0!-4o!+5W!+K4!+q[!+/y!+X,!-(5!,7v!+y+!+00!+kj!,79!+z[!,|7!,{i!+0;!+p.!,qD!"
+            ",@U!+V.!*|w!+~G!+qO!+3.!+Wc!+2-!+fs!,[F!+)8!,L}!*q;!-,s!+ud!-)V!,(/!+Ur!+u1!+xm!,S8!,c]!+e)!-0h!+up!"
+            "-E5!,z^!+6.!,,k!,i=!,[(!,6[!,w=!+fA!*w{!-+.!-@{!+V^!-KZ!-+Q!+*P!*nw!+a9!+-e!+M`!+u+!*wj!+>z!+5V!+v<!"
+            "+3B!,4z!,4f!+LK!,]k!,ZF!+TH!+bG!-0F!,;/!-*U!-(@!-@)!+EH!*{W!*}T!+~^!,js)()((((((2((((((,(((())(((((*"
+            "((((*(,)(+(+(()(((()(()*+(,()((*)(*((()((()((*-((*((())*((,()(((*)!+q*!+H)!*r*!*l{!+G4!+Tr!,^H!-1(!+"
+            "e6!-5(!,<T!*}3!-@E!+IB!,G3!+e^!+T}!,HL!,S1!,6{!*rF!+Rw!+5b!-0t!*vt!,Cg!,E{!+/(!+Iq!-0y!+to!+@:!+/J!*"
+            "}7!*tz!+w9!+.c!+V4!-KU!,[)!,lq!,s1!-0e!*}F!+@J!,[l!+Sc!+R8!,Z0!-]R!-DU!-Q15!+gk!+6~!+S`!+)h!+TM!+(E!"
+            ",l3!+s~!+80!,4.!,qN!+nT!+5C!,|W!+Hc!+wl!,0F!-K>!*kZ!,(;!+<g!,@8!+Tu!+_>!,95!+MU!+<v!+8x!*k(!,ZU!+qU!"
+            ",/~!*lo!+bp!,TO!+I_!+^3!+aV!+Jb!+6]!+8.!,lu)))(+)(()((()()()()(()(*((((((+())((()(())((((()(+((((((("
+            "))(())(((,((*)()())(((()(()(((((()((((!+DT!+J6!*{C!-IR!-0A!+e+!+.u!+)X!+Mj!*k]!+z:!,SG!,_t!,cg!+7W!*"
+            "nB2!+>o!,RT!+af!,ft!*~F!,5C!,Xn!+*V!-Sj!*nq!+vp!,{t!+>8!+OP!*{<!,7j!+vl!,k9!+[l!-Cf!,Rb!*}d!,E+!,M[!"
+            "-CX!++a!,Uk!,46!+TT!,ls!+u7!,FA!+QG!+]/!*{8!+Vo!+qo!+Ds!*~.!->g!*ko!+qL!,{L!+>|!+]p!,_H!+f8!*}g!*}]!"
+            "+oa!+nP!*lb!+Tz!*zp!,]u!*n/!*o}!+03!+Q@!-Fj!+_I!,,Z!*y|!*xs!+M(!,{O!+^N!,*3!+bw!,t1!,>I!,=I!+_U!+,f!"
+            "*}a!-A4!,,l!,nV(()(+)(())((()()()(((()((*((((+(((((()((()((()((()(()((((((((()((()((()((((()((((((()"
+            "*((()((((*!,DN!+LN!+E=!+Li!,[H!+5B!+Mg!,)u!,(3!+xB!+q:!,,r!+kn!,q`!+E`!*l,!+:6!+*q!-@L!+sX!,ML!-EY!+"
+            "QE!,Ro!,<.!,k-!*zJ!-G3!-/O!+_m!+Ah!*oo!,.3!*k,!*{y!+5;!*}:!+Uc!-A;!*tn!*mQ!-Wc!,RL!+(5!-(/!,p[!,^7!-"
+            "C]!+t{!+HY!+:P!+^y!-E(!,0M!,.v!*|;!,Z{!-NH!,UJ!+=.!-E6!-Df!,Rh!,:C!*{u!-B4!-N]!,IV!,sL!+wE!*l-!,U~!,"
+            "B^!,{F!+M~!+(K!*ly!-K:!+E(!+kJ!*sI!*}8!,|m!,d)!,>T!-Fp!*wq!+(m!+-y!-@j!+tu!+=9!+u^!+_7!,p*(((((((((("
+            "((()((((()()(()((*(((((*((((()())((((((-(**)))((()((((+**()())((()(()(((()(((())(((((!+>>!+<6!+d^!,X"
+            "@!+*L!,Ga!+[+!+h;!*li!+n0!,mT!-HL!*zw!+TV!+Ws!-2e!+]*!,Xl!,{q!*uj!+fB!*{J!,oU!+PS!+rZ`!,|,!+@+!,hY!,"
+            "_[!-@v!+mc!-/T!+]>!+K.!+JL!*pZ!,pL!+^Y!,Zf!,.q!+N.!*uD!*w6!+0b!+I@!-2]!,pS!-5M!+FU!+b4!+K[!+7V!*tj!*"
+            "vr!,YM!*z.!+qe!-F.!,){!*n3!*ph!,UG!+ay!++D!-@r!,Cd!,qH!,S5!+3w!+QB!-Fl!,j`!+,B!-K<!+Io!,zn!,es!-4h!*"
+            "|V!+]}!+Fm!,5P!+LC!,Nk!+9X!,S<*!-.x!+*|!+<~!+M5!+]Z!,/w!,q_)(()(((()((()(((*(*()((()(()*(*(((()(,()("
+            "(((((**((*())(()(((((()(((()*((((+(((()(()(((*((()(())!-0n!,8X!,:u!,S,!-H4!,hJ!+<@!,En!-FU!,pG!*yG!,"
+            "*)!+J2!+]|!,{B!+>*!-Q2!+Di!+nt!+qF!,zc)!-0o!-0(!*{^!+SH!-]C.!*}i!*kM!,_j!,,J!,kL!+BG!,pa!+uF!-F/!+(O"
+            "!*lh!,zl!,(N!+(:!-Ct!+~z!+v:!,9q!*kG!,=a!,ln!+A.!+H(!,u_!-K_!-Cy!+}~!+rU!+5r!+V5!,;1!,pT!+yW!,^u!+2]"
+            "!,*q!*{_!,=g!-F+!+))!+ID!,(v!+=8!,{{!-QP!+nn!+5[!-]L!,D4!+bN!+RM!*o<!,6@!,U2!+sL!-DH!+ph!*mi!,6r!*uK"
+            "!+dt!+z+!-29!,Zq!+6o!,2j!,s@(((((((()()((((((((((((((((((((((((*((((()((((((((((((((((((()(()))()((("
+            "(((((((((((((((((((((((!+X)!+>W!-1u!,F4!,|-!+7^!+()!,]V!,ar!,t3!,VT!+gn!+,y!,W4!,+~!-63!*v0!*l+!-K6!"
+            "+Uy!*k;!*|t!+a-!,ZK!+5I!+uI!*jx!+4|!*zc!+Vd!-@Z!*ol!*n,!,pk!-KR!+5e!-1g!,DI!*mc!,YE!,6/!+qn!+<w!+7l!"
+            "+I:!+gB!,k0!*q=!+Dz!*k|!,=.!*m^!,^|!+Rs!+^M!-2K!+@T!*m6!+IW!,[r!-1G!,X-!,6J!*lt!,r0!+ND!+oZ!+JO!*kl!"
+            ",9k!+x9!,{C!,zd!,{k!,{0!+H4!,VP!,Uv!,Rw!,a6_!+.a!+oL!-I`!-DI!+8(!*}G!-@`!+v,!+=J!-N0!+>j!+HH!-EP!,tU"
+            "((((((((((((((((((((((((((((((*1-(()(()))((()*((()(()(()((((((((((()((((()(((((((((((((((((((((!*{B!"
+            ",`H!+jp!+9M!-^7!+Fr!,S|!,bg!,c}(!,aj!,mM!-01!-(o!,9i!+IO!-KX!,>d!+^Z!+(^!+Sr!*o0!,[o!,6h!+G@!-F7!-*m"
+            "!,lT!*~c!+s3!+ty!+py!+L_!*yC!,4r!+FZ!*n:!+M)!+Jq!+>T!,4{!-2i!-@(!,-U!+rO!+v{!-4Y!+aD!*|HP!*nu!-6.!,{"
+            "Q!*|E!+FY!-/|!+u|!*l[!,9c!+ho!,jd!+NO!,]]!*n}!*pW!-1M!-WB!+N=!+v`!+vV!-EE!*lU!+8`!-FS!*k/!+@Z!,C]!+<"
+            "b!,{M!,Ug!,/|!+1a!,_6!-2|!*}(!-1V!++9!+Aq!+J)!+N<!+mr!,.7!,X]!,w<!,u}((((((((((((((((((((((((((((((("
+            ")(((((((()((((((((((((((((((((((((((((((((((((((((((((((()((((((!+ta!+=X!,r1!-KF!,|w!-Q0!-]P!+vL!*uu"
+            "!*ti!+0z!,q2!*{r!+W+!-/N!+.n!*~*!+/0!,/0!+w~!,Sl!-0@!,_~!+Nu!+K]!-Dx!+a*!,RN!-)Ab!->d!+A8!,LJ!+aC!+M"
+            "/!-Cp!,Vm!*l_!-3L!*y}!-D~!*tg!-03!,gy!-4n!+_9!-Ib!+<.!*zD!,>.!+a~!+dz!+(G!+}n!+=4!-/5!*u^!+/S!+(.!+Z"
+            "K!+_h!-(k!-(O!,Ye!,dp!-1}!,M/!*v{!,iU!+c3!+]y!+{9!,kT!-,8!+->!-1.!,8x!+}f!,+*!-(.!+Sv!*w>!+s=!-(H!+K"
+            "B!+3v!+Oo!+a8!-(m!+R.!++1!+vf!+ai!-.v!,w4(((((((*((((((()((((((((((((((((((((((((((((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((!-@J!-Cc!,:t!+dA!+i:!*~_!*kp!+~R!,z~!+X:!+[p!+<`!,E~!*q_!+=n!,<]"
+            "!+ow!,w,!,L=!+rT!,9p!+]7!-/P!+B_!+@/!,j<!+dD!*{1!+QN!,F~!+wH!,SP!+j^!,G.!+IN!+yw!+HS!+Uo!+u>!+b;!*k)"
+            "!+EB!-(1!*mO!,Xk!,8(!-E]!+Sh!+^h!+R`!+rR!-)+!,)W!,Th!*tl!,X0!*|j!-1~!+Rz!+(q!,lK!-/R!,VY!-A*!,fq!-0<"
+            "!+tE!,0k!+]-!,:k!,4M!,=t!,]Q!-()!->F!*ou!+b|!,6X!,{)!-Fs!+Tg!-A[!-DJ!,eg!+TZ!,;6!+I`!,.6!*lV!+KH!+[X"
+            "!+S|!+nM!+Zy!,xC(((((((((((((((((((((((((((((((((()((((((((((((((((((((((((((((()((((((((((((((((((("
+            "(((((((((((!+EY!,6g!-35!,zw!,_I!+c-!+Zi!*}Y!,lt!,=0!,XL!,YW!+q+!*kn!,Rp!,WK!,:>!+gJ!+o*!+RH!*qa!*oR!"
+            "+/l!+T=!+nL!-)v!*|h!+]x!,Ra!+Ja!+TQ!+VD!,]I(!,Tm!+EN!+A`!*w]!+_`!,D6Y!-(3!+~2!,6t!+xw!+rQ!,F5!*kO!,9"
+            "f!+Jj!->^!,q(!,Rq!,Cq!,Xj!-62!*mkM!,]v!*~:!+Df!+st!,{+!,LK!-/,!,XB!+EL!*~f!,9Q!+<t!+^w!-Qi!,0~!+dg!,"
+            "l5!+am!,.r!,{X!,{:!-0u!,GH!+~v!,)_!+SP!,<J!+,[!*k^!,dZ!+d,!*x{!,kq!-(9!-@b!,HK!,yP(((((((((((((((((("
+            "((((((((((((()(((()((((((((((((((((((((((((((((((((((((((((((((((((((4,130BG<!*ns!+s(!,BU!-Q>!+Ru!,+"
+            "q!+T3!*k4!,=c!-.{!+Y=!-(g!,Il!+eP!+Fb!,qx!+6_!+Y+!+4q!,-R!+gK!-A8!-0b!-(e!+05!,SS!,{g!*vA!+U*!+Sf!*z"
+            "{!+e2!,1k!,`X!-4]!+)n!,;5!+}l!+t5!*uI!*~|!-(P!+8,!+xd!+u[!+<5!,M}!*mL!,Ky!+xl!+<)!,]@!+vO!+<0!-Rs!+f"
+            "h!-+6!+<r!,SO!+Kp!,R^!-2t!-(}!+5}!+VZ!,D,!-)k!*zz!+]_!,BN!,z{!-DP!,Rm!->z!,R)!+,_!-5D!+a:!,Ti!+>9!-2"
+            ".!+^c!+Dn!*nt!+cp!*r(!*o)!+/|!+G.#,!,|C(((((((()(((*)()((((((()((()(((((*((((((*(((((()(((+(((((()()"
+            "((*)(((((()(()((((((((((((((((((((!*lZ!*k-!*tf!*k1!+H1!*zm!*k6!*lf!*k@!-SL!+<F!+-=!*kJ!,C^!*kb!*z;!*"
+            "kj!+5Z!,,+!*{@!+pP!+.`!,Y8!-NZ!+oi!,;u!-`4!*kX!*lm!-`-!*l(4R!,_3!+<4!+*@!+,8!*m;!*{`7-)0!-G|!-(j!*zA"
+            "!*|s!*zM/7!-(i!*{7!*{4!*v~--G-3(39*!*x,!,e^!*xN,!*xR6*!*uR!,TR!*m2/-!*m9N!*mY1!*mVf!*mlWk!*mnX)!*n+J"
+            "[0!+Zr!*n~*!,}e((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "((((((((((!*o,!*n{!*nU2b!*oBE!*oW!*oQ3!*oL!*oIW!*oJX!*oc{))!*p=<0!*pU!*pJ5AYK!*pmb!*q2G!*qQ!*pxF!*q/"
+            "A*!*rM!*qh9!*qm-F6R))8DX!*sh!*sg!*sa/A+!*mU!+p~!*n|4!*pG!-aj!+q0!,Kp!*u=!+E.!-_;!-N[!*uQ!+5A!*yv;!,u"
+            "f!*z6!*vg!+5F!*t{!*ln!*t|!*m*!,pv_!*m,!,Yj!,r.!,By!+;d!,o`!,Ub!*u|-3!*v6!,~p((((((((((((((+Y(,/-*(()"
+            ")()(-(((((((()(*(((*(((()()((((((((()(()(((((((((((()+()))*((*)(((**)((!*vB!*ug3*!,zU-(*1()2(/+!,{-+"
+            "(())(**(++(,)*****())*,*)()((*)!,{y,)((+)*(*(*()(!*{:8!-D1,!-D57!-D>:!-DQ-.22/,-);,1A!-2Q+)!-2S:!-2["
+            ":!-2n*+!-*6*(*+((*(()+()(())-)(((((()((*)()((()(((((((+(*((((*)*)(()((*()(+)(-((((*((((()((((((((((("
+            ")()(**!-2s!-2kG!-3)!-2y9!-3(*3:!-3G!-3A!-3;+7+6-F!-4-,5!-4>11*!*w2!+5p!*xt1(8!+(~!*yL-B!*|]!,+3!,<o!"
+            "+G}!*vq.!-SI!*|2!+H3!,5N!+Dw!+/x!+1)!+0x!+3Ug03!+/T*!+/U0-!+/Y(U!+/g.OD!+0AC!+0R!+0Q!+0=,0!+0Ic!+0{!"
+            "+0cNE!+0~4!+0j4^*)!+1Z!+1S!+18e!+1q0!+1f!+1_!-,*))(((()())(())((((((*(()(((((())(((((((((((*()()(((("
+            "(()(((((((((((((((((()(((((((((((((((((((((!+26)!+2(!+1o:F!+2ES!+2Ln.</8!+3W!-Nl!-`6!+Q4!,^{+)7!,_5F"
+            "!,_/1*-)94-!,_]@)A!,_DG!,_ZE(!,_n!,_U2!,_M0!,_KM1!,_PfP!,`N!,`:S!,`_!,`2@!,`(-]!,`R!,`)g0!,`^5(!,`6!"
+            ",`+p^1(!,``!,b>!,a=!,a5!,a2!,bH!,aa!,a0H!,aI!,aED!,aB!,`or!,a.4!,a4[!,ah!--H(((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!,ak!,`sw*!,am*(k!,a{d(!,bM1!"
+            ",b@0!,b1!,b(c!,bV!,b)d!,a~E-19),i!,c<!,c/!+22!,cq!,cd!,c4H!,c-oD!,cj!,c_!,c+2X!,c[!,cP(!,cB!,bs!,bn!"
+            ",d(!,cH!,c8!,d`!,dT0!,d]B;(!,d~6!,d|!,d>1K4=)!,d3e}3*=!,el=!,ey!,en!,eiN!,eO@!,ec!,eEw!,f;Q!,4V!,g;!"
+            ",fIr!,fyC!-.S((((((((((((((((((((((((((((((((,=3-2*(()(((*)(((*((()()((*(***(((()*+(*-()+,*)()((+(()"
+            "(/(+),)*!,gZ!,g>!,fX!,fU!,g^!,gLH!,gi!,gcD!,<C!,gGW0Q+!,h5/!,g~^!,hK!,h3]!,hg!,h`K!,hqCKP!,i`L!,iqN!"
+            "+H01!+5j,!,W5!+6,,!+6/!*z5!+>R*./!+R,F^D67!+Sd>]!+T,l9!+T{!+V9r!+US0;N!+UOh!+Um!+UKn5_-!+VnG!+VQB!+V"
+            "[!+X4!+VS!+VK!+W~!+Wz!+WC7,!+WDB!+WYfN!+XPQ!-0~*.(()(((((+((((*)(*)(*)()(((()-((*()(((((*)()(((*(((("
+            "*(((((()**((()()(((()))))))((+()(()),,,()(!+X^f(!+X}I-7.4!+YqOD0!+H=!+J[!,4c!+HD!*{0!*|o3!*|g!*|f:>+"
+            "!*}-n.(()!*}l!*}I_)!*}K6y9!*~J!*~D!*~6_(!*~W!*~I!*~8`[!+(*<!+(1F!*~{!*~zU(!*~EYZ!+(8+44()!*~}(!*~xb!"
+            "+(M6f!+(fb!+(|>!+(rW(!+)7)=*fPN!+)sL!+)k;!+)i8!+)f!-2}(*)()((,)(()((+((*((+()))((()(()(((*(())(((((("
+            "((((((((((((()((()((*(((((((((())(((((()(((((((()!+)aGG((!+)]!+)YTWp!+*WV/!+*]!+*UF!+*R!++U!+*f!+*O!"
+            "++_!++;(!+*i,z4!++H!+,I!++PB(!++S9!++]!++CS!++e4(!++K(C4!++d!-/M!+,H!+,1+!+,*K!+,M!++~)O-S!+,dF!+,VI"
+            "<!+--*!+,w/Z!+-84!+-@7(05DM*-+;!+.l5-,-!+/3:!+EA1!+EF!+ECH1(!-4U)(0)((()()(*(-((*)-.((+(((()))+(+((("
+            "(((*(((((*((((()(+(((*((()((((((((((()*,)((((((((()((((((((!+Ej47.**!+@h!+@U:*-!+@d7(!+@m0)A!+@~C!+A"
+            "1!+A0-!+A(F!+A<459!+AQBE(L!+BW/!+BU!+BO!+B6<f!+Bp!+Bf0W!+C6;!+C85!+B}!+B|G25>+!,}(!+D=5!+IQ+2,)*0+*3"
+            ",/.!,pj!+I>!,-I*+*(2!,-^4!,-j,=.!,./0)*1!,.97!,.A!-6L((((((((((((((((((((((((((((((((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((((((!,.BD!,.Z5!,.Q;!,.e!,.]4>!,.m.3!,.yG!,/>103*6!,]r!+5"
+            "R!-LT!+5Q!+5.!-M|+(((((/*-*+****()((!+F^8!+Fi26!+F~A!+G<0!+G:!-(`!+GZ!+GY14)!,[f!+JM,4!+JX]!+Jx=!+Jk"
+            "*B.(!+Jt*2ID!+KZ!+KO!+KC!+KAD)!+K=^!+KU!+LW()!+LY!+Kw!-7W((((((((((((((((((((((((((((((((((((((((((("
+            "(()(((((((((((((((((((((((()((((((((((((((((((((((((!+LI:A+:!+L}!+Lc6!+Ll6z!+ME!+M:T!+Mc!+MP;!+M=!+N"
+            "U-!+NJ5!+N(35EGS`!+Ou:7EI!+Jg!-Et!-CS)-))(-),()))((()**(()(!*kN!,,/!+QK!+pvG/!+q4!+r8!+qq2+!+qx!+qS("
+            "2)7KO+!+rCs(!+s1!+rn!+rHV!+rmL!+s+*!+rGJD6!-8e((((()(((((((((((((((((((((((()((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((!+s{!+si!+sM`,!+sH!+sE<!+sOEJ!+sp.!+s[^*)!+su!+t~!+t[W)!+tJ"
+            "^(!+tH+D!+tO!+v]!+u_!+u]AX!+uVIY!+u~!+uu!+uqf!+uB!+vN!+uE!+vnl!+w:Ep!+wLO!+w@(!+vu!+vhG!+xx!+xI!+x/q"
+            "v!+x{!+x<)=!+xS!+xOH!+xLC!+w}[!+x6!+zP!+z3(!+yh!+yX!+y;_.<Q!+yn!+yLH!+zx+!+z{!+zg!+za1!+zi!+{k!-9r(("
+            "((((((((((((((((((((((((((((((((((((((((((((((((()(((((((((((((((((((((((((((((((((((((((((()!+{c!+{"
+            "@9!+{O3G4!+{x)6S0!+|`F!+|zB6!+<Z+8!+<n9:!,4y!-Qc!+Wm!+=j1!,s7!+=v!-+T!,xg!-/pE)70!-0H,!-0J4!-0LE!-0i"
+            ".C!-0v!-0r02;(!-1;)<4(!-1`@!-1h1!-1k!+`I!-2-0,-!-2</!+I-.!+I3)!+>l!+((!+@*0!+<K!+@=*!,Uf!+H^!+H]+!,^"
+            "v!+Hp!-SU!+@I!+6Y)1D(!+6|!-;((((((((((((((((((((((((((((((((((()(((((((((((((((((((((((((((((((((((("
+            "((((((((((((((((((((()((!+6p[!+7-!+6w-V!+74!+71P!+7Ap(!+7aS!+7g!+7[I:!+86Q)!+8>9!+8AUO!+8y2!+8kN:!,Y"
+            "A!+:-!+9u!+9P*mU!+:5H)!+:;P*5!+:Z7!+:]+U5!+;ED,0!+>E.!+<325!+<*)6!-Q8)(),!-QA*(+*)-)(*)*(()()())!,RG"
+            ")))*(!-<5((((((()((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "((((!,RU*5)((.)(++*+,(.**()(C!,SI+(**((+(*(*)(,)*!,So+)((((((*((()(((()!+FW!,5t!+Dc!,51!-2O!,0**E!,0"
+            ">!,0;X!,0`6!,0T!,0P40!,0fE!,0w!-K=!,1R!,10!,1.!,0|!,0WaECY!,1o!,1n*/!,1w!,1u!-=B(((((((((((((()((((("
+            "(((((((((((((((((((((((((((((((((((((()((((((((((((((((((((((((4,)W/+(-3<I+!,1d!,1cOC!,2J!,2H+F!,2a8"
+            "F!,3+!,2t(-+:1(!,3->S!,3X!-IV((!+b1.2!+b-Ie!+bn!+bP0M6!+b[[!+c.6!+br!+b^,!+d+A!+cjZ!+c{!+cA!+dH!+ck!"
+            "+cFM!+cDRK!+cT!+cIRT!+cRe^(U(!+e4;!+e*HG!+dYa8!+d~N!+d}!+d{3!+e/!+df!+fG!+ew!+e[*D!+eR!+fT!+hV!+g8K("
+            "!+g5!-A:31-,*1,-5-()((((((()(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((!+gb!+g,C!+g=!+h>!+fvU!+hY!+gwO!+h)CO!+hS<@!+ha!+gr!+i`!+hp(o!+hr!+hN!+hK=J3;!+i=)O!+iD70<!+h~t!+"
+            "hv!+j<X!+j*R(v!+j/{!+j}!+l3!+k82!+jt!+kx!+kc!+j|!+jgXL<!+kzA!+l*;!,/(C!+nl(,!+no5(!+nx4(-0!-.z)+(()("
+            ")!-//)())*()*+!-C5(((((((((((((((((((((((((((,:/3,**)*(((((()(()(.(((+*).+()((*(((()(()*)(,)((((),(("
+            "((((((((((*)(!-/F((0)!--0!+QA3++*!+QW+!+QZ/!,]<!,47,27))!+Zn!+]~((B6!+bX!+^<9!+^9!+}u!+a1!+^W>!+^l,!"
+            "+^p!,VZ!+_D!+_8!+^|5.2!+_;H4/C!+`,IE(1*!-(=(*,)*,()(!-(S-/+!,t{*(()(((!,,`Y!,,N006(,.))*!+T>R!+V<!-E"
+            "L)*(()(+()((((((((()((((((()()()()(+*(,)(,()()((((((((()((((((+((()(()(*)((()*(),((+(()()(((())(!+Wx"
+            "!+Yg!,VX!+p)01!+p4+3)!+pF./*((./!+pe-/!+ZoH=!,,=,+!,+w!,jh!*w;!,XI!,XF!,X<Q!+aE!,Xh!,X[!,XU).*X(((!,"
+            "Y/!,Xm)<!,Xx1!+aK!,Y15-*!,YBH(!,YG1!+aP!,Yh!,|f!,Z5!,Yt5!,YnB=+.I!,ZY(>!,Za0:(!,Zn!,Zh!+2z!+:8!,[2!,"
+            "[,6!+xn!,[N.J!+ab!,[v!,[g!-G6(((((((()()())((((*((()((((((((((((((((((*()())()+()(()((((((((*)(((()("
+            "(((((()(((())((*)(()((((!,[m!,[Q!+md:)1*:!-L=(()+(!+oH!+Ht!+oW!,uQ!+[u!-`p!+[xQ1!+]S!+]R0)++!+}pD!+~"
+            "/.F,!+~Q!+~E-`!+~eo**A)k!,)L3!,)4U!,)9V)FC)!,*C!,*:i!,*p:9L2!+}[!,(^w|!+Qu!+Qt-,(!,B2,-*9(!,BK./!,BO"
+            "06!,B`:2,743!+JZ!+JY!-H`()()(((((()))())((((((((((((((((((((((((((((((((((((((((((((((((*-(((()*(((("
+            "(((((((((((((((((((!+KqI!+L84!+Kv@1q!+N:.yu!+O~V-^!,X)!,X(!+r(!+s6!+v=!,=B)/05(!,=^!+]9!,=z!,=i(D((!"
+            ",=lE!,=r.!,=p-MG!,>M(!,=sR!,>=,FY!,@4.!,@(<,)6.!,@GW,!,@lK-:!,AAG8!,Al=!-ae!-_m)(!,:;:0!,:D5(9/!,:e;"
+            "!,:r6*@(!,;<!,;8>5!-I|(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((!,;X*B5!,;t*3,5(7,/!,5--5!,5>!,5;:>.1!,TV0!,T^!,vQ!,Tg3!,Tp//!,T}!,9n@!,p8!->C((+!-"
+            ">H)()(+*!->S,((.(.!->i*!->k*()))(((()(),+(((((()((*(()!-@A**(())()()!-K0(((((>*+*+1,(((((((((((((((("
+            "((((((((((((((((((((()(+)(+((*((((((*((((((((((((((((((((((((((((((!-@R)*(+(())*()+!-@l+()(*((*(((()"
+            "*)((*/(!-A<*,())((+)(*!-AI6((**)(*(()((()*(!-Ar+()((((((((*)((!-AN!,=2,!-F3!,Cy@!,D0/C!+By!,DQ!,DPD!"
+            ",Dc!-Lv(((()()(((((((((((((((((((((((((((()((((((((((((((((((((((((((((((((((((*(((((((((((())4,()*+"
+            "(-!,E1!,E/B!-_B!-Ni!,Ej!,8~-,-2!,3})u!-]<)-((((-!-]N,)!-]T)(+*())((()()*+)*((),*((((((,!-^4-!,60))1!"
+            ",6;6!,6B7(+3!,6P!,6O:!,6b;!,6m=,!,7/!,7-.!,70D!,7:2*8!,7J,.2!,7TC!,7c!,7`+!-NO)3(((((((((()()((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!,7fI!,7m!,7kH!,7x*6!,8)5!,"
+            "82!,7~B8!,8I/!,8K<+!,Ut!,G4!,Er(.-)48!,FD3!,FL,-!,pl,02)*HL!,qj,4A!,r*<)3Q!,rY!,rE=!,rMY!,rw!,rq/!,r"
+            "hR!,s222M<!,6)!,Y9!,9R)!,<~!,Vg))-+)*(()!,V}0!,V`R5*.,>/!,t5!-K9/*!-Oi(((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!-KK*(),-(*()(*(!,jR.@)8!,k))!,k*U!"
+            ",k<!,k:I!,kM1!,kS.!,kC=45!,kfA!,ka1!,kb!,k`B-!,ke^/(!,lH-!,l*l!,l8=!,l9!,l2!,l+Z+!,lS7)*!,leB@!,lz.0"
+            "!,lvL1!,m9!,m6!,m.5/l!,l~!,n-(!,n+!,mg7!,mRJE!,mY7A!,mk!,m`3VD!,nYR!-Pt(((((((((((((((((.8-+(-(+4*(("
+            "((((*(((+))((+()((((*((())((()((((())((()((()))(((((((())(((((()((!,nx!,n8!,n5P!,nH!,n3Pc!,n^0!,ne@/"
+            "!,no;!,nr186!,o;5P!,op!,oZ38-@*!,T33)(!,]g!,GI*2!,GR(8!,GYI!,G_a!,H1!,Gz!,Gi<*!,Gp,!,Gt62!,Gnc)!,H>X"
+            "!,HF8*54!,H]7!,HlG=(8!,IQ!,IB2!,I)M!,IA-00E!,Ig28!,J)2(+J!,JN!,JL:.!,J[!-Rw)((((()(()(((((((((()(()("
+            "((((((((()()(((((((*(((-+(()))()((((((((((((((((((((((((((((((((((((((!,Jp2!,Jw90!,K:!,]T*()!,]B!,pK"
+            "!,]x((1)!,^(*4*!,^3(1-,)+2,0!,q/.*y.!,sg!,UF)//()!,Kx!+[,!,L63!,LB)+71(+-,(!,Lo!,Ll98!,^p!+`7!,Ui6.7"
+            "!,V4,*,,!,MI!,NtW/!,QD}!-_*!-^}!-))87!-)HH!-(t-!,|R)!-4Z-!-4_(<!-TA((((((((((((((((((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!-4s!-4r6!-4z-5(!-5,),:!-5@2!-5H+8(.*("
+            "(-!-5p-!,|a!-^F!-)p[B}7!-)m1!-)t!-)r19(*+!-*/(3!-)~N2(!-*E=)!-*FM!-*`>0)4)!-+/32-!-+F!-+B/!-+=@!-+N("
+            "6(!-+WN--!-+},81,!-,H3)!,}-1/!,}::!,}J!+])!,u3/!,u7)!-UL(((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((!,uC-+x!,y/!-Gj!-FT1!-FZ>!-Fm..!-FzD**5!-aI*)(((("
+            "()!-_r4)!-Ez*(8+!,<a!-FK!-8JHB!-:PT!-<1!-;L!-=QU!-WE**(((!,Dr!-WQ*)(()(,(*((((()(((())()(((((((*(((."
+            "(((*(!-VW((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((()()*(,()*+*(((+4)*1,((((-(/("
+            "/(,(!-X<((((*(()((*()*!-H<03()C!-Hm!-He6)!-Qv!-Qu.!-]v!-Q{+),!-R.,!-R00(,!-S`!-S^+)!-Sc,+!-LUMIO!-Mm"
+            "!-RN),0!-RZ7!-R]36.+3+!-_/(!,Q7!-^J,(*.!-<=!-^f)e((*!-_R*.!-_Z!-_X,,[1*1!-`U-(-!-XT((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#~#0(((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#~#0(((((((((((((((((("
+            "((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#~#0(((((((((((((((((("
+            "((((((((((-*.)+.(+4*)(()*+)(((*0(*)(((((((((*()(((*()(((((*(((((((())((((()(((#~#0((((((((()(()()*(("
+            "(()((()((+)()(()(+*)())*((()(((((((()*)((((((((((()*)()(())((((())(((((((()()(#~#0((((()))*(((()(((("
+            "((((((*((((((((((((((((((((((((((((((((((((((((((((*(2(((((((((((+((*((((!0pOvD{1#~#0C((())(+.(()(*("
+            "(#~#~#+";
+    }
+
+    static const char *Big5Index() {
+        return
+            "#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~#~"
+            "#~#~#~#~#~#~#~#~#~#0!)eY!1+4!)eZ(!1+6!)3q!1+D!1+C,!1+)!1(X!)3p!)3o!1(y((!(*5!1(}(((!1,/!)3]!1(Y!)3^!"
+            "1([!)Dn!1(]C!1+0(!1(^(!1,.)!1(`(!)en(!1(b(!)ej(!1(d(!)ed(!1(f(!)eb(!1(h(!)ef(!1(j(!)eh(!1(l(<(((((!)"
+            "3b(*(!)ew(!)4(!)3|!1++*+!)4.!()|!)e]!)Ep+!)EW!)EVDa!)FT!)El!)Ek!)EE!)EDE!)Ea!)mT!)6O!(*-!1-c!1+i!(0N"
+            "!1(r(*(!1(t(:((!1+3)!(*VH!(*/!)9f!1+E)!1+F!):](!):V!)9j]6!1)4((((!1,1!)9u(!);F!)9l!)9k!);a!)q.!)q-!)"
+            "9w*.!):)!)G9)!);5+!)80)!)8/)+()!)87!)9q!)9o!1+7U!)9a!1):!1+,!1-e!)el!1-`(!1+-C!)6M-!1);((!)q1!)pN((X"
+            "!)pS!)p@(^!(*.!*u()*!*u,+)!++g!,41!,Lu!)D{(((((((.!)E1!)E0!)E/!)E.!)E-!)E,!)D4!)D,!)C{!)Cs!)Ck!)E7!)"
+            "CN)!)E8!)CZ+++~()!)Di!)DI53!)DZ!)F0()!)F2!)Dk((!1+8(((((((((!)7U(((((((((!)e{((((((((!*zi*(!1+J((((("
+            "((((((((((((((((((((.(((((((((((((((((((((((((!(2i(((((((((((((((()((((((/(((((((((((((((()((((((!)h"
+            "`((((((((((((((((((((((((((((((((((((!(0Z!(0J(!(0H+#I!)5K#E!*jx!*k|!*jy)iBQ-V!*teN-!*v[H(!*xm!*z;TC!"
+            "*|E!*k*)!*k))I4!*v]!*kh*>!*l*X:!*tf!*w(!*ywr!*|FB!+/J!+4nR9u!+<)()!+=~>:=b!+De/3((2!+FO!+H04/!+R-!*k"
+            "2!*k1!*k.H*09!+>j!*lU0+!*l`)5G!*m7**(-!*mB(!*m;!*ti!*tgN-(!*u;S!*vr7((!*yx*(>K6!*zo!*zmANp!*|G*!+4of"
+            ")!+5W*!+<-!+>A:=^!+D|!+FX!+H1<(!+JL!+Q=V<*!+Zi!+[l74<T!+a*@H!+m`k>{0.]M!+}Z!,+q3,39)z!,/~!*k:!*k7!*k"
+            "6!*k5+K9)!*kq!*m^!*mP!*mL(((3(!*mQ,!*tk!*tjn(Jv(!*vt9!*xr!*xq!*z+(8-!*mW!*zr!*zq@!*{16!*{@v]!*|b6!*|"
+            "j)!*|g!*|f;!*|v!*|s!*|i!*|d+/!*|o!*|n!*|c/5!+.[!+.Z!+5C@*l)!+<.V!+>m!+Dp!+Do!+DnD(!+FP0!+H3>!+HJ!+JN"
+            "!+Q@r(!+R2!+R1!+]3j!+aj!+ah!+af()!+nM!+ocm!+pPP0!+q*!+q(!,-K!,/w,!,3{1Z.0(.(((!,6)!,8sY8W!,<}.8!,B1!"
+            ",Cb!,En!,Fp!*k@([(=X2)!*ls!*mx17!*n,2!*n/*(!*n1!*mk+,!*mi*1+1!*to!*tm!*tl)H0DK!*w<!*w6(!*w3/!*xu!*z."
+            "A!*zGy(!*}0-!*}3!*}1-!*}(1!*}+4!*}4!*}/!*}*2!*}-3!+.a!+._!+.^!+/_!+/[!+/S,!+/W*!+/T!+5F(E(u!+6P2!+6U"
+            "!+6Q0!+6Y!+<0(W(!+<`+!+>)D!+@T!+DfP!+FS!+FQ!+HB3!+Jc!+J`!+QD!+QB(*|!+R;!+R8!+Zp!+]y!+]x+(!+a,(=]!+ap"
+            "!+am+!+mal>!+pVp!+qB)-(!+q:,3!+qF!+q7(!+}`!,,P!,,N!,8t!,GH!,Ko!,MI!,T3}[m)0-Iu1)(!,]8.0076+x+3!,jq!,"
+            "pG3>!,t1!-D5!*kT!*lv!*nq)!*nk7.!*nWO!*ny!*nSH(!*na!*n^!*n[28!*n`1E!*o)+!*nRG!*nYK+!*nl9!*tr!*tq)Pj(!"
+            "*wK!*wJ,(!*wN!*x}!*x{()!*zJy)!*}E7!*}FH!*}NP!*}OG!*}l!*}[<!*}k!*}C5I!*}b)!*}a!*}V.(!*}HD+!*}Y!*}S!*}"
+            "G4!+.k-!+.e.!+/v.!+/l4!+/s.!+/j9!+/{!+/g!+4rx!+6v!+6k=!+6w,!+6r!+6o!+6f>!+6l!+6cC!+<6!+<5!+<3(Y!+<f+"
+            "!+>];(!+>p!+>o{(*!+@h!+DsI!+Fm!+Fe*!+H)4Cn!+I@<)!+Jb!+JU2!+JVL!+Ju4!+Jt!+QH!+QG!+Rf:!+Rx!+Rb!+RW:!+R"
+            "NE!+R^)!+RZ!+RTG!+RPQ!+ROO!+Ru!+Rs!+Rh!+Zs)!+Zr!+^*!+a.!+bE!+b3(((2!+b;/!+b.!+b+B!+b8+!+nO!+oe!+q,Dd"
+            "!+qm.(!+qq=!+qU7=!+q[D!+qSV!+q~!+qi-!+q^3!+q`9!+qb>.+!+qn!+}f-(!+}h!,,S!,,R!,,Q!,-a!,-_!,02!,4v!,4u3"
+            "(!,8x!,:9!,=.!,Ce!,Cd!,Cc!,Ep!,ML!,TS!,X@!,X<1!,XB*!,XD@!,^qK!,_6)!,t=pV!,|B66q!-(q3l!-,dG!-/T<9+!-0"
+            "(!-/~!+Di!-2K8/!-2a!-2^!-4Y!-6+-!-DG!-DC*!-D>)!*kHXE@7*4(!*o<V!*o[!*oA3!*o9W!*oY!*oT!*oQ!*o=,:!*o69C"
+            "!*oL8)!*oH!*tz!*tx*;5!*uF)nig!*w_!*w^*!*wV!*wT/2!*y9!*y6!*zz)!*z{!*zy<8((!*|S!*|Q*!*~F)I!*~KE!*~S!*~"
+            "N!*~J45!*~Y!*~O;!*~D,=5!*~4-K!*~P8!+.{!+0Y!+0M!+0@!+0>!+06,!+09@!+5IU!+5u(!+5r7!+7A!+7=A!+7;!+70K!+7"
+            "I1!+7P!+7N/!+7M!+71+G!+7H!+<8,!+<<]*!+<s+!+<t)!+>JV!+>v(!+A<!+@}>!+A.)-)!+EJ)!+EH!+EG-!+EC!+FUJ!+Fu,"
+            "!+Fs(!+H(X()!+I_(!+I^!+IZ!+Jg*E!+K(17,C-!+KJ;!+KI3-))!+KO!+QL!+QKR!+Qu)hs*!+SP!+SK*!+SEA0!+S6P(!+SW!"
+            "+ST!+S3<!+SH;0!+SS-!+SAM!+S<O!+Sc(!+SR!+S7J!+Zx!+]5<gB!+^M!+^F!+^@!+^;3!+^96-!+^D!+^A!+aH!+aF!+bSF1!"
+            "+bWS!+bY+7=!+b~!+bU(61!+be9!+b[M!+bz!+bc!+bP/!+mcl(@!+pS/!+rz,2!+rGCA!+rI1(!+rRN!+rAR!+rj!+rN3!+rO/!"
+            "+rDQ!+r[T!+rU!+rQN!+rr!+ra!+rBl!+rs!+rm1!+~.!+}~+!+}z6!,+s(27G)!,-]52!,-t!,-m!,0F!,0E!,0;3!,0B!,50!,"
+            "6;!,67(!,8zgX)!,=0@!,B5)(!,Cm!,Cl!,Et!,Es!,GI!,MO!,TRa!,U3!,VY!,Xe!,XO!,XL6!,XK1!,XS2!,XT,!,]:A6!,_`"
+            "!,_I!,_E;7!,_KB!,_^!,_X!,_Q10!,_O45!,_d!,jSK!*wC!,pp!---!-01-!-04!-2p*!-2l,!-6,1!-B50!-D0L!-DT!-DP0!"
+            "-DW!-EzW!-Gi3!*lm5(!*pZ!*p-!*o~7I!*pJ!*pH5!*p;!*p.J.!*pC4!*o}J!*p<!*p:@!*pG7!*p/!*t}d!*ub6!*wu!*wj.*"
+            "!*ws!*wr!*wn!*yC)!*y>!*y<usLGj!+();!*~|N!+(G!+(5!*~z4;!+(@!+(:!*~~>*+!+(,!+((-1!*~}!*~{@!+/)!+0X0<*!"
+            "+0yT!+1.!+0j!+6,!+6(!+5}!+5|)!+7`!+7[O!+7g,C!+7i,!+7^3C!+8(!+<Cc*!+=(!+<}*!+>0v(!+>~!+>|!+A`!+AX!+E("
+            "N/!+EQ!+FZK-}5MaK!+Id,(!+If,!+Ih!+KF2*,!+KBBMK!+LG!+LA!+K{!+KxQ!+LJ!+LI!+LC!+Qx!+Sic!+T@!+T2!+Sz;!+S"
+            "{61!+S~-!+S|!+Sy9!+T*E!+T8!+Zy-!+]99Ml/!+^Z./!+^Y00!+^_!+a1!+d:!+ceF!+cf!+cbD!+cG!+c@o!+c{-!+cU4!+cE"
+            "N2!+cI>6<!+cAQ0!+co!+cd!+nTA*WE,q!+r`kO!+sl>!+sg!+sMM!+s`!+sXL)(!+sx!+s]!+s5m!+si8!+sk,.!+sOE!+~E6!+"
+            "~M!+~F*!+~G2!+~H!+~=!,+wk!,,a,!,./!,-}(!,0T:!,0X!,0OC!,0^!,0P!,4d:J!,5@)!,5>!,6J!,6C(!,6A(!,8n5((i!,"
+            "9g!,9d)e!,:D!,:C8)!,:I!,:G2!,<~N9!,=X(!,B=*!,B@!,B>!,C](>(!,Co!,Ey)!,GN!,GL!,Ky!,MS*!,MQ0!,MX!,MU)!,"
+            "T5!,U6Yn3!,Vb+M!,Y*6!,Y.!,Xn(/<!,Y/!,Xy7-!,Y1!,]JV!,`=D)!,`9!,`12F!,`;E.!,`(,B7!,`2!,`*!,_~4!,`)37>!"
+            ",jUQ)!,k)!,pTF!,t3|]!,ua(!,}T)!-)*!-))j!--/!--.!-0T!-0J!-0F/!-0I/!-0O!-0H+!-3.+!-2|)!-4[!-4Z!-62!-BA"
+            "!-Df!-Da((!-Gy.!-I6J-5!-Kk[+!-NY*!*k{!*m*!*q/(=!*pi`!*qI!*prY!*q9!*q)_!*qC!*q=!*q5!*q4!*pt-;;!*pkX!*"
+            "q.5!*q;!*pm!*phh!*qN!*pxU!*q,!*uLP(!*usS!*vG!*vA,!*w}-!*w{.)!*zQ~H!*{pk!+(gP!+))_!+({!+(d4;!+(yB!+(h"
+            "+!+(`P!+(m!+(i!+(ej!+)/!+(|9!+/-(!+1C9!+1L!+1Do!+5;q()!+8>.+*!+8I!+8A!+7p]*-!+8S!+89!+86!+<E!+@2!+=4"
+            "**!+=8!+=2.+!+=<uv+!+@*!+At7!+B+!+Aq!+Ao/-2!+A{!+Dvh!+E^!+G2)!+G.!+He!+Iq!+Ip!+Io!+L71)!+L.,@!+LH-<C"
+            "!+Lz!+Lm.!+Ll!+Le8!+Q~!+T)<!+T5x!+Tv!+TgN!+Tz+0!+U*!+Tr=!+Tu!+Tb(!+T`M!+U-!+[+(yP+!+^}.-!+^~6!+_0!+_"
+            ")!+^|!+a2D()!+d^>7!+e,4!+dv09!+df!+fE!+dS^,!+dz!+d/!+e6!+d}!+dy.!+dgC!+dO,Q!+nu!+ntV!+pd+(!+pg!+pe!+"
+            "s0!+tVS!+tu!+tt!+tR9!+td!+tEc!+tXE!+tZ!+tFB!+tUK!+tw!+tf3!+tQW!+~e53!+~t!+~c.!,,)i!,.C!,.@+!,.>!,.=!"
+            ",/y!,14D!,15!,0~1!,0|!,5H0!,5P!,5N!,5M!,6^.)!,6Q(1!,6[!,6X0!,6W!,9*MB*(!,:u!,:k(/!,=4p!,=t8!,=j>*!,="
+            "r/!,=m!,=l:!,BM!,BH7!,BW!,BN/!,BU!,BO*!,D1!,D0+!,D,.*!,C|!,E~+zU2!,L.!,Ms!,Mi!,M]!,M[=)!,Mf!,Mb,,)!,"
+            "M_3)!,T7M^Y!,Ukn9!,Vj+!,VlN)!,YF8!,YE<!,YB.9!,YM!,YH<!,YR4!,YQ!,YD!,]C!,]B;7B(!,^(+!,_h!,a,O)!,aL!,a"
+            "9@!,aK!,a6!,a5C!,a3.!,a7!,`oQ!,a2!,a)C!,jY_H!,kC8,!,k;>!,kL!,px.1(!,q.!,q*!,uw!,uo!,um!,uk0!,ui4!,ur"
+            "*!,un)!,|SZ!,}.P(!-)-!-,eN)!--1!-/ky,!-0[0!-0_!-0X6!-0b/!-0]!-2Ou!-3B,!-4c!-4^!-4]!-6=,!-6<,!-6>!-BB"
+            "!-Dx(!-Dw!-Dq).!-Dn-!-E|!-LO!-Np!-QmXv41!*lK!*rI*!*r*!*ql!*qh05!*qnD8!*qs.H!*rC*!*qt!*q2!*r=!*r;!*u+"
+            "b!*vl!*x:,!*yN.!*yT!*yQd!*z51N(!*zf!*|@!+a6!+)pL!+*9!+)nB*!+)m.!+)ZM!+)y-!+)X^!+)b!+)WV!+)U`!+)]5=!+"
+            "/2*!+/3!+1aN,!+21!+1b+=/[!+1y)!+5Mk!+8e2/E+!+8o!+8kN!+92!+8u+!+<J!+=L!+=J!+=I!+=G!+=D.l!+>7!+>6!+@:!"
+            "+@6(!+B7!+B6/4!+BG3!+BB@!+BE,2*!+BH!+Dj!+Ek!+Ei!+Ef+!+G>(!+G=!+G<0!+Hi)H<!+IG)T),!+Iw0!+J(!+I{!+L_L!"
+            "+Li>/K!+M=Z!+MG/!+ME!+M>O!+MFD!+M`!+MPA!+MBJ!+MQ!+QP(U!+V,.!+UTL3*!+UY!+UIY9!+USa!+Ul!+Uf@!+UMf!+Ug+"
+            "8/2!+Uu!+Ur!+Uc!+U^!+UK!+UJ9!+[A!+[9!+[4/!+[:!+*2!+[20!+[8!+[7q!+])8K!+]Z()!+_B!+_>1+!+_K!+_C!+a3!*y"
+            "S!+aV!+eiV!+f3!+e{J!+eg!+e^d!+f8!+f(A!+ekj!+f>!+en!+em602!+f0)!+ej!+mr!+oOY(h!+t{V`!+uq!+uIW!+ud@>!+"
+            "v;2!+u_+!+uFJ!+uEXC!+uOh!+v6!+u]4q!+uLM8!+up9.!+v/!+v)!+u^!+u[!+uAk!+uVO!,(=7(!,(B!,(3!,,-i+!,.d!,.c"
+            "!,.^!,.Z-!,/z!,1M,!,1K*!,1F6!,4(=(M-l(!,5V5Gn(!,6T<*!,9-o!,9s0!,;,.!,;1!,;+))!,>c!,>92!,B^*,!,DI!,F5"
+            "*!,Gp/!,Gk8!,Gv!,Gi,7!,L7,!,L:!,NB!,N>V!,N)2*+!,N+*8!,N*:!,N-!,N,!,T:!,UG!,UCZ)+sV!,WE!,Z.!,Yl4/!,Z("
+            ".!,Yz!,]X[)!,^6*!,b:7!,bE!,a{R!,bCO!,bX!,b>!,b60!,b5>!,az+(1I!,jZ!+IH!,kx!,kq!,kg5!,kf8,!,kb!,k`B!,p"
+            "Zt!,q9K!,qD+!,q>!,q<!,tF!,tB!,v2!,u|-)3!,v5!,u~!,uz.!,|T8x*!,}b!,}_)!,}^!-(t!-(s!-)v!-)r!--=+!-0~!-0"
+            "r4!-0|3!-1-!-1+!-0u,0)!-0t:!-0{,!-0y!-3M,7!-4h!-63O!-6L!-6I+-!-6O!-BH!-E)2!-E2,!-E/+)(!-E+}R!-FT!,G."
+            "!,G-!-Io(!-Su!-XV!-^<1N=!*rr!*r]!*rT;!*ra!*rO=))!+a:!*vm!*xC)(!*x9!*yZ!*yY!*yW!*{+t!+*O,O!+*P5:!+*m!"
+            "+*VB5!+*i!+*[+!+*WX!++,!+*t!+)h!++0!+*oI!++*,!+*R2J!+*n!+/7!+2[!+2V1!+2P3(!+2M!+2I*!+4|(!+67!+9PK!+9"
+            "X:03!+<M!+<K!+=W!+=Q.!+=Uc(N!+B~+!+Bf:!+E.q!+Ep**du!+GI()!+HpYe(!+J0!+M[7!+M;+Re.!+N.C!+M{2!+N(!+OH!"
+            "+M|E!+N*:!+N49!+QUR!+V/!+Uol!+VMQ!+VV!+VS.,8!+V^8!+Vd>(!+UX!+W+!+Vx!+Vi!+X4!+VhG!+[B/!+[F(V!+[uG!+_S"
+            ")+)!+_TJ!+_`+!+_]!+a8(H!+aX!+g6!+fh2!+fk!+fjV!+fr=!+g*!+fz9!+feH!+fv!+f^)i,!+gK!+f[8!+hV!+g7!+m~!+mz"
+            "*!+o,!+o*N[h(!+pm!+vr0D!+vd8^!+w6!+vc,!+vf!+v^i!+wE!+vgZ@!+vp!+vir!+vwA!+v}!+vo>!+v`I!+xd!+ww!+v[^<!"
+            "+w0V!+wV!+wL!,(_(31!,(g<a!,(b!,,<a!,,r!,.~!,.m6!,.q!,2,!,1s0!,1k*7(!,1}!,1x!,1d2)!,4o(n!,5_!,7+!,6{/"
+            "!,6y!,6x-)!,8q(B!,92IP!,;E!,=8!,>T6*!,D[!,DV*!,DS!,DN!,F;!,F:!,F9x!,G1!,HC4!,H@1))!,HG!,HE+)!,LE-!,N"
+            "Z!,NL@!,NQ!,M}l+!,N^,!,N_5*!+*X!,U~(_p[!,ZU!,ZT!,ZK-!,ZN!,Z84!,Z=5.I!,]i1!,cAB!,cP<!,c7!,bso!,boV)*!"
+            ",dZ!,cc!,cHD!,bzY!,cJ!,bx!,d:!,cg!,c]!,c3S!,c+2!,ja!,l9!,l3;!,l..0!,l*5!,p_!,qt(!,qd!,t5:!,vDM!,v_0!"
+            ",vE,:.!,vY!,vO!,v<-!,v>H!,|mIU4!,}j1+!,}r,!,}k*!,}m0!,}o!-)A!-);!-)7v6!-*,6!-*2!-*-6!-)~!--_!--[+!-/"
+            "U!-1<.!-1@.!-1A+!-3h!-3Z;!-3d!-4t)!-64n(5!-6p<!-6t*!-6n1!-BS!-BN!-BJ-)!-BQ!-BM!-EJ+!-EK!-E</(.!-E19f"
+            "+!-F.)(P*!-I7b()!-LT*,!-LV0!-LZ!-Nr!-Nq!-_51+!*lO!*r}/!*s+(9!*s7!*r|2+!*s(@!*xP!*xH-!*y[.!*ya!*y_(u!"
+            "++_0!++R:!++M5!++F19(2!++Y.!++D(G!++H!+/<(!+34!+2~.!+3-*!+3*>!+2yI!+2w@!+3(!+2x!+6>!+:E/*!+:B!+:A!+:"
+            "@!+:66!+:5!+CE-!+F(Uy!+GPsp|)!+NO!+NDb!+NT!+M~P!+N-/.o!+O+!+Nz0!+Nt!+Nj!+N]!+NB!+N:Y!+QW(!+WKS!+WV3*"
+            "7!+We!+WG4!+WL!+WEQ!+WN(!+W=!+[P[8!+_}!+_o!+_m(5!+_j;!+_s!+a=!+h}!+hU!+hBE!+hH!+h;I!+gn{!+h1F*!+hF!+"
+            "h:N4!+hE-!+hC!+n0Sw!+oT;R!+x94L!+xN3!+w~4R!+x^!+x<!+x/L!+xR!+xCN!+x--P7!+xB!+x>4!,)=27!,)T!,)8F!,)L7"
+            "!,)V!,);A!,)N!,)5J!,)F!,,*@!,/(5!,/0!,//!,2c!,2M!,2H1!,2Q!,23!,21B)(!,5k)!,7J!,798!,7;!,7:0,!,7=!,7<"
+            "!,:((!,;Q7!,;]!,;T,=!,;a)!,;R0*!,;X!,=9!,@/J!,@8(!,@-!,@*!,>t<)!,>w!,Bs,)!,d.!,Ca!,Dk!,Di-!,Dc2!,Dm!"
+            ",FC(!,Hrr!,HZ5!,Hb!,LW))!,O9!,Nv@!,N~5!,NW!,Tm!,Th(/`!,UQ!,UM!,WU)V!,X-!,Zr!,Zq/!,Zf0,!,Zl5(!,Zg!,]["
+            "k!,e/!,d{!,d@!,d3m!,dj,!,dLK!,d_!,d>!,d7T)-+!,dI!,jd!,jb*!,lTB!,ld!,lc!,l[!,lY!,lV.(*+!,pa!,r;!,r0,*"
+            "!,r4,+!,q}2!,r.!,tOp!,vu.(!,vp*.>!,w/!,vmf!,v{;!,vw!,vl3!,vv4)!,vGR!,|nP!,}>j!,}~(!,}{!,}i8!,}y*!-*C"
+            "!-*A0.+.!-*L!-*F)!-,kz-!--b3!-/X:!-1Z!-1Y0!-1Q9!-1KA!-1`!-1V/!-1^!-1]+!-1M*!-3x,~!-4{!-4z!-6.!-7HH!-"
+            "7I,*!-7OE!-7]A!-7c!-7E<+!-7V!-7J-C!-BW!-EX!-ET(a!-F5!-F3(U+!-Fe!-Fb!-GmF)!-I}()!-Iw/!-Iy!-Lj!-Lb0(!-"
+            "Nw!-Nu*!-RP!-XZ!-^J!-`+,4!*sb.!*s`!*sP>!*sT!*sO!*sI)H!*sHC!*u1!*vo!*xT!*xS!*zX!*|)!++~)C!+,A!++}>!+,"
+            "/*+(!++wG0!+,1/!++v!+/C!+/A!+3L0,7!+3b!+3P3!+3T!+5)P!+5O)o!+6A!+:f,*!+:[!+:Z)2!+<O!+=d0!+=g+()!+=h)!"
+            "+=eV~!+Ca*!+F7/!+F1)!+F0!+G[*]eRr!+N}!+Nu3T!+OB(!+O>!+O9!+O7E!+Qa!+Xk!+X:!+X6y!+X[!+XBC!+X3=!+Wmb5!+"
+            "[VW_!+]f!+`1-!+`,!+i.3!+h~T!+iAM!+i_!+i-D+!+i=0D!+ia!+i@G!+i8E!+i5!+n2*!+pt!+yw!+yW!+yA<!+y6^<!+yd3!"
+            "+yR!+yEH!+yB!+y1>S.!+yv!+yg!+yX=+!+zw!+yn!+y.<!+y4!+xeS!,*.,!,)n4!,)u5!,,.}+!,/53!,2W!,2V.-!,2a!,4M!"
+            ",6/!,7r!,7W!,7U!,7S1!,:+)!,;{!,;t)!,;W!,@d!,@A/3!,@K!,@E!,C0(!,C/!,D}*!,FN!,FMm)!,IF!,I9!,I/!,HpJ-!,"
+            "I8!,I3Q!,I+!,I(!,L`+(!,Oc!,OW!,OCI(!,OGR!,O[!,OY!,OX0!,OIE!,O]*!,OTM!,Oo!,OS!,To!,V3(!,V2!,W^!,WYU!,"
+            "ZPX6!,[2)!,[)*!,]<:441U!,ex!,en.!,es!,eG,;!,eJW!,eg/:!,e=T<!,ey!,mE!,lxG!,l~*6!,ltf!,m<!,m.!,rP6!,rQ"
+            ",!,rU,!,rEZ!,rL!,wZ!,w@9,!,wA;!,wG8-!,wY*!,wL!,wE04!,|vK!,}Bp!,~1(!-(xV!-)L!-*_!--x!--v*!--w!-/]!-1p"
+            "!-1h+.!-1i,+!-1m!-1k!-4(!-3~-!-5/*!-51!-5.!-83/,:!-8R!-86@03!-87<!-Ba.(!-Bc)!-Bd!-EY*!-E[Y-V!-H<0!-I"
+            "cI(!-Kr){).!-Lw!-O.!-Qt(_!-S[(!-Xf)!-Xe!-_.!-`Y6!*t(!*s{!*sv!*sp+0-(!*t)!*vW!*xX((+!*x[!*ym!*|.!+,X4"
+            "!+,d!+,]4!+,_!+,SR!+,y0E!+,a!+,Y(!+3WG!+3v<!+3t9!+4*!+3~!+6E!+;7!+;)7!+:z>!+;6!+=t!+=r!+=o)!+@>(!+Cz"
+            "!+Cq!+F>!+F;)!+Gk!+Gc,!+Gf-!+Gi!+H|Qo!+J=!+OV!+OG.!+O<!+O4U!+O]!+OP!+OK:Q!+OqC!+OoF!+O{1!+OuB!+Qe!+X"
+            "L-1M;!+Xl/H!+Y2!+Xw);!+XvD!+Y:!+Y8!+X~9!+X}08!+[Y)(!+`=!+`:0!+`A!+jb!+j^!+i|AE!+jW!+j:L!+jQ!+jH!+j06"
+            "*!+j*L!+n9!+n7!+o8I(!+z,f/!+z><!+zBZ!+z[!+zIE!+z]H!+zi!+z_!+zR[!+zF!+xn!+z^!+zN!+zM!,*94,!,*C!,,Gn!,"
+            "/@0!,2]J!,2w!,2r)!,5t!,7k0!,7j,)!,7l(!,99HR!,<.!,;~,,!,<+!,@n!,@h!,@]7!,@a>!,@_;!,E7!,E4+!,E5!,E/+!,"
+            "FS!,FR!,IR+:!,IY9(!,Ig!,IET!,Lq!,P1;!,PA3!,P);!,P.2!,P4!,P++2!,OEdA.!,Tt)acf!,[F((*!,[E!,[C!,fqN!,ft"
+            "!,fGg(!,fm!,fk9!,f{!,fn!,fEb!,fX.!,n2!,m{)!,mg-9!,mo!,m`!,m^!,mR.!,pc)!,rn!,re2()!,rh!,wq=!,w|!,wy!,"
+            "wI_U!,wg>!,ww!,wt!,weN!,x+!,wk*J!,|W)F!,~A!,~>/!,~E/(!,~C(!,~<5!,~B!-(zZ+!-+7!-*s4,!-*rB!-++)!-+*!-,"
+            "s!-.*!-.(+1!-.3+!-.)).!-1y,!-1x,1!-4@!-4<!-461!-5B))!-5=!-9+!-8x!-8t[!-8ia!-8~!-8p0=!-9-Q!-8o!-Bm+!-"
+            "Fp)()!-GwU!-HL+!-J71!-J2!-Kv!-Lx0!-M)-!-OK!-O=6!-OI!-O>+!-O@.!-Q|`(aF!-S_[!-T3!-Xx*!-Xu!-^r<7!+4)!-`"
+            "q!*t6-!*t8!*t4,!*uPR[!*xc)!*yp!+--95!+-=!+-8;!+->!+-<!+-93!+-D!+-A!+-6;!+4C!+4@0!+4G!+6F!+;L>m!+=vF!"
+            "+H~!+P<!+Or@!+Okl!+PA/3!+PS!+Qg!+YS!+YO1!+YI(F!+YR*!+YP2!+YM:)!+YL!+[X!+`V*!+`I2*!+`H!+j|!+jw)G9!+kA"
+            "!+jx2F!+kJ!+k3!+k/!+jtR!+k0!+nCF!+pE!+{[!+{J!+{9J!+{<E!+{@34!+{R!+{O!+{>!+{8;!,*Y2.)!,*d4!,*T<2*!,*_"
+            "(!,/Z!,39.!,35.!,3;mR(!,8(+)!,:1!,:/!,<A!,<>(-!,A4!,@}9!,A3!,CI!,EF(!,E>-!,ED!,F_!,J(a!,IoC!,J*-/!,J"
+            "5!,L|(!,P].!,PZ:/!,Pq!,Pp!,P[.!,Txbg(!,VBc!,[_!,[T!,[S|4y(!,gN6!,gLH(!,gG-L!,go!,gc!,n3D!,nO+!,n=!,p"
+            "i!,s1/!,s,-!,s(!,t^!,tY!,xE;!,xJ-6!,x:2.7*(!,xV!,xL-*-!,|w)N!,~U!-+Q!-+=*5!-+F!-+B!-.I!-.<0!-.A!-/b!"
+            "-/`!-2.!-2-+!-2+1!-23!-4D!-5M!-:1=!-9`d!-:A!-:3!-9dW!-9l=!-9x=!-:2!-9}A!-:*!-B{!-Eh()Sb*,!-Fy-!-F{u("
+            "1Z!-JG/*!-JN!-JD3!-J:!-L~@!-M5!-M2-!-M1!-O[!-OP6!-Q}+h!-R]d!-TV!-Y05*)!-Y-0!-_K!-_G!-aV6!*tO!*tD)8!*"
+            "yr!+-d!+-U7!+-Z)/!+4W!+4U!+4S!+4P!+;`!+;Y!+;S!+<T!+>hY!+DC!+DA*!+D>!+FH!+I)!+JF!+PT!+PM,G!+PV!+Qi)!+"
+            "Y]!+YX5/7!+Yu-,!+Yq2!+[g(!+`j!+`g!+kj;!+knF!+l/h!+l6!+khA!+kz7!+nF{TV!+{rA!+{y(!+{u0.+!+zo!+|/!+{{/!"
+            "+{oA)!,+,!,*{6!,++!,+*/!,+1/!,*|~8!,/c)!,3G.!,3D)!,8:!,861!,:4!,<T!,<K-!,<M!,<H-k!,AD*!,AA!,A;9!,CJ*"
+            "!,EP!,Fd!,JW-!,JN!,JG<!,J/!,M0!,M,)+!,M/!,M)+!,Q*7/!,Q3!,Q.8!,P~9!,Q-;!,Q=!,Q0,6!,Q11!,Q+!,TB!,VG0!,"
+            "Wq(!,Wp!,Wo+!,[r!,[o!,[f/!,[l!,[k!,[i3!,[jRI!,^s!,hY!,h2!,h,F!,h@*C!,hJ!,h5I!,h8!,jm!,nr8!,neG!,nx!,"
+            "n]7!,nl5*!,sC!,s=5!,s@,!,t`!,xn0))!,xj=!,x}!,xd3!,|L!,|J]!,~[*!,~^!,~Y*!-)`!-+V)!-+U)!-.R!-.L+*!-.M!"
+            "-28!-26.!-2:(!-29!-4I!-5_!-5Y!-5W!-:`^!-:9v!-:]C!-:^!-:)!-;:!-;(!-:n<!-:m!-:g!-C3((!-C1!-C/!-Er.Fo)!"
+            "-Hb[!-J^!-Ky!-MM!-Op!-On!-Tt!-Tq!-Tp*!-YW+!-^Sm6!-_O(!-_N!-`]4!*|`!+-kA!+4[!+4Z!+;h!+I:!+Poy!+Z,!+Z*"
+            "3/!+Z2(!+Z/!+]F!+`ms!+lG!+l@>!+lO!+lL1!+lB(!+nIA`!+|M)!+|B/!+|=>!+|S!,+A()!,+=!,/j!,/h!,3E@!,4_!,8K)"
+            "!,8G!,<_)!,<](!,A[!,CQ!,EZ(!,EY!,Fi(!,J|!,Jx*!,Jo,!,Jr!,M7!,QQ(0!,QW.!,QO.!,TF!,VM)!,Ww!,Wv!,[y)d!,i"
+            "(!,hXL*!,hy!,h`1!,hi!,hU!,oK!,oH-!,o;!,t8Tk!,y18!,y5!,y4!,|[!,~g!-+g1*!-+r!-+m!-+c!-,y!-.W+!-2A!-2<,"
+            "!-5g(L!-;Q!-;G338!-;l!-;j+!-;U)!-;T!-C=)!-C9,!-FM!-FG!-FD)*o!-He*.u})!-Jd),!-K}!-MV(!-MU!-MF!-Ni!-O}"
+            "!-R/k*r!-Si!-Sh!-U9!-U8]!-U7!-U/!-Yn3*!-_S^>!*tX!+-{!+4a(*!+={!-aY!+Gu!+P~,!+Q+!+Q*!+Z86!+`q!+`n!+lz"
+            "!+lr!+lo!+lh!+|`+0!+|_*!+|Y*!,+L.ts!,/k)!,3[4A!,5|!,5{!,8T)!,<i!,Ag!,CT!,Ee!,Ec!,K8(!,K2,!,K10!,Qi)3"
+            "!,Qg(!,U-!,Qq!,U`*!,Ub!,]-!,iC!,i64!,i.6(9!,oW1/!,oU,!,si!,sh!,s_/!,yKC!,yc!,yS8!,yX(!,yP:!,~j)!-,3!"
+            "-,)<!-,-!-+z5!-,+!-.c!-.]!-/g!-2D(!-5m!-5j!-<I!-<85!-<*,;(!-<=3!-<423!-<>8!-CF!-EuWp!-G<c!-IHG!-Jv!-"
+            "Jp*!-L(!-M^+!-P.*!-R}!-UX!-UW!-UF,!-ZP!-Y~8!-Z0)!-^Z,!-^[I!*yu!+-~6!+.5!+.3/!+4g!+;p*c!+=|!+DP!+Q-)!"
+            "+ZQ!+ZM,!+`wj!+m*!+},!+|u)!,+V!,/n!,3n!,8W*!,At+)!,Ay!,FlW!,KG!,K=1!,M@(!-/h!,Q{!,Qz-!,TJ!,VT!,]/!,^"
+            "h!,iU!,iS@!,iT3,!,ib*!,oq(!,sm!,tng!,y{!,yw!,yq0!,yj3!,~q!,~o!-,A!-,8+!-,9!-5p>!-=*!-<l!-<f!-CK!-GF!"
+            "-L0!-Mk!-Mj!-Nl!-PD,.!-PN!-V-!-U~!-^Ae[pX+!-a)!*t](!+.A!+.@)!+5A!+@G!+DT!+Q1)!+ZV!+ZU!+[z!+`z!+m90!+"
+            "m8!+oG!+}:!,+b!,-C!,3u!,3s!,8_!,<u!,KK!,R6!,R3!,Uf!,ir=!,iu!,p)!,p(!,o~!,o|!,ss)z!,z(*-!,~u!-,B*!-,C"
+            "!-.ny!-5v!-=A,),!-=K!-=E!-==!-CL!-GN(!-GH!-Il!-K(!-J}!-Mp!-P_!-P]!-PY!-PW!-R=!-So!-Sl!-VH!-V@!-Zw,5!"
+            "-[)!-^f{Rl1(!*tb!*ta!+.H)!+.I!+<Y!+D[!+DY!+I+!+Q4!+Z^!+mI!+nK!+}@.!,/s!,4,!,6(!,8d!,8b!,CV!,K[!,KZ!,"
+            "W~!,W}!,]4!,s{!,sx!,uZ!,z4!,~x(!-,I)!-.p!-4X!-=W4(!-GS(!-I.!-I,!-K,!-Mn!-Po!-Pg!-RAq!-Ve!-VL4!-VV!-["
+            "E+!-`Ra!-a2R!+.L!+D^!+Q5!+Z]/!+Zd!+`}!+mO!,3y!,Fo!,K`!,K_)!,R:*!,R;!,]7!,j<.!,p7!,z>!-2J!-2I!-=w!-=t"
+            "+!-H(!-K0!-Mu!-Pt(!-Pq!-RB(!-R@!-Vp*!-Vr!-[W!-^h~!+.Q!+4l!+Zf!+}M!,8g(!,<y!,TNa!,p<*Q!,zH!,zG+!,^y!,"
+            "~}!-5|!-=~!-GX-!-GZ!-I1!-K1!-Py!-S;_!-V{!-[l(!-^D(!-_{!-a@!-a:!+G|!+mU!+}R!,Kh)!,pB!,tt!-,Y!-5}!->/!"
+            "->-!-K2!-Mw!-REv!-_>!+}S!,<|!,zO!->4!-I4!-P|*!,RD!,zQ!-,c!-6*!->:(!->9!-W<(!-_k!,|`!-><!-]6!,+o!-Q-!"
+            "-SK!-]7*!,Kn!)hX!)gL(!)e_e(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "((((((((5(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((!(4A(!"
+            "(4-<((((((.((((((((((((((((((D!(4d(((((((((((((((((((((((((!)AX(((((((((2(((((((((#~#s!*keB!*vq!*zA!"
+            "*{T!*k(,do!+.W!0s/!+@I!+IQ!*k0!*uW!*k/H!*laW.!*m@!*ui!*yy!*{=v!+/K!+5/Q!+>@!+E0!+]q!+oHAq!,,/!*kS2!*"
+            "ma!*mT4!*mY!*mU!*mR!*w1!*zCX!+/M(!+5D@!+<[*!+>BQb!+@N!+E5!+F^)!+JR!+Q>p!+pUI4!+q)!+p|!,-J)!,/}!,C[!,"
+            "X3!-D2!*n01;!*mnG!*mj6!*mp8<!*m{*E!*n5!*m}!*mmF!*v+!*w8!*w..!*xx!*zI!*zFVf!*}.!+.b!+.`x!+/U1!+5jm!+6"
+            "T0!+6S*!+6O/!+</!+>E7!+@W!+@U(*!+Dg!+FR6!+H4@!+IR!+J_!+J^!+JX!+R<)-!+RB,!+RC!+R9.!+R:2!+^(!+]~!+az!+"
+            "au!+at*!+av,!+ax!+ao!+pXV31!+q9!+q41!+q5(!+}a!,,O!,-P(!,0*!,4t!,8u!,Eo!,TO!,^z++!,_()!,jR!,t0!-2S!-2"
+            "Q(*!-2N!-D6)!-D4*!*nz!*n_O!*nm18!*nbQ!*nv4!*ne>!*nP-3J!*u`R!*wB)*!*y((!*z/!*{46D(!*}X.!*}RR!*}n!*}A*"
+            "0!*}@M9!*}j!*}P!*}LK!+.o!+.h!+.f!+/m+.!+/u).!+52c!+7(!+6q/!+6p!+6g;!+6i!+6h@!+6z!+<i+!+>X)!+@i)!+@d*"
+            "!+@e0!+@f!+@b4)!+DhR+!+Fi!+Fg*!+Ff,!+H7@!+IV!+IT!+J[!+JZ!+JYE!+Jr-,!+Jk*!+Jm>!+Jy/+,!+J~!+Qqr0)(,!+R"
+            "i!+RR1!+R[!+RQ8.!+RX-!+RS)!+Zq!+^)+!+^,!+^+*!+b*)9!+b:!+b1!+b-<!+b24!+b0!+ofr(!+qd!+qR+A.+!+q]!+qZ!+"
+            "qTY!+qXB5.!+qQ4!+qP=:!+}d-!,,T!,-[!,-Y-*!,-^!,-V2!,01)!,0/(!,0.!,5-!,5,!,62(!,8w!,B4!,W2!,X>+!,X9)1!"
+            ",_;!,_:!,_00*)!,_5!,_.(!,}-!-0,!-/y!-2Y)+!-2X0!-2Z!-DE!-D<.!-DB!*kU!*og!*oJ0!*oK*.!*oD!*oB<!*oR!*oE!"
+            "*npt!*o7X!*oG/!*oF@3!*oc1!*oa!*oP:!*o8*!*uoF)!*w[!*wX(:!*wW!*y7w(Y!*{e)!*~Z!*~R)7!*~U-!*~=6+!*~7./!*"
+            "~8O!*~B!*~3!*~2a!*~5+!*~6!+.x)!+0E*!+0C!+0A-!+0F-1!+0K-!+0I(!+07-<!+58b!+77,<!+7Q!+74B!+7D!+78-.:!+7"
+            "33*/!+76:!+<;*V)!+>u*!+A3!+A)!+@|<!+A4!+A-+!+@{+1!+@~/!+A,!+@y/8!+A5!+A+!+EI!+EF,!+H[!+HU((XV!+I]!+I"
+            "[!+Jh.q!+KZ!+KMA!+K>Q!+K=4D!+KN+5!+KV!+KA*F!+KG!+KE!+K@!+K<:!+QJQ!+S8.E!+SJ!+S53;!+S9,!+S:3!+S4./!+Z"
+            "w!+]6:w!+^5/5!+^B!+^4//)!+^>!+^6;!+^J!+a0;!+bl!+bRJ+!+b],E!+bm!+bk!+bZA!+bs!+baM!+bx/!+bj!+bd+!+b_(C"
+            "!+me!+nk!+ni!+oth!+r(!+s,!+s+*!+rp!+rLF!+rCc!+rMA!+rX!+rP0*O,!+ri2!+rJ!+qv:!+ql!+ru!+rV!+sr!+rd!+r^!"
+            "+rFr!+rfB!+rh!+~-+!+}u5!+}v!+}t4,!+}r@!+}s!,,[!,-s!,-h4!,-f:!,-o)-!,-i,!,0A!,0=3!,0C!,0>!,0<3!,09!,3"
+            "|2!,52(!,51w3!,9Om!,:;!,::,!,=D+!,=E)!,=F!,=C!,B9!,B6!,Ci!,Er*!,GJ!,Kq!,MN!,W3!,X8G!,XM<!,X`!,XW!,]w"
+            "!,_LH!,_W!,_F!,_D*B!,_S.5!,_JD!,_a!,_T!,_M/A!,_PG!,_c!,_N!,jv!,ju!,js(!,|b!-05!-0./!-000!-08)!-2m)!-"
+            "2j+!-2k!-DN+!-DQ!-DO0!*pF!*p=5!*p*>)!*p9:/!*pR!*p3!*p+P!*p@6!*p2-!*p1[!*wk,!*y;)!*zehC!*{i*!*{k!+(7!"
+            "*~u3!*~yR!+(A!,`e!+(4!+(+P!+(36(!*~t!*~Cu!*~vD!*~E!+(]!+(-!+15!+0u(,!+0c2-!+0r!+0k+!+0f13!+0q!+0l!+4"
+            "wAo!+7e!+7b79!+7u!+7aE*!+8)!+7z!+7h5,!+7_51)!+7dF!+7x!+7q!+=,!+>}!+AV/!+AR2!+AQ7*!+Aa!+AO!+AM*3!+AY("
+            "!+AU!+AN!+AL/8A!+E*P((!+ER+!+G7!+G+!+G)!+Fy/)!+H9OPX!+Kl)CF!+L<!+Kz5!+K|)9!+L*!+Ku)E!+KXH;5/!+Qy(!+S"
+            "[g!+TB!+T+A!+T9!+Sx5=!+TC!+T.!+T,1:(!+T0C!+T1!+S}!+Z{)!+]8<!+^q!+^[8*!+^V1!+^]8!+^f6!+^W>,!+^i!+aJ(!"
+            "+cRY!+cY!+cKJ!+cLf!+cj!+cQ!+cH5N!+cv!+cq!+cF@!+cDm!+d1!+d)!+cu!+cS!+cJ<A0!+cCs!+cWO!+c^!+c>a!+cmG!+c"
+            "Z(!+cTO!+c]!+mh!+nm)ZH)/i(!+sj3!+so!+saE*!+sS!+sK!+rq!+su!+sE<I!+s[!+sR!+sAEM!+sB>G!+sD3Y!+sHA3!+sIB"
+            "!+sJ.!+~Q!+~8G!+~K!+~J!+~::(!+~C!,,1/(J+*!,,`!,-gB+*!,-|2!,.,!,.)!,/xp!,0`-!,0c!,0V!,0S!,0R!,0Q`!,0]"
+            "/!,0[,*!,0U:!,44)iA(!,6F*!,8otm!,:N((,!,:B+!,:E!,=2(F2(!,=Q2!,=[!,=Z!,=U!,=O7!,BB)!,BC!,B<!,B;!,Cy!,"
+            "Cq).!,Cr!,Ez!,Ex|W(!,Kv!,Kt(-((!,MT,!,MR!,TVb!,U5Yr.(,K!,Y,!,XrA!,X|!,Xs!,Xm5!,XpF!,Y-*!,Xu2!,Xt-/6!"
+            ",Xx!,]UJ!,_@nM!,`P5!,`>@!,`+!,a;!,`B!,`,F!,`C!,`78*>!,`R!,`M!,`G!,`A!,`:!,`6B!,`J!,`D!,j}!,jz/!,jy!,"
+            "pH4A*!,pq!,u0Y*!-)(!-0G!-0E4!-0D!-3V!-2x)=!-3)!-2y0+!-3,!-69!-68!-Dj!-De))!-D`+!*qB!*q()365!*q>!*po!"
+            "*pnh+!*qP!*pp(H,+.5!*qS)!*q1!*u)c!*ud`!*v>(*-!*x1!*x*!*wy3(!*w|4!*yIj!*{q!+)O!+(a^!+):!+(f3!+(c_!+(~"
+            ",+!+(jN!+)-!+(pA!+(z!+(v(!+(_V!+)+/!+/+(!+1M!+2_!+1V!+1S!+1:3!+1=!+1<!+18!+160/0!+19/!+5:e!+8G!+8D>("
+            "!+8C!+8</!+87;<!+<Fd-!+=0!+>2|!+@.!+As:!+Au*-0!+B)!+E[!+EZ!+G/-!+G1)!+Hg!+Hd`!+L;!+L84!+Kv!+M+!+Lh!+"
+            "L`9!+LaD!+Lc9-!+Lw!+Lg<!+Ln!+QOU!+T(Fo!+Td@(!+Tn4!+Vr!+Tq9!+U+!+Tt!+Ta@!+TlL!+U5,!+TeB!+TkO!+U2!+TpG"
+            "!+Tx/!+[-!+[)!+]U!+]R(!+]Q!+_.<!+_+1!+aM(!+d[!+dVW!+do(/7+!+dRC!+dXA!+dh))G!+e*!+dq!+dY!+dN)9)-G!+dw"
+            "!+db!+d]!+ml*!+mm+*b!,X+!+ns!+o|!+oz+!+oy!+ox,g!+tg!+tO(9!+sN}Y!+tD12)J!+tz!+v0!+tl.!+tJ0!+tL`!+t]3!"
+            "+tKK=!+sqbK!+tk)+!+sW!+tp!+th)!+tbC!+~w!+~n!+~l3!+~f!,T6!+~}!+~r!+~m3)!+~o!+~h!+~`((:!+~i:!,,2_!,,i!"
+            ",,h!,.G!,.A!,.:1!,.<!,.9/-!,0q-3!,0t!,0YS!,1*-!,0z!,0p0!,0r0!,0x!,0u(7!,3}(<(Tc+z8!,6Z0!,6`!,6_!,6U+"
+            "!,9)h}!,:g!,:[*!,:^8!,:]++(/,!,=p0!,=o:!,=|!,=u-!,=x!,=n/1!,=w.!,BL.!,BG4!,BK!,BJ!,BI!,D8(!,D-5!,D:!"
+            ",D7!,D))!,D*!,F)*!,F(-(!,F-!,F*za!,GS6!,GT1!,GW)+!,GX0!,L)4!,L/)!,L-,!,L*!,Mp!,Mo!,Mc!,M`1!,Mh!,Me3!"
+            ",Md!,Ma!,M^!,TZ,!,T])!,T[!,TYd!,U:Y!,Ul!,Uj!,VkP!,W7!,YO!,YG.!,YJ3!,YP,!,]WV!,]|!,a4!,a.>!,`qa!,`}Y!"
+            ",aA)!,`~!,`t-H3!,`s6!,``]8!,`n5!,`x>!,a0!,a*F!,aG..!,`v5G!,a(I!,jX!,jWy-!,kF!,k<+4!,k67!,k5,6!,k4H!,"
+            "kI/-!,kE*!,k=6!,k@+!,pJ(Q/(!,pz5!,py5!,pw;!,q/!,p|/!,uq!,|R7LQ!,}Y!-),)f)!-)n!--3)!-0c!-0Y4!-0d!-0`0"
+            "!-0a!-0Z!-3:1!-3=(0!-3D-!-3<*!-3;,/!-4a!-4_(!-6:4!-6@!-Dr*!-E}!-LP!-RNy!*lL!*r>!*r8!*r/!*r,)!*qx!*qp"
+            "9<!*qm,!*qfB!*qo@!*q8XB1)!*r1(!*qk!*qeV,!*q|!*qv!*vK!*x;)!*x<)!*yR!*yO!*zT!*{o!+*I(!+)f8*!+)^!+)SO8!"
+            "+)`!+)_!+)YJ!+)o!+)4N[!+)x!+)c6!+)V5,2!+/4!+/1!+1}A!+1d;!+1^@3!+1o72!+1z:!+1u!+1Pa!+1p!+1e6!+1g.!+1c"
+            "U!+1~;!+1iB2!+1s!+1k.E!+2/!+63!+98!+90!+9-9!+96!+8g!+8da!+9(6-.!+9+8!+9/!+8rB!+9*!+8s>!+8wo!+8m6!+8h"
+            ":L!+9B!+8v1,!+8qB!+<L!+<H|!+=E!+@3!+BO!+B;9!+BK-!+B<D!+B=A!+BV!+B@I!+BC8!+BP6!+Eq!+Eg!+G8*,!+G9(!+Hj"
+            ")!+Iz!+Iu0!+Lj-!+Lfa!+M91A(!+MY<!+Md+!+MR!+M:R!+MA:!+MI+1!+MJ!+Tj[M!+Ue!+U`i!+V*6!+V)!+Uz;!+Uq!+UQ@0"
+            "!+UPj!+UWO!+UOj!+U_P!+Ts!+V+!+UZ4!+Ud7!+Up!+UR!+[6!+]]!+_J!+_F!+_@!+_=*-!+aS!+ea503!+eT(i!+f<!+h=!+e"
+            "V]0!+f:!+e]!+e[g!+ew!+e_C!+ed!+eR.a!+eh!+eX4E!+e~!+es<!+eqC!+e`*=!+et!+er!+ee!+mv!+ms+(!+n|!+nz!+nx("
+            "!+nw!+pk!+uW!+uB0!+uJ!+wb!+uCf!+uz!+uNh!+ulT!+u`@!+uw!+un!+uUO!+ut(!+usA!+ub!+uTX*!+uQC!+uY4!+ua.J!+"
+            "ukR!+uo!+ue=!+uR!,(>:!,(;H!,(8@!,(4;!,(7E!,(A*.4!,(E!,(<!,(:<!,(G3!,,p!,,m(*!,.e!,._!,.N1.!,.Q!,.O!,"
+            ".F76!,/{!,1=)!,1<6!,1I!,1E1!,1H!,1B)*4!,1S!,1;;!,5X!,5W!,6n+!,6o!,6k(,!,6p!,9.!,9(s!,;.!,:{!,:y+()!,"
+            ";(1!,:q=!,;*!,>>1!,>@+!,>A)!,=sG2!,B]*)(!,B[/!,BY!,C_h!,DF!,DD(!,F2,!,F3!,H.9!,H-!,Gu2!,Gr)6!,Gh9!,G"
+            "m;!,G{))*-!,Gj0!,L9+!,L;4!,N0/!,N3!,N1+2!,M~!,M{@-!,N9(2!,N6!,Mz!,TbZ.(!,UDW()*(!,Uq/!,Us!,Vt!,Vs!,V"
+            "pT!,WB,!,Yn4!,Yo)9!,Yu4!,Yt*!,Yk9!,Ys,!,]hO!,^3.!,^4!,^2k!,b<:,!,b9!,a}!,avY!,awC!,b-;+!,axG<!,b)-08"
+            "!,bH6!,b7!,b*O1!,b46A!,b+O!,b3O!,ayL!,j_!,j[!,kp!,kh2!,kr+!,kk!,ka@!,kj!,kd,;!,ke.(.!,kn(!,pY`3:!,qT"
+            "/!,qL!,qC7!,qQ!,qJ6!,qK)!,qI4/!,q=.!,q@!,t4}*!,u2!,v8!,v/,!,u}!,|D)I(HP!-)3!-)1!-)/l-!-)q-)!--:-!--@"
+            "!-->!--90(!-12!-0p-2!-0q<!-3T!-3O-+!-3W(!-38>(!-3N!-4g))!-4d)!-6R/!-6W),!-6J<!-6P(3!-6N-!-B83)!-E;!-"
+            "E,!-E*-!-E.y!-H*!-Iq!-LR!-NZ!*rk!*re!*rd1!*rZ@!*rR0)6!*r6]!*rb!*rQ,!*u.!*vO!*z8!*z7!*{w*!+*f>!+*z/!+"
+            "*K!+,p!+*w!+*h!+*].N!+*UJ!+*g9!+*Q6B!+*S=3!+*c!+/6!+2U5!+2E,0!+2O,!+1w|!+2Q!+2H!+2G@3!+2c!+2Z2!+2e!+"
+            "2Y!+2X6!+68!+:2!+9n2!+9SP!+9x!+9QV!+9UQ.!+9oA!+8fv-4!+9]/F!+9T)67!+9i+1!+=p!+=R!+=P0!+=V!+=O+gL!+Bi3"
+            "P!+Bs1!+Bq!+BgD!+C).!+Be.@!+Bo!+BcP!+Bt!+Bk7!+Bj+!+Bd+1,!+Ew!+Et!+I5w!+J--!+MS!+MC:=!+MX!+MNy!+M}@3!"
+            "+N9!+N)F!+N,+)!+MKk<,!+NE!+N3,.!+R*!+UwE!+V<F>*.!+VP!+Y*!+W*!+VW==!+VcE*!+XD!+Vm!+VKG!+Vj!+VQ;!+Va!+"
+            "VO,,!+VX!+VUP!+Ve)!+Zl^*!+[H!+[@3!+[IO8(7J)!+_b!+_Q6,!+_V/!+_O/!+a;!+gI!+ffY!+fow!+g(!+f}.F!+fiI!+f~"
+            "!+fw9E!+gM!+g/!+ftN!+f_e!+hX!+fF!+gN!+g+!+fXw!+g4!+fcU!+g8!+f{K!+gG4!+fa!+fZ<(/5!+fd^!+fg<T7!+fY!+my"
+            ")+!+m|!+o(*)!+o)P[)(f!+v=s(!+vbRh!+w((/E!+vn;)D=!+v_>@!+w,8!+v~!+vESX1!+wI,!+vt!+vka8!+wX!+v|!+ve5K9"
+            "!+vjz!+wQ:!+wBL!+w>;!+vx(L!,(f!,(d8!,(@[*!,(i)!,(h7!,(e09!,(a!,,;6V(!,,x!,,w-!,.Y!,.RM!,.j6)!,.o2!,."
+            "u!,.n!,.k9!,.S!,1w!,1u+!,1t!,1_+.3+!,1m!,1l!,1f3!,1i9!,4D]i!,5a!,70!,6z.,!,6}),!,6w!,94!,91q!,;;(!,;"
+            "90!,;:,+!,;A(!,=)5!,>W+(!,>S8+!,>b+)!,>a!,>`!,>U+!,Bm!,Bl!,Bk!,Bi!,DP/!,DQ0!,DR!,F<v!,G2!,HD!,H40++)"
+            "!,H9@!,H>!,LH!,LD1!,LG!,NT>!,N`!,NO*8*!,NKF!,NX6!,NN)<!,NM5!,NJ!,T;(N(e!,UI(_!,WP!,WN(!,YS!,Y(!,ZC./"
+            "!,ZO!,ZG!,Z<7!,Z9!,];/0((2a()_!,a<!,b}RR!,bnPR!,c>!,c;@!,cNB!,bt)K!,c:!,bmk!,c4/!,c/O!,c8!,by*/G!,bw"
+            "i-!,c5[!,c_!,bpY!,c,M!,bu1AQ!,bqQ)!,br`!,c.2b!,c2K!,l21+!,l-7!,l47!,l75!,l67!,lD!,l18!,l+!,pO5!,p]!,"
+            "qmE!,ql!,qk/!,qq!,qi-!,qj-!,qex!,q|!,tH*!,tJo!,u7(!,vW!,vV!,vBH!,vI>(!,vM(4!,vQ0!,vS)*!,|kJ!,}5c+!,}"
+            "g0!,}l!-):!-)60x!-*4!-*.!-*(6-!-*0-+!-*)6!-)}!--R/*!--]!--I/!--H7!--J(5!--N-!--O/!--L!-1;.!-1=!-3lN!"
+            "-3j!-3e!-3b3!-3_)-!-3f.!-3k!-3i!-4r*!-4p*!-4q!-6h0C!-6j>3!-6v!-6s!-6g9!-6f!-6d0!-6kK!-6iB/!-7)!-6~!-"
+            "6l8!-B99!-BK+!-EG!-E=1(!-EC!-E@k-!-F-V!-F[!-H,+!-H.!-It!-Klk!-XW!-_m!*lP(Z!*s6).!*r~=-!*s-;!*s;!*s)8"
+            "!*s3!*s*B!*sC!*s/)!*vR!*xK!*xI*(!++B@!++K+!++J!++I:!++>;!++CM!++=:!+*bk-4!++U!++GR!++L3!++A!+/>!+3)<"
+            "!+3:!+2|!+2z!+2vN!+3+!+2{6!+3/3!+31!+2jN5!+5(!+:K!+:H.!+:=!+:;!+:4+!+:360!+:>2!+::01!+:7)>!+:<!+9j!+"
+            "=[)(o;!+CM!+C>!+B|C4!+CH!+C91!+CC!+C=!+Dx!+F+!+F*!+E}*!+E~!+GM.!+GN,!+GO!+Ht!+J7!+J5!+N+{(!+NaB!+Nl!"
+            "+Nh!+Nd@!+NeH!+N_>!+QV!-4y!+QY)!+QZ!+VRT!+VyM)!+WA>+67!+WW!+WM*I!+Wp!+WZ(!+WDB1!+WaA!+Wn!+Wh!+WB7N!+"
+            "W^)!+WC!+Vu]:!+WY!+WF!+[SKj!+_l-0!+_v!+_q!+_p6!+_z!+_^!+a[!+hN!+hG!+gv=;6!+g}-M!+gw0<)I!+h/(!+gs`!+g"
+            "q1P!+g,!+ha!+gr^!+g~W!+h+Z!+h@!+h([!+h3!+gy7!+guM!+h6)!+gpH!+gmu!+gz!+n/!+n.!+n,!+n+-!+n*!+o/!0s0!+p"
+            ":(!+p8!+p6(!+x2d!+xa!+w}Y!+x6!+x*(38/43!+xU+!+x5S!+xO!+xHE!+x=Q!+xJ3,A!+xq!+x0!+x)!+w|!+w{>!+x8F!+xK"
+            "E!+xc!+x.>!+x:!,)64!,)B8!,)P!,)0D,7-!,)Z!,)Q!,)1=!,)2/M!,)O!,)@*!,)304!,,@g!,,~,!,-+!,-)!,/--!,/,!,/"
+            "+-1!,/:!,26-(.!,2D-!,226(!,2A!,24+..!,4)F!,4G!,4FH!,5n!,5l!+hl!,78H!,7M!,7A.!,7F!,7C!,7B@!,7E!,7@!,7"
+            "6//!,98DP!,;K1(!,;H++6!,;^!,;J,;!,=+!,@(:!,@5!,@0!,>|8!,>}(C!,>{!,>qH!,>x=!,>s!,Bu-!,Bv!,Br!,D`.(!,D"
+            "a,!,Dd4!,Db/!,D_!,FG!,FF!,FBv!,Ha!,H_0.!,Hd0!,H`5!,Hl!,Hk!,H[>!,Hq!,H^!,LX)!,LU!,O.!,O,!,N}4!,N|-!,N"
+            "w;!,Nx/!,Ny7/!,O*!,Nz<!,Tl!,Tj!,Tf(+c!,UN)](n!,Ze!,Za>!,Z]4!,Z[.7!+a]!,Z_@!,Zh/!,ZDE!,]tT!,^E!,^A)*!"
+            ",fJ!,dB>H*=!,e:!,di!,dT!,dCo!,dk!,d2EX!,d^!,d]C!,dw!,da!,fa!,db!,d9*!,d6o!,dF^!,d4:!,d+!,c0!,dN!,d1:"
+            "!,d/Z8!,d;<!,dO-E!,et!,e;!,d=3!,d8!,d5^=!,dG!,d-^!,dWB!,dS!,lg!,l`!,lR<!,lU!,l0G!,mS!,lS=!,le!,l]!,l"
+            "Q>!,la!,r2!,q~)(7!,r7!,r6!,r(+!,t7=m-!,uB!,u>!,u=)!,u91!,w)7!,w2!,vk!,vHa2)!,w(5!,w4!,v~-!,|G6!,|UC!"
+            ",|p)H!,}9(p!-(u(P!-)C)(!-)D-(!-)G)!-*R!-*B3,!-*P!-*1A!-*E!-*D,2!-*M0!--j!--c)!--d,)(!--f0!-1b!-1N,,!"
+            "-1L!-3v!-3s)),!-3z!-3q*!-5((!-7Y1!-7A1T!-7DZ!-7pM!-7>D!-7WO!-7~!-7a8./!-7GS6!-7BK6!-7bJ!-7`,!-7^1!-7"
+            "C!-B_!-B[)!-BZ!-ER(!-EQ-`T*!-Fd!-Fa!-H3+(!-H2!-I|!-Iz(!-Kos*!-Ns*!-Nt,!-Qr!-Qp!-Sv!-X[*!-XX!-^H!-_q!"
+            "*sa!*sN*82!*sU6!*sW.!*sMA+!*sj!*s^!*sZ!*vS!*xQ(!*yf)n!*|(!+,Q!+,>!+,5-!++|:4!+,*9!+,+!++zK!+,-!+,(!+"
+            "+y!+3a!+3S;/!+3^!+3X!+3V!+3K>!+3Q41!+3f!+3M3-!+3RA!+3g!+5*!+6C!+:a9!+:j!+:Y<!+:_:!+:p/!+:g!+:e!+:`8!"
+            "+:c!+:b!+:^6!+:d!+<Q!+=f*!+@=!+C_!+C]!+CY0!+CV.!+CS:!+Cf!+Ce!+CZ!+CX8!+CU-!+F4(!+F/!+Ga!+GY-!+GV5!+G"
+            "^+!+GZ)!+Hx!+HwTp!+Nb!+N^AE:)!+O1(G!+OL;!+OT!+O3N!+O:1!+NqW!+OA!+O5!+Q`!+Q^+!+WdJ5)>)!+XU(1!+XX!+XIi"
+            "!+X0]!+XA!+X>!+X-/4!+X2W!+WxU!+XN!+X;39!+[WU!+`0!+`/!+`.!+a@!+a>F!+iD,:!+i2V!+i(B!+i>7!+hz/!+hwA!+hv"
+            "D<!+iB7,!+iP!+i6X!+iL8!+i,^!+iF!+h|>!+i3!+i0d!+i)!+hyZ!+iH!+i7I!+n3*!+n4|((K(c!+xgO!+y39J!+y:h!+y=[!"
+            "+yLn!+y](4!+y[K!+yU!+y/ETf!+y;!+y0h:!+yt3!+yy!+y-D.^!+yH!+y@!+y8l!+y`!+y>g!+yc!+yP8!+yKA!,)x0!,)z!,)"
+            "q,!,)s4!,)l2!,)r=!,,46m!,-0!,-.!,/41+!,/=!,2U8!,2e+!,2f!,2Z.!,4I)(!,5r:!,7a!,7R+0!,7[!,7T1!,9X!,;x!,"
+            ";s0!,;y!,;e9!,;f6,!,@T!,@L1!,@O!,@J!,>vU!,@@.!,@B3!,@D)!,C:!,C,(2!,C7!,C6!,C5+!,C*1!,C2!,DzG!,E(!,D~"
+            "!,Dw!,Du!,FL*(k!,I,;!,I..!,I4-!,I1!,I06!,I2!,I):!*xU!,I=2!,H}!,Lb+!,Lc!,La!,ON72!,OJ.>!,Oh,!,ODY!,Ol"
+            "),(!,OV1!,O<N!,OF./!,OP!,OHP!,Tr!,V5()!,V1ob!,W[!,[3!,[0!,[-+-!,[6!,[5!,]l!,eE4!,eO!,eMC;!,eq!,eZ)!,"
+            "eY5!,ec43!,eX!,eH>G!,eK1;!,eP!,eB[,!,eI5-!,eVV!,eFFA!,eN`!,f,!,f*0!,e_!,e>!,jg!,m8!,m(,l!,mF!,m3!,lz"
+            "*!,lu)P!,m1<!,mD/!,l|9!,m/*6!,lnP!,m6+4!,m+(8!,m)!,lv=!,lm!,rT!,rD1(/+!,rK5!,rS,!,rM!,rI!,rH!,tP+!,t"
+            "R!,tQt)!,uF!,w`!,wM!,w>.!,wC.!,|HS(!,~5!,~//!-)M!-*l!-*e!-*b5!-*`4!-*f+!-*i!-*h!-*a)+!--t(!--r!--q!-"
+            "42!-4++)!-4.!-4,!-4)1!-40!-4*!-54!-5,.!-5-!-8b!-8a!-81M!-85N!-8P=!-8IA!-8V8!-84F!-8:Lt!-8J!-8=:4!-88"
+            "2A!-8F!-8B-45!-890J!-8Y!-8G!-7=!-E_*!-Fk!-GoM!-H:+,!-HA)!-H;0!-HB!-H@x!-I8r!-Kp(}!-Ln.!-Na!-N`O!-N})"
+            "!-N~/!-O*1!-QvZ+!-SX(I(!-Sz!-Xc(*!-^p!*sz+U!*ss5(!*sq/4(!*sx4!*x](!*yn!*yl!+,s!+,m1!+,`30!+,t!+,q9)!"
+            "+,k!+,^1!+,V9!+,c!+,T7!+/E!+4,!+3u;!+3x*3!+4-!+3}!+3y!+5+!+;-!+:y0!+:|!+:{4!+:}1!+:~/-!+;31!+@B!+Cv!"
+            "+Ct/!+Co7!+Cp)2!+Cy,!+Cw+!+FF!+F9*!+F8!,PE!+Gd**!+H}!+J:!+Ol!+Od!+OYa!+P:!+P,!+Oj9!+OtD!+P7!+P)!+Os@"
+            "!+P+!+On!+OFv!+Qd!+XQ)N1!+Xi9,!+Xs!+Xo!+Xn)>!+Y,!+XKr!+X|!+[Z+!+[^)`(!+`E!+`@!+`80,!+`9,!+j=-8!+iy:E"
+            "!+j.!+ixe!+j<!+j)!+ivb)!+j;Q!+j/!+j+N!+j4!+i{!+k(!+jF!+iz<9!+j9!+j(F!+jB;4!+jM!+j3X!+jE!+j1J!+n:}!+o"
+            "7!+o6+!+pA!+p@!+p>*!+z.!+yj!+zm0h!+{*!+z|!+zx*!+zP!+z<_!+zHe!+ze!+zZ=!+zCE!+z@!+z=.f!+{+!+zK!+yC!+zO"
+            "19!+zUQ!+zAa!+zW==!+zQ;!+zX8!,*M!,*J!,*5<!,*:!,*463!,*7/!,*8-!,*;0!,*623!,-3)!,/J!,/D3((!,/O!,/M-!,/"
+            "L!,/K0!,2{)(!,2z!,2u!,2q/*!,2p!,2m!,4Q!,4P!,5s!,7p!,7i!,7d+!,7g.!,7e5!,7f!,9;((!,9:!,<-)!,<)!,<(!,@p"
+            "!,@^;!,@o,!,@q-!,@k!,@f(,!,C<.!,CC!,C>-!,C=!+na!,E1!,FV)!,FW!,I];!,Id!,IQJ!,IT18!,IZ!,Ll*+!,Lr!,PI!,"
+            "P,6!,P8!,P(1J!,PL!,P77!,PC!,PB!,P@!,P0!,Tu_+!,UVi!,V>!,V=)!,V9)!,Wd*!,[N!,[J!,[I!,[@4!,[D!,[B!,]mb+!"
+            ",^S!,^Q!,^O*!,f~>!,fi!,fYQ!,fh!,fc+9!,fdE!,fv!,fTX!,fS5+!,fM_!,fKK!,fP!,fD/0=!,fC!,fBU!,fWR!,fw8!,f["
+            "!,fVI!,fOd!,g)!,f@(/!,fH1G/7!,fe5=!,jh!,m]4(:!,o<!,mz!,m_!,mZ.!,mX6!,ma!,mW46!,mq!,mV!,mT8!,md9!,ms5"
+            "!,mu!,mc0!,mUT!,m|!,mi,)!,pb!,rc./!,ri3((!,rd7!,ro!,rl!,rg!,tU)!,tVs*!,uJ!,x-!,w{!,wmC!,x/*(!,wpD!,w"
+            "s),:!,wx!,wo*D!,|I6k!,~F!,~@!,~96!,~:*1!-)W!-)S,!-)R!-+,*)!-+01!-*x-!-*y!-*t/4(!-*w!-*u-!-*v0!-*z*!-"
+            ".9!-.1!--|)-*!--z(!-2,!-2)!-2(!-1w+!-4>!-4:!-48(/!-45/!-5@(+!-5;()!-5:!-96!-9)(!-8}A!-8sAJ!-9F!-9>8!"
+            "-9=-!-92K!-9(N!-90!-9.-@!-93/!-9/>!-9E0!-97)!-8rT!-9,!-8q!-B:X!-Bk*)!-Ee!-EcYZ*!-Fn!-GqX+!-HIq!-I:x!"
+            "-J30*!-J>!-J6!-J13!-Ku!-Lv!-Lh>*)(!-M,!-OJ!-O:)+(!-O;!-O64)!-O83!-O9!-Qxb!-RZ/!-Rb!-Ra~!-S^L4!-T5!-T"
+            "*7!-T9!-T4!-T,!-T(/!-Xn!-Xl*)!-Xi7!-Xr!-Xk)4!-Xw!-Xv!-^Kye(!*tA!*t7+*!*t5!*vY!*z[!*|_!+-E!+-45,!+-:!"
+            "+-71,!+-2A!+/G!+/F!+4J!+4>3!+4A!+4;/!+4=1!+;F))-!+;C!+;B!+;>-9!+;I-!+;M!+=u!+D2,!+D/!+D-5!+D6!+D4!+D"
+            "0!+D.1!+D3),!+FD(!+FC0!+Gr!+Gp!+Go)!+Gn!+I(!+JE!+O~2!+OwW!+P>9!+PL2!+PE,!+PC!+Om!+Yf!+Ye!+Y_!+Y^!+YW"
+            "!+YK!+Xmc@@!+Yh!+Zmu!+[aN!+`X!+`N)1(+!+`M!+`K!+`J9!+a_!+jsZ!+k1F!+jq_!+j}G70!+kD!+k9!+jgZ!+jz+)Q!+kM"
+            "!+k8!+k7,C!+kR!+kI!+j{J!+k>!+k=!+k5(!+k.!+n>!+n=)z*(E!+o]f!+pC*!+{FF!+{;L!+{U9!+{b!+zL!+{^!+{V!+{6T!"
+            "+{A!+|H!+{=03!+{E!+{CM!+{X!+{Q!+{:O!+{DJ!+{H*!+{I!,*a!,*^!,*Z!,*SF!,*[(10!,*f!,*c/!,*XC!,*W1;(!,-8(!"
+            ",/[!,/X(,!,/W-!,/]!,2sC-!,31!,3/*3!,4T!,5u!,7z!,7x+3!,7~0!,8)!,7}!,7{!,9[S!,<:*+!,<<!,<;.(!,<5+!,<7!"
+            ",A)3!,A1,!,A*,!,@~-(2!,A+(!,CG!,E<+!,E@!,FZ)!,FY!,FU-!,J-,+!,J,!,I{7!,J)58!,Iz=!,J1!,J+6!,I~.!,Ly)*!"
+            ",Lw(!,Pe6!,Pj!,P_:(!,Pf!,Pa5!,Ph,/!,P^+.!,P`.8!,Pw!,TAa(!,Ty`gd!,V~l!,[]!,[Q/2!,[a!,[V,!,[W/!,[^,!,["
+            "Rt!,^V((!,gZ!,gIN!,gQ-5!,g]!,gD-F!,gEI!,gH4!,gKD!,gBE=!,gRH.!,gY9!,geT!,gk!,gb!,gX8.!,ji)!,jj!,nL!,n"
+            "@/!,nD!,nC!,n8!,n1<)!,n)5D!,n52(3!,n47/!,nK!,n9!,r|/1!,s4(!,s.1!,s).!,s*3!,s3!,r}!,uO!,x>)7)(!,x;`!,"
+            "xC!,x=8!,w}=*.>!,xN3!,}G(!,}F!,~V!,~O*!,~Q*!-(y)`)!-+@2!-+E/,!-+C-(+!-+<6!-,v!-.D!-.;.!-.@.!-.E!-.B!"
+            "-2/*)2!-3`b)(!-5N!-5K(!-5H)!-:8!-:/!-9p>!-9n0!-;6!-:J+!-:,/!-9z!-9in!-:>!-9v!-9u!-91{!-9bS!-9{!-9a!-"
+            "9_f!-9jJ!-9gR7!-:G!-:;!-9|!-9t!-9s!-9f2!-9h!-9cC!-B|8!-B~!-By(!-Bv0!-Bu/!-EjS`.!-F|!-HZ!-HX!-HU!-I]/"
+            "f!-JF*!-M;!-M6/)!-Nby!-OZ!-OS!-OR3!-OQ.!-OW!-OU!-Q~-!-Qy.d+!-Ri!-Rgev,)!-TA)!-T@.8!-TW!-TU!-T>C!-TB2"
+            "!-YA!-Y20!-Y9!-Y/<!-Y8!-Y31!-Y+0-!-^P!-^N(O!-^vP(L@S!*tK!*tJ!*tG)!*tE0!*yq!+-i!+-b(!+-[!+-Y!+-X!+-S+"
+            "!+-T)!+4X!+4V!+4Q*!+;]!+;T4!+;R0!+;V!+;U0!+;^v!+=w(!+D=!+FI!+FG!+JG!+JD!+PN!+P@.S!+Pl,!+Pp+!+Pj!+Y~!"
+            "+Yx!+Yr/!+Ys+!+[f!+[e_L!+`c!+kw0!+kkL!+ks=!+l.-!+l1!+kq3!+kx.!+kmM!+l7!+k{!+kiO!+l-!+ko.-!+nE{!+pI!+"
+            "{f!+{Bt!+{n6!+{v8!+|*!+|)!+{x;!+{w,-!,*}7!,+-1!,+)3!,*~!,/f!,/a(!,34C!,3I!,3-B*+!,3C1!,4Y((!,4X!,5y!"
+            ",87,(!,8;!,9Dn!,<V!,<L.,!,<W!,<U!,<R!,<Iq!,A@1,!,AH(!,A>:!,AF,-!,CN!,CK!,EU!,ET!,EO)!,EM-!,Fc)(!,JU1"
+            "!,JB5!,JO!,JK:!,JD>!,JC6.!,JS!,JQ!,JH,0!,J@(G!,JZ!,M8!,Q)6-!,Q/!-J`!,Q4!,P}G!,Q<.!,P|K!,Q,2!,Q25!,Q6"
+            "!,TCc!,T}!,T|!,VH!,VFc!,[g0/!,[v!,[q)!,[hU!,^]!,^[)!,h1!,h.6@!,hD2!,h9@!,h)Q!,hI+!,g|,4@!,h(!,g}!,g["
+            "`/!,h4.3+!,h/I!,h0-!,h3!,g~!,g{J!,h>6!,jn!,np!,n[*@!,nb!,n^4!,ng.!,n`C!,nu!,nt1!,ni!,na<-!,nf)0!,nj,"
+            "I!,nd!,s<!,s:0)*8!,s>2!,ta)!,tbm(!,x~!,xx!,xv!,xq!,xe->!,xo**!,xg-!,xh!,xf=!,xs.!,|ZI)!,|}!,|{N!,}J!"
+            ",~Z!-(|!-+[!-+Z-!-+^!-+Y!-+T!-.Q!-.N!-2>!-27!-4H!-5U/!-5V!-5T-)!-5X*!-;_!-;@T!-:w!-:i!-:Y^!-:k+B!-:["
+            ".(64J!-:_F6!-:j!-:h!-:e!-:bJ-+!-:t!-:q,+A!-:a2!-C0!-C)0!-C,)!-Bw!-Eo)!-Em!-G5!-G4!-G-,!-G.!-H[.!-H^)"
+            "!-H_a!-I@Ey*-!-Ja!-J]!-JZ!-M<-(!-MB0!-MJ!-MG!-ME+!-MH!-N[2!-Ne!-Oq!-Oi!-Oc*)!-Og!-Oe,)(!-Ok.!-R,i!-R"
+            "m+!-Rlu{5!-Td!-Ta2!-Tg+!-Tj!-TKD!-Tf6!-YO5N!-YR!-YJ().!-YL<!-Y_(!-YZ!-YS0!-YY!,VI!-YI!-^R!-^Q+K@9I+M"
+            "!-`A!-`@Zu!*tV!*tR(!+-n+!+-m**!+-o!+6H!+;l!+@D(!+DG!+FJ(!+Pd.5(*!+Pv-!+Pw!+Pb:!+Z7,!+Z5!+Z00)!+Z4!+["
+            "yp!+`k(!+`i!+lY!+lM+L!+lZ!+lN!+lJ(7!+lH!+lA!+nH!+o_k!+|K,(!+|E+6!+|R!+|C(!+|>S!+|@!+|::!,+G!,+E!,+>1"
+            "!,+C!,/i!,3V/!,3S3!,3]!,3T,.{!,4]!,8Q/!,8N!,8E*+*u>W!,<d!,<[!,AL4.(!,AV.)!,A_!,CP!,CO!,EX!,Jm4!,Jj.!"
+            ",Jp5!,Jn0)!,Js*2!,QY!,QM-4!,QU1!,Q]!,QN6!,QT!,QP!,U_!,U]m(!,Wu!,[}(!,[|!,^a!,^`!,hd9!,hp*!,hr!,hc)/1"
+            "!,ht!,ho3*!,hx!,hu!,ha,D{!,hh!,hg.!,jo!,oC!,oB!,o=!,o67!,oF!,oA!,o:;!,o@!,o//!,o.B!,o32!,nU[)P!,oP!,"
+            "oD!,o8!,s[!,sS+!,sT!,sN1(!,sQ!,y3!,y0!,y,7!,y9,9!,y84)!,y:!,y.9!,y/7!,y7!,y->)!,yD!,|M[L!,}N!,}M!,~`"
+            "-!,~d!,~b!-+j-!-+n!-+e!-+d/.)!-+i!-+h.!-+k3!-+b!-.T((*!-479(*!-5d!-5a)/!-5f!-;s!-;I-M!-;X)!-;FF!-;KD"
+            "!-;[/!-;R!-;E8-!-;JL!-;NI!-;b+3!-;a)!-C;(!-C:!-EtL*!+DI!-FJ!-FC,o!-G7*!-Hn)!-Hj*!-Hf-!-Hd*Z)!-IB)J!-"
+            "Jh((!-K{!-MY!-MT!-MR!-O~!-Oz!-Ox+!-Os4!-Oy!-Ot)!-Ou!-R.DT!-Rt(L3<)!-Sf!-U6!-U5!-U2!-U.)!-T{*C!-T|5!-"
+            "U(+!-Yy!-Yp!-Yl!-Yg8!-Yh5!-Ys!-Yi2!-Yo)2!-Yu)!-^V!-^T|J!-_t=6-!-`H!-`G!-`FL0!*tY(!*xh!*yt!*|0!+.*)!+"
+            "-|(*)!+4]*!+4^`!+;m((!+DJ!+FM!+JH!+Q0!+Z@0!+ZF!+ZB*)!+[i!+]n!+]m!+`o!+l|!+lu!+la,/!+l`;!+lq!+leC!+ld"
+            "!+lb8!+nJy!+pL!+|^5!+|e!+|Z<!+|f((-!+|[4!+|a5!,+R!,+P!,+M!,+H*!,-A(!,-@!,->!,-<!,3j!,3d!,3U3|!,8U!,<"
+            "k(!,<fU!,Ak!,Ai-!,Aj!,Ae.!,CS!,Ea(!,K-0!,K3!,J}6!,M<!,M:!,Qt!,Qs*!,Qn.!,Qm2!,Qp)!,Qf!,TI!,THb*Yo(!,W"
+            "x!,],!,]*!,^f!,^c)!,iE-!,iG!,i2/.!,i3!,i0<--!,i1.+!,i5!,i*G!,i@0!,i7+!,o]!,oV0!,oR(9*!,oh!,oc!,oX3!,"
+            "o[2!,o_!,sk!,sc(!,s`1!,se!,sa,!,sbWW!,tji!,yZ!,yR)!,yJ:*!,y_!,yU1!,y[!,yL7,!,|N]!,}+L!,~h()!-)d!-)b*"
+            "!-)c!-+{2!-,*!-+x,3p!-.a!-.`!-.^(*!-/n!-4P!-4O!-5l!-5i!-<F!-<./!-<)@!-<7Q!-<T!-<34!-;gf!-<11B!-<K!-<"
+            "<!-<+1!-;~9<!-B;!-CD(!-FLq)(!-G=!-G;!-Hu+!-HxO((!-Jt!-Jq+!-Jo!-L+!-L)!-K~*!-Ma!-M`!-M[!-Nj(!-P2!-P-7"
+            "!-P5.!-P3.!-P8.!-P;!-P6!-P4!-P,!-R0r!-Rz+!-R|S!-UZ(!-UP!-UN-)!-UR5!-UD*<!-UL!-UI3!-UE3!-UJ!-Z=10!-ZK"
+            "+!-Z76!-Z>5,(!-ZD!-Z10(!-Z6!-Z/D!-Z9/.!-Z51-/!-Z.!-^]!-^YWeY:(30((!*z_!+.1*!+.2!+4f!+;u!+DM(!+Gw(!+J"
+            "I(!+Q.!+ZP!+ZO!+ZN!+ZL!+]o!+`y!+`t(!+m1!+m.!+m(!+l}8!+m/!+m,(!+}*!+|z!+|t/!+|y!+|v8!+|}.!+}(!+|~.!+}"
+            ")!+|x5!,+Y(!,-D!,/p!,/o!,3X!,9K!,9J;W!,<n)(!,<oM!,As!,Aq+(!,Ar,!,CU!,Eh!,Ef(!,GF!,KD!,KC)!,KB!,K@!,M"
+            ">!,Qy**!,Q~!,Udn!,Wy!,]0!,].Z!,^j(!,i}!,iY)!,iXE!,iZ!,iP5,!,i`.!,iW!,ov!,om(-!,op*!,sl*|g!,yk1!,yh2!"
+            ",yn))-!-)f!-,=)!-,;!-.h!-.e(!-.d*)!-2G!-4S!-4Q!-5s!-5q!-5n(!-<t/!-<dM!-<x,!-<g>!-<y@!-=+!-<v!-<^2!-<"
+            "`7./!-<{!-<c6!-<a9!-<h!-<e7!-<_C!-<o!-CH)!-CI!-GD(!-H{)k(!-Jx)(!-Jw!-L-(!-Mi!-Mg2!-Me!-Md/!-PK)!-PJ!"
+            "-PE!-PC3!-PB,1!-PF!-R5*!-R4s)!-S*!-U|!-Uy!-Uh54!-Uiq!-Ux.!-Uw8!-V.!-Uz!-Zg!-Za2!-Ze!-ZY-!-ZW2,!-Z[/5"
+            "!-Z_1!-Zb/-!-Zf,D!-Zq!-Z^7(!-^b)!-^ct!-_W*!-_Ys!-`LU,!-`}!-`|!-`xa!*t`!*t_!*xj!*xi!+.C!+.<(!+;x!+;w!"
+            "+DR+!+Gz!+Q2!+ZT!+mA!+m:.!+m6/!+}1(-!+}6(!+}3(!,+d!,+a!,+`!,/q!,4a!,8`!,<r!,A{+!,A}!,KO!,KN!,MC!,R1!"
+            ",R.(*!,R-.!,TK!,Ue!,W.!,]2!,is9!,j*!,iz+!,iw!,it5.!,i|!,i{0!,iy.!,p/!,oz!,ox,+!,oy6G!,sv!,sr,!,st!,u"
+            "X!,z-!,z,!,yO^(!,~r+!-)g!-,F!-,D!-.m!-.j)!-4V!-4T(!-5u!-=R!-=N!-=I!-=;;!-=O!-=C0!-=<4!-=>;!-=D!-CO!-"
+            "CN!-CM!-GK,!-I*J!-J|!-L5!-L2!-L,!-Mq!-Mo!-PR+0!-P^!-P[!-PZ!-PS,!-R;q)(!-S/L@!-VF!-V7!-V67!-V=,(!-V>!"
+            "-V;!-[(!-Z~-,-*,!-[/.!-[4!-[,!-Z}A!-[*(!-ZtD!-Zy!-ZuG!-Z{B!-Zz!-^BJx*!-_aV!-`5)>E>!-a,V!*m0!+.F!+.E-"
+            "!+6I!+;{(!+D]!+DX!+G{!+ZZ!+ZY-!+Z[!+mJ!+mG(!+pM!+}D((!+}A!,+e(!,-E!,/r!,3w!,3t+!,3v!,8ci!,B,!,CW!,Ej"
+            "(!,KR,!,KT)!,KU!,ME!,MB!,R8!,TMa!,]3!,^m!,j8(!,j7!,j0-+!,p2!,p.!,p,+!,p+!,szw!,trf!,z2-!,z6+!,z9!,z3"
+            "!,~w!-,M!-,L-!-,J!-,H-(!-.o)!-4W!-=`+!-=^(+!-=Z!-=X*(!-=Y!-GU!-IO!-K+!-K*!-L7!-Mm.!-Ph,(!-Pf*!-Pb)!-"
+            "Pc0!-Pj!-R>r97C!-Sp!-Vb)!-VZ,!-VT!-VN5!-VW!-VR!-VO!-VM2!-VQ!-[M!-[D3!-[L!-[<,3!-[C51!-[K!-[J!-[HG!-["
+            "G/!-_(cn!-`Q!-`P7QR4!*tc!*xk!+4k!+4j!+6J!+;}!+D`!,p5!+I,!+Q6)(!+Zc!+Z_!+[{!+`|!+mP(!+mN!+o`!+}J!+}I!"
+            ",+i!,/u!,/t)!,8f!,<v!,Kc!,Kb!,R<!,^n!,j>-!,j=*!,j51*!,p6)!,p4,!,t(!,s}!,s|!,u]!,zA)!,z@!,z<!,|P!,~{!"
+            "-,P!-.s!-.r!-5x!-=v!-=i/!-=k.!-I/(d!-Pp*!-S7((!-Vn-!-Vl!-Vf*!-Vg1+!-Vh)!-[n!-[j!-[b!-[U/4!-[V9!-[S4!"
+            "-[X3!-[c!-[T1/!-[f!-[Z,!-_45J(:=D!-`U!-`T43J!-a8!-a6(!+.S!+.M!+;~!+@H!+Zg!+`~(!+mR!+}N)!+}L*!,+j!,3z"
+            "1!,<w!,B/!,CZ!,CY!,Kf!,R>!,U1!,^o!,jH!,p>!,p=!,p;=!,zI(!-,V((!-,U!-5z!-5y,!->(!-=|(!-FP!-G]!-GY+!-I2"
+            "F!-Px!-RD!-St!-W(+!-W+!-V~!-Vz)!-[u!-[q0!-[v*!-[x!-[s(/!-[r!-[p.!-^i!-`;PV((!+.T!+Zh!+]G!+mW(!+mV*!+"
+            "}Q!,+m!,-F!,<z(!,B0!,Ke)!,MG!,RB!,R@*!,RA!,]5(!,jK((!,t+()!,t-!,u^!,zM(!-,^!-,]!-,[!->+!->*)))!-G`!-"
+            "K3!-Mx!-W--!-W2!-[~)*!-]+*!-]-!-^j};gY*!-aC!-aB!+/I!+}U!,Kk!,pC!-)j!-,_!-6(!->1+!->3!->2!-Pz!-W9!-W8"
+            "!-W6+!-]0!-]/!-_j;!-an!+}W!+}T!,MH!,jp!,pE!,pD)!,zS!,}R!-,bH!-Gb!-K4(!-L8!-Mzs!-P~)(!-S=!-]1)!-`g!+Q"
+            "<!+m^!,+n!,jQ!-,a!->@!->=(!-Q,!-Q+!-SH!-]5!,+p!,jP!,zT!->A!-W>!-_)!,8k!-Q.!-W@!-]9!+}X(!-^m!-aG!-`hx"
+            "!,>y!-8v!,r+!+4<!+L0!,LM!+;(!)DM9!)DP03!)D]!)DS6!)DV!)DK9!)DN03!)DZ!)DQ6!)DT!)DL9!)DO03!)D[!)DR6!)DU"
+            "!)DJ!)DIE()!)DiL#~#~#~#~#~#~#~#~#~#;";
+    }
+
+    static const char *ShiftJisIndex() {
+        return
+            "!)eY((!1+4)!)hU!1+C(+!1+)!)gJ(!(*2!1+j!()}!1+h!1-c!1+i!)hW(!)gL(!)e]!*mU!)e_((!)hV!)3_!)3Y!1+7UJ!)9q"
+            "!1,/!)3p!)3o!)3b(*(!1+0(!)en(!1+e)F)!)eb(((((((((!1+3)!(*/NH!1+F!):V!1+E)!):](!)9j=!)G;!)G9!(*.!)3|("
+            "!)6M!1-e!1+,!1-`(!1+-!1++*+=!()|!)FU!)FT!)Ep+!)Es!)El!)Ek!)EE!)ED:!)EV2!)Ea!)4.!)el!)81!)8/()!)em#2!"
+            ")9S*!):}(!):y(!)9v!)9u#/!)9s(!1-b!)8s)T*#2E!);F!)<_!)9M,!):W!):H@(!)9fK!)9i@!)9w(#.!)6v!)3z!)Gj!)Gh!"
+            ")Ge!)3j(!(*4#+!)F=#6!1+8(((((((((#./(((((((((((((((((((((((((#-.(((((((((((((((((((((((((#+!)fE((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#25(((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((#/!(2i(((((((((((((((()((((((#//((("
+            "((((((((((((()((((((#Np(((((!(4-<(((((((((((((((((((((((((#6((((((D!(4d(((((((((((((((((((((((((#4!)"
+            "CN)1+/!)Cc/7!)Cs7/!)CO)3+/!)Cf37!)Cz77!)Co6!)Cw6/!)Cl:!)Ct:1#~#~#~#~#~#4!)AX(((((((((((((((((((!)7U("
+            "((((((((#(!)oP!)nq5S!)nu6!)n`[C-!)njA!)o)/G!)oB!)pN((!)p@(^!)pS#/!)p,!)ew)!)6a!)q)!)6l!)mU((((!)l6(."
+            "!)p/!)p.!)p-!):H6!)9w*!)9]0!);F!)9l!)9k!);a!):*!)9u(#~#~#;!*lj!+)>!+80!-DT!+(=!+NP!+T`!+7z!-10!,dy!,"
+            "`t!,EI!+M3!+Vo!+vh!+]}!,dj!,_R!-Uf!+e{!+/R!+]/!+RR!+<v!+7S!,k*!-Lb!,N_!,Of!-TS!+QL!,LE!,qj!+<d!+G<!+"
+            "T@!+_}!+e.!-C0!-HN!+b4!*m^Mly!*qn!+.s!+5e!+7WU!+>8!+MjX!+OP!+^M!+gB!+~T!,5CI!,DI!,OTk!,Xn!,cg!,pk!,x"
+            "b!-1eM!*zc!*lc7!+1a!,X]!-2|!,A;!*jx!+4t!+x9!-1G!,E*!,a)!,_6!-VJ!*tg!*{B!+(:L!+.a!+8(!+HH!-L`!+v,!,Y8"
+            "!,g0!-Dx5X!-Ih!*}2!*|q!+<b!+~j!,Ug!-/|!-FS!*{A!-Yy!,F_!*k2!,@4!,]R!+vi!+,B!+),!+m]!,ft!-VV!+7i!*{|!+"
+            "tR!,3{!-BN!+,m!*l_!-1Z!-F^!,aQ!-Lz!*|_!++4!+;`!+IO!+^Z!+a-!+d@!+py!+s3_!,2N!,9i!,EG!-JK!,`H!,pc!,vj!"
+            "-9T!+uI!,6J!,9k!-O2!+M/!,xa!-)A!-Br!+hw!*|)!*uV!+/<!+2]!+5r!+=8!+H(!+K]!+V5t!+rU!+yW!+}~!,(Yn!,*q!,/"
+            "0!,PS!,^x!,_~!,hF!-1p!-7m!-Y6!+3@!+]K!+qE!,4o!*vu!+5[`!+I_!+Jf!+SH!+^3!+ji!+mg!+oI!,/~!,Uk!,s_!-YH!-"
+            "Y)!-_6!+@}!+r+!,a~!*t(!+>|!+PA!,[r!+e^!,,R!*k|!*pt!*{J!+LH!+vl!,EH!-I`!*k,!*z<!*mg!*ny!*na!*op!*oA!*"
+            "xr!*|m!+,2!+5;!+:E!+=:S!,Cu!+_m!+c,B!+n5!+rI!+}Z!,0`!,C/Y!,E4!,I+!,_^RQ!,az!,cG!,c*!,mm!,wg!+,S!,}_!"
+            "-0J!-1^!-G3!,k9!*p<!+Ao!+QG!,,J!,5.!,]:!,_j!,lY!,}w!-F/!-M*!-OC!*mCx!,uA!+._!+2w!+4L!+H-!+Juh!+Lt!+L"
+            "A!+P[k!+S]!+Zs!-S[!+_K!+fB!+td!+}`!,5@!,8|!,Nr!,_Q!,oU!-BJ!-EN!,}S!*vm!*y9!+5C!+(0!+=7!+BG!+OH!+hk!+"
+            "uF!,@.!,ez!,p_!,v|!-;e!-Q}!+tX!-Nl!,l3!+0z!+d:!,l(!-6u!*xT!+-]!*}+!+G[!+Sn!+YG!+dy!+du!+oP!,/e!,@]!,"
+            "Ee!,tMa!-(x!--g!-3R!-Bc!-ET!-H)!+<@!+A8!+hf!-Je(!+U~!,Gp!+jj}!+fH!-U~!+zM!*xC!+*r!+LO!+Sy!+s}!+vI!+x"
+            "j!,d_!,rn!-.R!*k5!-VT!*|t!+gX!+jy!-HE!+dg!*u+!,Fh!,ea!-6B!-;I!+-/!-YD!+d_!,`]!,d3!,LK!*w-!,_r!,4.!*l"
+            "K!*oQ!*uq!+=W!*w/!*yT6!+E,!+*o!+2V!+7j!+<g3l!+FO.!+M,!+NTm!+PI!+Vi!+[F!+cc!+e9!+g6!+m~<!+qB!+yf!+{/!"
+            "+z2!,3N!,4b!,:-P!,GN!,IF!,Jr!,P:!,T3!,VD!,XG!,^h!,bK!,tg!,x*!,}b!-2=!-=e!-BR!-BP8!-D{!-I>!-M@!,]o!*k"
+            "Z!*}S!+A=!+DS!,0F!,8A!,;1!+A.!,V>!,~m!-F+!-I~l+!*mz4!*{C!+*q!+-<!+1|!+5u!+;7!+=I!+@l!+E=!+F[!+JU!+V|"
+            "!+av!+]g2!+aZ!+f^!+fV!+kH!+Ec!+oZ{!+qi!,5t!,B@!+<<!,DN!,MQ!+JF!,tB!,uw!,}k!-)-!--.z!-LO!-O}!-SV!*lM!"
+            "*rL!*s{!+6l!+<w!+Qfz!+Y{!+mz!,-;!,6/!,B>!,UR!,oW!,wq!,y{!+V8!,bx!-Hb!*}0!*}*!++)!+e:!+kA!,vz!,=t!+b["
+            "!-_@!*{F!+<}!,Yp!,jU!-0k!*k9U!*m>s!*|G!*}a!+=2!+HF!+KY!+[4!+ay!+q,X!+rz!+}h!,1K!,Epa!,GW!,Ml!,MO!,Nc"
+            "!+]w!,,L!*|7!+>v!+Dp!+S_5b!+vc!,j`!,v9!-*>!-9`!+yD!,CI!-Su!*lv*(!*oj,!*sK!*tm!,GE!*uA!*vr!*z|!*zH!*{"
+            "Q!*|i!++*!+3Z!+Ah!+Hk:!+KdIE!+TV!+[<!+k3!+rW!,-_S!,=:!,YM4!,]_!,gR!-3]!-<I!-Il!-Mp!-Pt!*mi!*vX!+>^!+"
+            "_g!+hU!+>q!+a,!+h^!,/|!+e6!,K}!*s>!*ya!+/s!+E/!-:7!+]2!+mcB!,1}!,Bze!,HE!,Or!,_f!,bz!,q0!,sh!,yC!-04"
+            "!-66!*}G!-8;!*l)!*qZ!*|c!*zb!,-t!,02!,=4!,`<!-,h!-O3)1!*uG!+NO!,jd!++.!,Et!*rE!+=X!-1V!-EE!*kT!+lp!-"
+            "6M!+@+!+>y!+U{!,FC!+r(!-H4!-.p!,FN!,){!-EH!,K~!+dS!,Qn!+e7!-;(!*yo!*}C!,hZ!,ur!,UM!--/!-3F!*{7!,q9!,"
+            "B8!*p:!*s7!*w6!*tj!+)}!+/X!,11!+0b!+6(!+I@J!+LT!+OV!+OGk!+V>!+Ws!+[P!+_T!+e(!+vU!,5Z!,E5!,MLzv!,QH!,"
+            "Tj!,`fe!,k~!,ug!,vm!,yq!--a!-J0!-ZV!,_e!-01!-UX!*xX!+QU!+Xg!+{Y!-EY!+d~!*ra!+m`!+qf!+zB!,En!,NL!,pG!"
+            ",v+!+aC!*mo!*q^!*qJh!*uL!*w_S!+*|!+/9!+20!+:P!+H,!+P<o!+T)!+UT!+gY!+jh!,,oW!,.v!,=a!,>g!,Nv!,:W!,XS!"
+            ",t=!,xy!,~C!--4!-1s!-;1!-E9!-Jm!-P+!-^@!*ti!*{r;!+FX!+HY!+v^!+w~!,/w!,1F!,N>!,^7!,u_!,xY!-Df!*kq!*q."
+            "!*|b!*~O!+.{!+7T!+<=!+Dy!+G2!+HZ!+Qo!+[(!+c@!+wC!,-m!,Lq!,qg!,XKi!,cH!,jS!,w:!-*J!-7H!-F1!-K(!-`0!*l"
+            "b!*l`!*n/!*zp!*}r!*}g!+8^!+Ik<!+M(!+f8!+kx!,2M!,>y!,wR-!,z+!-5K!*l*!-U8!*lr!*oJ[!*q<!*q9!*toK!*xqBn!"
+            "*{mrV!*}5!+*^!+/}z!+6U!+<-0Z!+Dm)7!+FU2>E!+HK!+L0!+O+!+Ryj!+V3!+Zu!+^;j!+a.!+bS!+d^!+f(!+i_!+qJ!+slh"
+            "!+vr!+x4!,4|!,8}!,>d!,E7!,M0M:o|!,Vj!,VW!,XY)!,ZTd!,^*!,aT!,pS<!,x{!,}X!,~^!-3.!-5/!-8,!,>5!-9d!-Bd!"
+            "-Dc!-Ir!-N]!-RG!-YW!*x+y!*|u8!+4W!+T-!+{z!,|v!-.n!-_+!*tq!*wb!*}s!+.~!,E8!-51!-Y}!-_E!,/5!+yL!,Zq!,4"
+            "Z!+K0!+Me!-Qm!,-x!-/v!+nN!-Ip!*mB!+.q!+09!+4@!+92!+LG!+PR!+^I!+^@!+dv!+fC!+v8!,6u!,N5!,^p!-S]!*li!*n"
+            "t!*|F!+).!+CK!+Dn/!+d6!+r.!,2g!,=N!,vY!-;S!,r;!+/|!+G.!+Tc!*s.!*r|!*u^!+a:!+(G!+34!+7=!+=4!+IG!+R-!+"
+            "V-!+dz!+n^!+vJ!+}m!-6,!,,r!,=b8!,Bf!+[s!,N+!,c3!,qt!--m!-E[!*x4!+/S!+b5!,Ti!,}W!*v.!+/n!-D>!+2g!+hs!"
+            ",X_!+(/!+B>!+1~!,@6!-[m!*o)!*wq!*~_!+Ww!+^c!+aO!+d0!,E~!,HP!,Mt!-:A!+eC!-Ts!,H2!*z@!*uZ!*w^!+=e!+T,!"
+            "+Y;a!+ai!+oO!,hX!-F;!,9/!-UF!+U-!-9n!-Tq!,9`!+_6!*k*!*rh!*|>!+@L!+Ms!+Xv!+[G!+eF!,++!,0h!,4m!,I;!,R)"
+            "!,kE!,z7!,~;!-52!-L~!+]:!+`:!+nv!*mM!*mL!*n^n!*wa!*|v!*|p!++c!+.[!+4n!+7N!+7L_!+<)!+>~!+E3Q!+Jao!+T="
+            "!+Zi!+<5!+]=5S!+c-!+nLA!+pO!,/6!,BA!,Ce!,MII9!,XL!,YW!,]I!,tI!,vh2!,vpN!,xM!,}~<!-F6!-Lj!+nY!*lX!*n`"
+            "z!*tv!+<0!+>)!+N~!+T7!+^}!+ma!+xd!+rQ!,,.!,3[!,6t!,@d!,B1!,VaO!,]@!,eB!-/W!+q:!-^G!+HB!,yc!-YG!,GI!-"
+            "-[!+<h!-FV!*j{!*|o!+1y!+5_!+:M!+=(!+Li!+wm!+yI!,6^!,~K!+<z!,fY!,J/!*rA!+d/!,_I!+@;!,gN!,Pq!,]e!*uj!+"
+            ">3!+UJ!-(s!+]*!,)_!,B5!,Mi!,VY!,x}!--,!-1~!,kx!-2e!*qC!*yw!+>k!+b8!+}l!,+|!-4]!-6-!-:<!,`;!+=G!+He!+"
+            "N-!*k^!*|S!+<c!+R+!+am!+nu!,./!,0~!,D}!,Zl!-)Z!-4c!-NY!*t6!*|T!*~<!+>.!+Uk!+jx!,OS!-Fl!+.Z!*|K!*~:!+"
+            "<r!+>b!+Df!*ph!+N5!+T4!+st!,Cd2!,N=!,QJ!,U|!,]CZ!,e=!,pM!,s{!,zE!-,+!-.<!-1@!-4[I!-F0!-5W!*m7!*ns!*t"
+            "k!*zi!+Ir!+QD!+cf!+q+!+vM!,/U!,Py!-62!-8>!*|Q!+5F!+=D!+ui!,BU!,Q*!,LA!+3U!,*9!*vv!,pZ!-0T!*pC!+B+!+^"
+            "`!,<M!,G1!,]s!-On!*vA!+J2!+]|!+hW!+nt!+v4!+x-!+zR!,:I!,Mf!+Di!-2.!-5B!-Is!*vb`!+Qw!+_wq!+v]!+G=!,Oz!"
+            ",Tq!+a2!,h_q!,xW!*x{!*|V!+6K!+Fm!+Io!+L3!-9K!-Dz!*s0!*tD!*yYlO!*|j!+(g!+)p!+)Z!+,A!+6@!+7A!+8k!+=9z0"
+            ")0!+Fb-!+Gi!+IN!+Ra,!+Sh!+Uo!+UY!+^A,Ir!+be!+f3!+j^=!+rR!+tu!+vKx!,)+!,(lj!,6g!,:L!,>T!,AN!,B^!,D=!,"
+            "G.Y!,LM!,N4!,X@!,c-!,e8!,gM!,pe!,rP!,u~E@G!,|m!,~>!-5`!-7x!-;:!-=*!-E]!-HY!*k+!*k)=b!*uh!*xA!+1O!+2a"
+            "!+4N!+;Q!+Ek!+MO!+Z6!+bG!+b;!+t/!,-R!,5h!,E]!,eg!,y}!-5t!-:1!+,[!+1v!-Ll!+Sz!+gJ!+o*!,+2!,QQ!,Ww!,^t"
+            "!,uD!-LL!,m[!-/k!+>l!*n[!*pZ!*p-!+)/!+8N!+=c3!+JL!+O-!+Tg!+]>!+_/!+g*!+i-!+te!+v2!,4}!,6X!,:k!,BV!,D"
+            "3!,N.!,]8!,_[!,hY!,t^!,vC!-,d!-/T!-1A!-6C!-Fs!*m1.!*w(!+3L!+4o!+>:!,4d!+>n!,ZN!,ui!-0(!-Dy!-H-!,Gu!,"
+            "x-!-Iu!-4s!+.t!*{{!-0|!*}b!+0X!+EW!+V4!+pu!+}z!,;W!,L0!,V3!,px!-1Q!-4e!-9x/!-EO!,2Q!-R2!+B7!+CE!+[T!"
+            "+c2!-)`!-FF!+UP!+b.!+gV!,bs!-J-!-F*!,r[!+zs!+X^!+=~!*k7!+|q!,5Q!+^j!*v>!*w]!*y_!+7V!+I`!+K[!+QF!+Zy^"
+            "!+^Y~!+g.!+dR!+nM!+vG!,,d!,4i!,9|!,Le!,WU!+4s!,rZ!,t1!,wT!,wGa!-1+!-5M!-Gi.!+[n!,D]!,Y[!-E|!+E`!+Mg!"
+            "+QP!+]3!+^N!+bw!,=>!,EF!,KH!,Q:!,Y`!,}c!-(q!-*C!-+m!,@K!*w,!+Sf!+V1!+W{!+Rz!,v5!,E}!,If!,wa!-FU!,Ns!"
+            ",]c!,mO!*mQ!*tn!*zkE!+<~!+>1;!+De!+Q]I!+Y=!+dOI!+r`!+t0!+sX!+ce!+zJ!,)=W!+]Z!,Ey!,IR!,P+!,QG!,UQ!,Z{"
+            "!,]rF!,hU!,vx!,~.!-*W!-21!-20!-8j!-8M!-BB!-Tt!*wt!+*X!+y|!,(|!*u7!,B~!,QR!,[_!,Lu!+,w!+2~!+A-!+V6!+a"
+            "8!+a7!+hB!,-v!,6-!,6,!,A[q!,D,!,L<!,MrL!,ib!,v<!-DP!-1q!-`=!*sb!*xF!*|I=!*q,!++(!+4q!+5}!,,-!+<f!+@>"
+            "!*zD!+Mn7!+U=O!+Tw!+VH!+Y[!+]y!+a3!+Dk!+iaX!+yX!,+*!*lV!,72!,:C!,F6!,M/!,Ow!,OC!,Wa!,aK6!,dpy!,iU!,q"
+            "x!-(}!-0f!-1}!-;T!-G1!-P*!*sI!+3o!+Oo!,](!,g8!,~j!-1.!*p;!*rC!*wn!*{E!+LN!+U*!+bE!+vo!-)k!-1-!*pP!+@"
+            "8!,~*!+]_!,OA!*zz!,qH!*uF!+VP!+<1:!+>9!+WE!+b6!-1l!*mN!+5G7!+q[!,vZ!+)h!+2A!+6~!+M{!+R3!+cR!,^5!+h<!"
+            "-DU!-O1!-PA!*nw!+21!+>-!,Ve!+A6!+Eb!+Id!+KT!+O*!+Qk!+a9!+s0!+xw!,Xy!,[)!,`*!,q<!,}o!-0eV!-EJ!-_N!-UK"
+            "!*m[!*|n!+5T!,G|!-5H!-Jd!-[l!+xv!+|l!*z{!+)n!+<`!+R8o^!+r7!+|2!,1k!,uv!-=K!+{Z!,x^!,a9!*vc!,lS!*|h!*"
+            "|g!*nj!-1d!-/j!+6B!,Z0!+E.!,G8!-/y!+fm!,|B!,.>!-Vd!+j|!,we!*k[!*{)!+,/!+0;!+SQ!+V.!+]v!+n7!+uy!+wH!+"
+            "~G!,=8!,G=!,IO!,Oc!,W;!,Xq!,k|!,wI!-:n!+.d!+4I!+Hr!+];!+_|!+kj!+oJ!,5*!,w|!*qH!,=0!+/[!+HN!+LD!+_`!+"
+            "qK!,7=!,Di!,Tm!,]J!,lt!-1T!-Nw!,Io!,5P!,GH!,HK!,es!-0u!,D6!,F5!,a7!+:f!,;5!*kO!*mk!+<t!+Jj!+SI!+^w!+"
+            "d,!+s(!,jq!,q(!,vD!-4_!-9Z!-O=!+jU!+|k!,.r!,`=!,dZ!,}f!*jy!*tl!*vF!+*`!+={!+EHEw!+HGI_r!+P~!+TH!+`1!"
+            "+aX!+z]!,,C!,5-!,;/!,Wt!,Z8h!,m}!,wtE!-);!-*U!-8V!-B5!-Io!-XV!*yA!+U8!,:>!+aP!+qt!,0k!,}z!-;l!-E2!+s"
+            "g!+3t!+gK!+i`!-0b!-;W!,6{!-1(!+30!+d=!+VA!+j8!*ng!+yp!+cj!-/u!,g)!,O[!-:g!+g}!+z_!+0@!+4z!+;[!,M~!,+"
+            "q!*}1!-6I!-Z|!*l{!*nr!*r*A!*wj!,}T!*}q!+2P!+<u!+EO!+Fs@sP!+Ll!+SA!+Tr!+V^!+fA!+q*!,@(!,C0!,DY!,P1!,^"
+            "H!,ua!,xE!-+Q!-0x!-2s!-4<!-6=!-`+!+r|!+X:!+Yq!+[Y!+y6!,8z!,Gk!-1y!-<8!+xR!+(q!+JB!+Y1!-.[!-0Q!-7U!*u"
+            "H!+3B!+5V!+@/!+Fu!+v<!,R6!,4f!,}s!--E!-Js!+~S!*n@!+oT!+{J!,4z!-Fg!*tt!*}7!+2bJ!+7.!+@:!+Iq!+[|!+bB!+"
+            "vd!,8q!,c6!,~N!-0y!-3c!-:`!,=r<!*x|!+G-!+/J!+6L!+KF!*q5!*u){I[!+)8!+3*+!+6.!+<p!+A}!+Ch!+MF!+Rw!+Wf!"
+            "+bW!+e)!+fNK!,9x!+up!+w]!+u1!+}_!,*d!+I0!,6x!,Bp!,HC2!,HL!,L}!,Nn!*wV!,dg!,gn!,i=!,um!,xd!,|Q!-*r!-0"
+            "h3!-=+!-E5!-JD!-PI!-CB!*sG!*yQ!*}3!+2-!+>=!+P1!+Y+!+s`!,<T!,G3!,YI!,c]!-1c!-8A!+Ag!-Xy!*zg!+IvD!+u2!"
+            ",,k!,;Y!,Cc!,J3!+oh!,.2!,wb!+d>!+kJ!*vt!,E{!+gr!+>{!-Xh!,`B!+=J!-4Y!+|c!+-M!+@J!+MQ!+[J!+qx!,|f!-1P!"
+            "-J)!*}z!+`W!-6t!+5v!-2^!*uU!*kp!*vf!,hH!,xn!+}G!+U]!-:^!+hJ!-Nx!,PV!,5l!*{(!+hH!--B!-FN!+qH!*lY!+>m!"
+            "+HC!-0M!*z(!,~1!,X2!,k(!+H1!+]u!*l@!*u4!+6Z!+>p!-IZ!*mt!+6c!+JV!,wA!+{{!,CS!,BZ!+=m!,du!,.s!,*L!+FQ!"
+            "+K(!+U^!+X~!,*_!,L=!*kf!+H.!*kn!+1^!+-x!+M2!+{]!,M_!,YR_!,[k!-/l!,tJ!,kT!+D|!+Rl!+Y:!,t9!+b^!+ry!+t)"
+            "!,2(!,>*!+8u!,Tt!,_Y!-Np!*pm!+GK!+Sj!+Uu!+[:!+bU!,9d!,,<!,Xw!,Xe!-.6!-4^!*q0!+1{!+9l!+em!+h[!,)T!,.D"
+            "!,}n!+4u!,~A!-E)!-0~!,n/!,D1!,=2!,d+!*nR!*x5!*{+!+SY!+ca!+ra!,8s!,I8!,L:!,^6!,h2!-0O!+`n!+yd!,+L!,Pn"
+            "!,bX!-O.!-^o!*vy!,IV!,>j!,I^!,X0!,HB!+l}!+F=!,X5!,5E6!*u:!-7t!+wz!,8p!-5R!-RY!*n2!,To!+R~!,HI!-Be!-X"
+            "Z!+-O!+3/!,l>!-E}!*nW!*wJ!*zr!*|J5!+E7!+We!+[v!+bf!+q(7!,,8!,-K!,14!,5H!,Q=!,^,!,iC!,}`!,Ij!-6+!,)Y!"
+            "-J(!-L]!+Tu!+_N!,5_!,:.!,@s!,gG!,lI!*zQO!*}N!+6[!+Fe!+IZ!+M;!+R)XZ!+[u!+oj!+rc!,6Q!,9N!,@2!,C|!,Os!,"
+            "Tv!,XO!,q^!,wn!,}r!-28!-Gu!-LH!+jI!,K2!*ri!+>o!+J6!+bn!+on!,1~!,:T!,U6!-`Y!+c[!,Df!*za!,6)!-R]!+ID!,"
+            "[H!,cI!,XB!+Hp!+JN!,5V!,H@!-1K!+eN!+7o!+9u!,Mb!,8t!,y5!*po!+IH!+jW!+px!+yE!,4*!,Ba!,pp!,v_!,}.!+Gh!+"
+            "V]!,6e!,Cv!,`-!-:9!-9Y!,eJ!,lH!-VH!+(>!+IJ!+[q!+tH!+|Y!,}^T!-JR!+[2!,4>!*k.!*mP!+1b!+5X!+9>!+=Q!*uy!"
+            "+E4!+Fz!+KJ!+RW!+[[X!+_S!+tZ!,+}!,Gv!,ZPs!,_E!,yg!,}Vo!-)*!-D0P!*o}!+Y8!+nP!,]u!,de!,go!-3M!+>0!+h:!"
+            "-Kk!,d~!,g[!*n1!*x@!+J1!+Ex!+aH!,C1!,Zz!,re!,t8!+v6!+HJ!+R5!+rN!*mG!,,Z!-TW!*w+!*}d!+-I!+44!+P.!+RO!"
+            ",(`!+6F!,L.~f!-F[!+[l!,W^!*k:!*oC!*uE!+2m!+F@7!+H<!+cU!*kH!,gA!-BH!-Dq!,Ko!-In!*sv!+4C!,8K!,@I!*wK!,"
+            "<F!,fk!,I*!*qt!+55!,,7!,Im!,P9!-/tB!-1]!*p7!*yE!+8W!+H3!-Ho!*pV!,]n!-9Q!+/-!+U6!+nS!,4u!,r8!--x!,E:!"
+            "*y[!+3k!+O4!+Q@!+`=!+oc!,K9!,cA!*qG!*pr!*z+!*}o!+2^!+5w!+<x!+Aw!+Avc!+Ft!+S<!+UI!+Zx!+]H!+aF!+rl3!,("
+            "=!,>(!,P~!,Y2!,_`!,ce!,fE!,l^!,rp!,v2!,|U!-2a!-98!-Lk!-Xe!-Z2!*kr{!*r]!*w}!+/v!+7*!+Ep!+Jb(!+Qv!+`D!"
+            "+aV!+cb!+fe!*uc!,Ms!,XT!,[S!,x`!,}B[!-89!-DG!*}H!-JC!*z=!*sO!*{-!+4)!+Y@!+ap!,,X!,;]!,E>!-6L!*y>!+r6"
+            "!+nq!+2+!+F(!+6+!+ah!,VO!*v]!,9g!+XL!,A4!-So!-_-!+1L!+7;!+^b!+c*!+od!+(h!+im!+F1!,[G!+b|!-Tp!+d9!-Vn"
+            "!+eD!*lt!*p]!*|E!+SE!+ag!+rA!-/~!*o|!,Qk!-_1!*k(!+OB!+wn!+yo!,fm!*~F!+af!-S`!+D{!,I9!+A1!+=K!,lx!+w6"
+            "!,f)!,Dc!,Y^!+6r!,L2!+pQ!,:l!*yU!+5O!,(g!,,P!,<}!-G<!-Y~!+gH!+9X!+8F!*uv!*}4!*~P!+^H!,:)!-0[!-8T!-Xf"
+            "!+7n!,,N!+x^!*ts!+f[!,OgU!-Gy!-_,!+X[!+j`!,`Y!+6]!+<8!+oq!,.c!,:<!,OY!,Vl!,eG!*tW!+ad!-_L!,:8!+bH!*y"
+            "|!-Ls!+>T!+Qr!,Kz!,}g!+)y!+M@!,M]!-B>!*y~!*l+!*v0!+5I!,,*!,W4!-63!+HX!,=-!*{V!+IW!,MU!,h[!,v;!-,E!-G"
+            "m!+d.!,h^!-=g!+N=!+N<!+rO!,8G!,xL!-.F!+)X!*nu!*tO!*yC!*|H!+=)!+FZ!+M)!+Oc!+Vd!+aD!+cl!+wT!+ty!,.~(!,"
+            "4{!,BH!,r1!,wL!-1Yp!-3Z!-F.!,n=!+5B!*lU!*n}!*k/!,w<!-.M!-I}!*r}!+FY!+6o!+==!+G@!+VhH!+YO!+`m!+h1!+il"
+            "!+sL!+xN!,*.!,4r!,FS!,U2!,VT!,dL!,ex!,t3!,y*!-*m!-1u!-E<!-Lx!+O_!+Rs!+mr!+qo!+ta!,UvX!+uW!,U-!,nl!,r"
+            "U!+bK!,b_!-JS!-Fc!+s]!,N^!,d@!-4{!*l=!*{G!+C+!+mC!+|.!,h}!,j1!,tZ!*wO!*}6!+@@!+b3!+f9!,1N!,2w!,7+!,r"
+            "+9!-61!-FM!-E7!+Ij!,/z!,Fp!,dQ!+V,!,5Y!*xZ!+t,!+x3!,1Q!,5M!,>c!,L7!-EF!,G*!-aV!*p.!+ON!+]T!,jb!*lSP!"
+            "*sT!*kC!*vG!+=t!+[~!+ei!+uS!,.g!,86!,<N!,Dk!,M7!,^q!,x0!-25!-64!-E4!-J.!*xm!,Oy!*qO!*{k!+b~!+uc!,*l!"
+            ",1|!,]=!-.7!-Ed!-Vs!-^h!,2S!+2n!+u/!,N*!-Jv!*m]{~!*v1!*y,!+DA!+KP!,0O!,B3!,`)!-7E!-Exh;!-^`!-a*!+`5!"
+            "+n_!*w<!*xu!+~c!,qu!+GQ!+L)!+Oq!+yg!,)8!,K8!,PF!,Wo!,fG!-11!-:=!*}k!-T3!+lh!+}y!,}y!-*Q!-GH!*y/!+8p!"
+            "+GRc!+aR!+he@!+tV!+yR!,,S!,.C!,J<!,VU!,W~!,mQ!-32!*u<!-^[!,B}!,X4!-:D!,x4!*qQ!*~`!,v{!+nT!,}{!,Y]!+M"
+            "[!+c0!-[e!*lg!*lf!-V*!,vu!,hq!,gm!+g<!+wl!,@8!,ZU#S!+H>!*k1,<.,-**;)R*!,|w!*lW!,]i!+H@!*l[7(()5**@!*"
+            "mE!*m;)!*m9<.6!*mW@9z!*nSS)!*n{!*nkW9.0!*oI!*o6.I!*o<>7!*t<!*pM2!*pG1*!*pJ0!*pI;(^5!*q7=!*qI!*q(!*n>"
+            "!*ppS/*!*px!*piJ!*q)f+!+a=!*qz!*qu!*qm9!*q{=3/B!*rTW!*s+>(!*s,6;/./!*s^22!*sp;!*s|(;!*t9!*t8-.A!*t],"
+            "!*ta+(9!*tr/5!,GG!*u8(+9)!+.X!*u]!*uY-)))(5)!*us.((/!*v+(!*v*,//+9,!,jZ!*ve+*,0-.0!*w3A*+,-=!*wk.(9!"
+            "*w{=1!*x913!*xN7.!*xd!*xB>0!-/b!-/a!*x~(6!*y0331.,*!-LZ!*y]:)*(4)!,5+!*z3*!*z5-,03)),/-!*zm!*k8!*zq+"
+            "!*vQ!*{/2,!+5E!*{M!*{I2;1-!*{x0)-4!,Jc!-FD!*|]!+a6!,+3!*|l!*|f,4.e*!*}T(6!*}V/!*}Q!*}EYj!*~HA!*~19-!"
+            "*~CJ!*~N,!*~I53!*~Yj!*~v=!*~y.@+!*~|*>!*~xB!+(9D4(Q,!+(|!+(m!+(l4!+(a!+)c.K!+)v!+)WV!+)o8(!+)b!+)]Re"
+            "!+*T!+(,!+*_<!+*O*B-7!+*P.N!+*[IZ!++DB!++C@/!++Si!++wG!++~!++}F!++y~)!,*{!+,_)!+,]-[!+-8!+,Yf!+->D!+"
+            "-U1=!+-j!+-e=0/!+.35!+.;,)!+.@/-*)+>2.!+/),,!+/2*)-,!+/A!++F!+/G18(=!+/g,6B!+1A!+0_!+06F114:!+0{--:*"
+            "5!+1S(`!+1W4P5+~!+2Mj!+2xM!+oU!+3(!+2je3]!+3w36L!+4<!+49!+4/>5!+4S-)!+4Z4!+4_/!+4b72!+4|)((,/-2!+f7!"
+            "+5R.(,--!,Fw!+6,!+5~!+5|3!+6/1!+67.,!+6A60D!*o+v!+6|6;J!+7`!+6fu(t!+8M!+8>2!+868NT!+8x!+8d(T/XJ)4!+:"
+            "F!+:AN!+:[6*!+:ZL(8!+;92D!+:T!+;Y3/,)!+;p8+,(1+.*)*!+[m!+<T-*K92+)2!+=U;)!+=h!+=d.-,-!+=y9)(,-4)-7(/"
+            ",/,!+@*!+@)!+<K!+@G)!*l.!+@Q*:,*!+6t!+A07!+A;-!+A<5!+AD097;!+B*!+At!+Ci!+AqI1)n!+BP!+BL!+BB*5!+BK!+B"
+            "J!+BI]-!+C)!+B}I.*8!+Ca!+C_H!+Cz6)6!+CmO,4+-!+DY+,7.*=6!+EK!+EC1C(4!+Ev!+Es50!+F02*)!+EzV(+!-_.!+F]I"
+            "I(-/!+GW.4!+Gf!+Gc(.!+Gj.(*,)!+Gy++-,-}!+I9!+H=-,:+20.+)!+HcJ,()/3-+3!+Ia!+I^2!+Ig0!+If>!+Ix!+Iw//,6"
+            "BM!+Jn;!+J{!+Jg!+M<!+K2Jh!+KM!+KDA!+KBK!+KO!+KI=!+KZ!+KCSH!+KvQ4!+L=!+L(!+K{.=!+KxI!+KwR!+LJ!+L7P3!+"
+            "Mr!+Lc>!+Ld>!+Lv(!+Lr<!+Lk!+Ml!+MBP!+M^!+M=!+Jz!+MG0!+M>K!+O,!+NJ!+N:!+N*(0!+N(-0F!+N/!+M|D(b!+Nt!+N"
+            "^!+N]K!+Nu!+Nr!+Nb/0,)W+!+O7((80!+OO!+OE3!+O>!+O<!+O2JL!+Ow!+OhM!+Ou-!+Ok.B*F!+PU!+PTV!+PS!+PN*!+PE8"
+            "!,Tx!+PXA!+Po:+!+Q)2!+Q2!+Q1))/(+!+QB/.**0+))(547,!+R;,/;-.!+R`;(*g!+Re8l!+S^!+SG;X!+SR!+Yc!+ST;!+SX"
+            "!+SV!+SN,!+R}Vl!+S{*_!+T8-!+S|-!+U1!+Tv6!+WT!+U0p!+Uq!+UcS!+UXU!+Ur!+Ul==!+UM!+UK~S!+VM-E!+VV0L!+VQ{"
+            "F!+W=4:7!+ZV!+WO8!+WG!+XJ/.!+X0!+Zd!+Xy!+Xw9+!+Xl]F!+Ya!+YS)!+YIE!+YPW!+Yv!,]`!+Yo(!+S7!+Yr3f!+Z.!+Z"
+            ",!+Z*/-!+Z5C+!+Z=G!+Z]/0()!+Zp)!,5>!+[+5!+[8!+[02-!+[A<-1(!,z>!+])+333*!+]P*/-0!+]i.(7!+bX!+^D!+^<!+"
+            "^4!+bY!+^p(!+^o!+^V[!+_(,!+^|E!+_B.*(!+_D*5:,-!+_o!+_j;,L!+`I7!+`N!+`L/!+`HF+-!+^z!+`w*.,)@.//(!-GN!"
+            "+aj8!+ar2!+at!+as6@)!+b>1(M!+bVb!+bc!+bPJ!+brC!+c1!+blZa!+cEa!+cD_!+cIT!+cp!+co,3!+cJ<!+cWI!+l/!+dZP"
+            "!+df>4!+doD!+fE!+dhV1;/H!+ewF!+e|0!+f,!+ek!+lB!+fK!+e[j!+f1B~!+eu!+ef!+g=!+f]g!+fks+!+ftS!+f`.:!+fh!"
+            "+gt!+gO!+gA!+fj3k!+g5!+fs6b)!+gW0!+g_!+fX!+hb!+h`!+hDD!+hS!+h;R!+hV!+gwd!+g{D!+gnY!+hF!+hEL!+hRq!+iA"
+            "J!+iR)9!+iQ7!+=n!+i^:!+iN/!+i9!+jm!+hz6!+i.!+h~GR1BA!+j<!+mI!+j6!+j/!+i{F!+iD!+j]!+j*O!+j(G/!+lU!+jb"
+            "!+jQY!+jJ!+k[!+juk!+k/C!+kB4!+k0!+jw!+ja!+kz!+kw:!+knF(!+l*!,ir!+lO/!+lV!+lL!+lG!+l@Z!+lf5!+l=X781!,"
+            "iq!+m8@+!-SK!+m_A!+mw!,9}!+my!-L[!+n0!+n,-.0!+n=.+)>(-(+!+nn12!+o)0--(+*!+oF)+,1,/34!+p*/!+p.!-_0!+p"
+            "H2(.0!+pdd!+q@4/@24!+qmB!+qj!+qS2G!+q|]U!+rj!+rSB!+r[@!+rD*4!+rPI;!+rp8^!,pT!+sx!+sm9!+sz!+sZD!+su!+"
+            "sS!+sM!+tOX!+tP!+tFG!+tE^.!+{~!+tr!+v:D!+vL!+uL9G!+uO5N!+uv!+udD!+uj!+u]^!+uq2!+um<+hj!+vq!+v[!+w`!+"
+            "wL!+w*!+vfq!+vnt!+w9!+vbL!+v};!+vg!+yB!+v`CsP!+x/Y!+xOD!+xU!+xG<!+xJJ(!+w}=E!+x6!+z.!+yT!+}:!+y.3-j!"
+            "+y4h!+y1l!+xe!+z+!+yV!+y9!+zu!+zi!+zg0!+zo!+z^!+zI!+|6!+z[<!+zk!+zF_*Y!+zTv!+{;!+{9*<4!+{C^!+{o>!+{n"
+            "+A!+|1!+{uV)!+|=>!+|E5!+|BE!+|_!+zc!+|b!+|].85!+|wG9_!+~+Ek!+~F3!+~M!+~HY!+~f9!+~tX!,(BG!,(_u!,)E[!,"
+            ")V!,)R!,);1=K!,+A!,)u8:+S!,*T,;!,*e2!,*j93!,+,5.!,+>-5*24,!,+s+)0(*(-,4D1+!,,s-2+3,9!,-N8*!,-a1+7!,-"
+            "}(@!,.=!*q2!,._!,.Q9!,.^.>!,.w!,.q!,.mA7(!-_K!,/I:!,/Z//!,/h-!,/mw!,0PC!,0X,M0!,0|!,3@!,1M!,2c!,1n!,"
+            "1@c/C!,21H!,2L!,23C4.!,2V.3/4:0K,,!,18!,4(*+),+!,48(.!,4@4!,4L).)!,4V/!,4]2/-7/0!,5=!,5<9!,59;6!,5X*"
+            "+)2!,5k7(!,5i=!,5~!,5w9-*/!,6BG!,6R7!,6T/!,6W+!,6PD!,6j/.1!,6~H(!,7F,!,791!,7;(@)!,7S=/!,7k(()7!,7{2"
+            "3(!,8:=!,8M0(-((!,8],+)+)++*,**/!,92-(=++((/20!,9s3*+)*!,j3!,:F4!,:R!,:OM!,:p!,:j.(!,:gD(6:5*!,;Q1B!"
+            ",;u!,;p<!,<+-6!,<>9-*-!,<^(!,<]3-1*).257-!,At!,=m!,Ax!,>;r!,>l9!,>tF!,@->9!,@L,J!,@i,0!,@a!,@_0,J!,A"
+            "3!,@}K!,AA:2!,A_/:!,Ay<H!,BO/!,BR!,BM!,BKO,2:1!-`j!,CM+,-(639,!,D.)M,2(.!,Dn!,By!,E)1*!,E/3;!,EB@(.!"
+            "-ag!,Ej0+26!,F8*!,F9:G!,FT-6!,Fi!,Fd!-2<!,Fl**)-!,Fx-(*+(+.*94!,GY!,GUU!,Gh(,>!,Gx5BR!,GSr!,GZj!,H>X"
+            "!,H`6!,Hb0(!,Hg)W!,I<.!,I16!,I>!,I/.!,I3!,HWeZ!,Ig2*!,IY9>3P*!,J5!,J4!,K[!,JP.3!,JC+H!,J^!,JFU+*!,Jp"
+            "@!,J|96!,K=8!,KJ!,K:7/.,!,KQ6.054;0!,LH0!,LG.2!,LX!,LW!,LT2+*,!,Li=!,Ly1-!-SU!,M@*))+3!,MSB!,Mg!,M[d"
+            "-!,N)+4!,N08U!,NR!,NJL!,Ne-!,NK;X!,O/!,NW]!,NzFG!,OU!,OJ99!,Oe!,OR!,Q9!,OI4U!,O`!,OF8P,.!,P/E!,PD!,P"
+            "2L,A!,Pt!,PeG!,Pr!,P[)>LH!,Q7!,Q1+1!,Q3!,Q./U!,QZ!,QS/!,QV(G!,Qh!,Qg:!,Qy/!,O}!,Q{!-/h!,Q}0(*-!,R7*("
+            ")!,R54(!,T5)2.(()(+!,TR+.(/(!,Tf81+!,U+,!,U/,/1!,UF!,UC03*.!,UW/)!,y|!,Uo(+2!,U~4,*1-!-LI!,VZ!,VX..-"
+            "(*,.>!,W96!,WE3-),*-2!,Wr!,Wp-*+),)!,X.=!,X<.:!*ua!,XVW1!,Y-+!,Xo=!,Y*[!,YD)R5!,Yy3D!-EK!,ZF!,Z=<!,Z"
+            "Q!,YQ!,Zr!,Zo!,Zf(56,)!,[*)F!,[@6!,[N!,Z`]=.,0!,[d,*)!,[f6++/!,]-!,[t9,(.:(**(*)***-:)4!,^34A!,^Y,!,"
+            "^[,,!,^d-)(!,^.l-(-6,A!,_KD!,_X^)!,`5!,`(J!,`J.!,b@!,`Z!,`R!,`P!,`4P!,`2U!,`/!,a6!,a5!,`nD!,a26!,a:>"
+            "!,aG!,a0!,a,!,`o(!,b1<7!,bL*!,bC!,`{!,b:!,b3*!,b(b!,av)S!,b5GuG!,cC!,b|W-!,c/[!,bo_7!,c79C<!,cy!,bk!"
+            ",d:!,f`!,cS!,dq!,d,9!,g_!,e1!,d{!,dok!,dr;!,dm!,dI!,d.l1!,d7!,ey!,df!,eh-!,eMc!,e|!,ejG!,f(!,ep,7!,e"
+            "O!,f{!,fX!,fMK(;!,fy!,fo!,fn!,fUmK!,g]!,gL!,gE!,i]!,gO1SL!,h60!,h8F!,grO.x!,h5<!,g|.9b!,hj<!,hi>,//!"
+            ",i5E80!,if!,iX!,iT3D!,iu=65!*kx!,jY2/1J7-(!,k:(R!,k`<)!,kaA!,p)!,k[Q12*!,l9!,l5;K!,lb)!,l[*!,lV=!,le"
+            "+!,lT8R2!,m<+!,m*+!,lvo!,mfA!,mR)N!,m^8-!,m`!,mY7.!,ob!,nS!,nP!,n2UD!,no*7!-FA!,n]A!,ne;!,nx!,nm]*!,"
+            "o;W!,oj!,oZ!,oR(>!,o-h,!,or4!,o~7,*!,p-;0!,pI7.,+0=!,q/H!,p}/a!,pz7<!,qDD!,qK0!,q>>36!,qd9(7+(+D0!,r"
+            "Y!,rQ!,rE19/!,rh0X!,r|.,(=*!,sC!,s=);!,r{l!,sg/!,sm0!,ss,,*.,,)0,0/!,tY-**/*)(B)(14+2:!,uo!,uk6)/82B"
+            "!,v[!,vO)]!,vw!,vv!,vlK!,w5)L!,wU!,wE;(!,wN0I0!,ww@8/!,xF!,xC4K!,x>)<!,x<!,x9Y!,xg:!,x@^!,xp.0:!-Hm!"
+            ",y/,:!,y1A2*!,yX!,yS4,!,ye8!,yj4*,0*3)+(**(!,|E.!,|J0+)),413)/.!,}:,*(-!,}1D!+QS!,}d!,}a:!,}i(!,}e/9"
+            "!,}xK!,~D!,~:K!,~[(0(,!,~i/!,~o*!-`m!,~u!,~-p)z-+)5@Q!-)v!-)r<2!-*7!-*-6!-*,G(!-*A+A3(!-*bF(!-*s6K!-"
+            "+B!-+<+=!-+T)*+!-+U82!-+n!-+6b!-+cI!-,)1,-!-,<!-,;.!-,B0!-,I*,8!-,Y2+=!-,j4.**7/A!--_!--N:3!--i7!--v"
+            ".!--w0*!-.(!--pB4/!-.G3!-.P!-.L5!-.W!-.T/0,-((a*+1)/K2!-0F/,!-2A!-0X8!-0^(>+3!-0r8!-0{!-0pD6!-1D+!-0"
+            "]!-1_(((!-0sd!-1M@)-1..!-Ei!-2+7!-26+!-291!-2C-A.)+U)!+R(!-3@O7.A!-4@B3)2)+1!-5,A!-5D!-5<H0+!-5f2!-5"
+            "p--(/),-0)!-6AI!-6[(P!-6f<@!-6|!-6xv!-7i!-7V+C!-7Yv!-7P3,u!-8R!-8O/!-7l!-95!-8v!-8tZN!-9bs!-:@!-:*0!"
+            "-:+0>!-:G-I+D!-;*!-:i!-;n!-;j(!-;QME(8!-<M!-<@!-<*B!-<7!-</D_!-<}!-<|!-<l+0N!-==1!-=3A.8!-=W>,)!-=r3"
+            "!-79!->-,)-!-=nJ)*!-><!-BA,*1))(./!-Bg-6!-B{!-By,3!+|9!-C,1!-C50!-C=)-,+!-CLh.-(:1*!-DaT!-Dr)!-Ds).3"
+            "!-E+I2!-EU):!-Eh1(!-Eq+))(<!-F5!-F3+!,sU!-FGY!-F@L2))2!-Fz*!-F{.*2--0+(-))!-GX.:++))!*yN!-H+-/3!-H<,"
+            "!-H:3,+(33!-Hh!-He7(6*)*88!-`n!-I_!,G-!-Ic!-IbB!-IyT!-J:!-J7=-00!-JcH+((*!-K4`,),5!-L/*K)@-0)+0!-M4("
+            "-!-M73)6(+.!-M^2!-Md-(!-Me0k(4/(5K!-OI)!-OF!-O>D(*(0!-Og05!-Ot!-OP`935!-P[!-PY*!-PW>!-Pg5!-Pq/**!-P~"
+            ",)!-Q-l*3+6))(1(*(*0!-RZ*-!-Ra-+29),*())(((+(*9!-S^3!-Sh(*.DG!-TH5,(/(/331!-U(40)(8!-UR)!-UD4!-VU!-U"
+            "c!-Ub!-UaM!-V.!-Uz1!-U}!-Uw)1!-U{!-UuR!-V51!-V>!-V;6>!-VM;!-VYD-.6)!-XX,+A!-Xz!-X]@*L!-YB!-Zw!-Y>!-Y"
+            ":M!-Y0!-Y-W!-Y[!-YZ/)<(-!-Yn!-Ym0A>!-ZNL!-Z52H1,09!-[2!-[,!-[))30!-[3>!-[EM!-[X.)5E(*!-^<+++.*(-*!-^"
+            "Y3/+6!-^s*!-Gx!-_>)((+/)!-_P*,*.,)())((1(!,9W!-`23293/)6!-`~((,(,!-a24!-a:+G.+!+2[!+iZ!-1i!,2W!*vW!,"
+            "*3#~#~#~#~#~#O!,R1!,rz!-:Z!-8D!,f4!*pB!+~U!+^l!+fZ!-9a!+a5!+Hy!*kJ!*mYC+*_Ee!*oX7!*ocb!*qe!*qF!*pyGP"
+            "R!*qg{!*so!*sR!*tpBbIVQ!*xn1BCM.EwIGS!0s1!*~p!*~^G!+(~!+*Z!+0.3pD!+1H!0s2(!+3v;!+57q/)-j=!+</!+=E!,4"
+            "y!+=^;Z!+A+;dZT!0s4!+BtSt(>!+HT:[yO!+L;P,}!+M`t!+M}GN!+Nf!+Oy!+QI!+S1!+W,!+XCfY!+[1!+^9<N!+^CM!+^X-j"
+            "!+_;)!0s5!+_XN.94d;!0pL!+bL~!+e8!+cQjl!+fb!0s6!+hP!0s7!+i*swd!+k.U2!+lw)!+ol!+q)ER!+qZ!+rqR!+tt!+t[O"
+            "=KQ!+v31fK!+vj<!+xW!+zwUi7)I!+}uN!,(T!,(I!,)L!,)5(!0s8!,*]f!,-M4!,.l!0s9!,/jo344!,0p^!,1<Y+!,1r,]O=!"
+            ",4J!,5d!,8xB)!,9:2!0s:!,;;!*y*!,=nU==!,A~!0s;((!,C6!0s>!,C=!,Fv=!0s@!,G9!,IC!0sA!,ND;!,O_!,OG_!,QO!,"
+            "TE!,UJ!0sB!,`X!,aeEqW{!,ec!,gW-9!0sC!,h`!0sD(!,od!,rR!,uqMkV>I!0sF!,xU!,y^T!,~Q+F!-),!0sG!--1!0sH(!-"
+            "1w!-3C!0sJ!-3{9!-6@!-6<.6(!-6J(I1!-6qX-!-7M92!-7c!-7JVi!-82(!-9N!-9=)!-96!0sK!-9;2!-99{!-:2!-9c!0sL!"
+            "-:/!-9gF!-9j!-;,!-:jvJ@Bb;*!-BQ!0rUv!-E^9!-GI//1))+!-Jo5!0sN(!-M>!0sP!-Nb!-Ph!-RH*!-T9!-T6EJ1n!-Z6!-"
+            "Z1!0sQ!-]5!-_D#)!)7f(((((((((!1-b)!1+/!1+*#~#~#9!/y`(((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((("
+            "(((((((((((((((((((((((((((((((!)7f(((((((((!)7U(((((((((!1-b)!1+/!1+*!)l6!)6a2!):*!,R1!,rz!-:Z!-8D!"
+            ",f4!*pB!+~U!+^l!+fZ!-9a!+a5!+Hy!*kJ!*mYC+*_Ee!*oX7!*ocb!*qe!*qF!*pyGPR!*qg{!*so!*sR!*tpBbIVQ!*xn1BCM"
+            ".EwIGS!0s1!*~p!*~^G!+(~!+*Z!+0.3pD!+1H!0s2(!+3v;!+57q/)-j=!+</!+=E!,4y!+=^;Z!+A+;dZT!0s4!+BtSt(>!+HT"
+            ":[yO!+L;P,}!+M`t!+M}GN!+Nf!+Oy!+QI!+S1!+W,!+XCfY!+[1!+^9<N!+^CM!+^X-j!+_;)!0s5!+_XN.94d;!0pL!+bL~!+e"
+            "8!+cQjl!+fb!0s6!+hP!0s7!+i*swd!+k.U2!+lw)!+ol!+q)ER!+qZ!+rqR!+tt!+t[O=KQ!+v31fK!+vj<!+xW!+zwUi7)I!+}"
+            "uN!,(T!,(I!,)L!,)5(!0s8!,*]f!,-M4!,.l!0s9!,/jo344!,0p^!,1<Y+!,1r,]O=!,4J!,5d!,8xB)!,9:2!0s:!,;;!*y*!"
+            ",=nU==!,A~!0s;((!,C6!0s>!,C=!,Fv=!0s@!,G9!,IC!0sA!,ND;!,O_!,OG_!,QO!,TE!,UJ!0sB!,`X!,aeEqW{!,ec!,gW-"
+            "9!0sC!,h`!0sD(!,od!,rR!,uqMkV>I!0sF!,xU!,y^T!,~Q+F!-),!0sG!--1!0sH(!-1w!-3C!0sJ!-3{9!-6@!-6<.6(!-6J("
+            "I1!-6qX-!-7M92!-7c!-7JVi!-82(!-9N!-9=)!-96!0sK!-9;2!-99{!-:2!-9c!0sL!-:/!-9gF!-9j!-;,!-:jvJ@Bb;*!-BQ"
+            "!0rUv!-E^9!-GI//1))+!-Jo5!0sN(!-M>!0sP!-Nb!-Ph!-RH*!-T9!-T6EJ1n!-Z6!-Z1!0sQ!-]5!-_D#~#~#-";
+    }
+
+private:
+    HtmlParser &parser_;
+    HtmlCharset given_;
+    HtmlCharset charset_;
+    std::string head_;          // the bytes the charset is sniffed from
+    std::vector<char> out_;
+    size_t used_;
+    unsigned char carry_[4];    // a sequence cut by the end of a Write
+    size_t carry_len_;
+    size_t replaced_;
+    const unsigned short *index_;
+};
+
+/**
+ * parse html in any HtmlCharset held in memory.
+ * @param charset the one the transport declares, HTML_CHARSET_UNKNOWN to sniff it
+ */
+inline shared_ptr<HtmlDocument> ParseEncoded(HtmlParser &parser, const char *data, size_t len,
+                                             HtmlCharset charset = HTML_CHARSET_UNKNOWN) {
+    HtmlDecoder decoder(parser, charset);
+    decoder.Write(data, len);
+    decoder.Close();
+    return parser.Finish();
+}
+
+#endif
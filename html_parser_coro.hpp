@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * C++20 coroutine interface for html_parser.hpp, yields elements while
+ * the document is still arriving.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_CORO_HPP_
+#define HTMLPARSER_CORO_HPP_
+
+#include "html_parser.hpp"
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+
+/**
+ * class HtmlElementStream
+ * asynchronous generator of elements, consumed from another coroutine:
+ *
+ *     HtmlElementStream stream = ParseElementsAsync(source, "/a[@href]");
+ *     while (shared_ptr<HtmlElement> e = co_await stream.Next()) { ... }
+ *
+ * a null element marks the end of the document.
+ */
+class HtmlElementStream {
+public:
+    struct promise_type {
+        shared_ptr<HtmlElement> current;
+        std::coroutine_handle<> consumer;
+        std::exception_ptr error;
+
+        /**
+         * hands control back to the coroutine waiting in Next()
+         */
+        struct Yield {
+            bool await_ready() noexcept {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                return h.promise().consumer;
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        HtmlElementStream get_return_object() {
+            return HtmlElementStream(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        Yield final_suspend() noexcept {
+            return {};
+        }
+
+        Yield yield_value(shared_ptr<HtmlElement> e) {
+            current = std::move(e);
+            return {};
+        }
+
+        void return_void() {
+            current.reset();
+        }
+
+        void unhandled_exception() {
+            error = std::current_exception();
+            current.reset();
+        }
+    };
+
+    struct NextAwaiter {
+        std::coroutine_handle<promise_type> producer;
+
+        bool await_ready() {
+            return !producer || producer.done();
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) {
+            producer.promise().consumer = consumer;
+            return producer;
+        }
+
+        shared_ptr<HtmlElement> await_resume() {
+            if (!producer) return shared_ptr<HtmlElement>();
+            if (producer.promise().error) std::rethrow_exception(producer.promise().error);
+            return producer.promise().current;
+        }
+    };
+
+    HtmlElementStream(HtmlElementStream &&other) noexcept
+            : handle_(std::exchange(other.handle_, {})) {}
+
+    HtmlElementStream(const HtmlElementStream &) = delete;
+
+    HtmlElementStream &operator=(const HtmlElementStream &) = delete;
+
+    ~HtmlElementStream() {
+        if (handle_) handle_.destroy();
+    }
+
+    /**
+     * awaitable resolving to the next element, null at the end of the document.
+     */
+    NextAwaiter Next() {
+        return NextAwaiter{handle_};
+    }
+
+private:
+    explicit HtmlElementStream(std::coroutine_handle<promise_type> h)
+            : handle_(h) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * parses the bytes of an asynchronous source and yields every element as
+ * soon as its close tag was seen, children before their parent.
+ * @param source object with Read() returning an awaitable that resumes with
+ *        the next std::string chunk, an empty chunk ends the document. it
+ *        must outlive the stream.
+ * @param rule optional single step select rule such as "/div[@class='item']",
+ *        only matching elements are yielded
+ */
+template<class Source>
+HtmlElementStream ParseElementsAsync(Source &source, std::string rule = std::string()) {
+    HtmlParser parser;
+    std::deque<shared_ptr<HtmlElement> > closed;
+    parser.SetElementCallback([&closed](const shared_ptr<HtmlElement> &e) {
+        closed.push_back(e);
+    });
+
+    bool more = true;
+    while (more) {
+        std::string chunk = co_await source.Read();
+        if (chunk.empty()) {
+            parser.Finish();
+            more = false;
+        } else {
+            parser.Feed(chunk.data(), chunk.size());
+        }
+
+        while (!closed.empty()) {
+            shared_ptr<HtmlElement> e = closed.front();
+            closed.pop_front();
+            if (!rule.empty()) {
+                std::vector<shared_ptr<HtmlElement> > matched;
+                e->SelectElement(rule, matched);
+                if (matched.empty() || matched[0] != e) continue;
+            }
+
+            co_yield e;
+        }
+    }
+}
+
+#endif
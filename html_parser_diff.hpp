@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Tree diff of two versions of a document for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_DIFF_HPP_
+#define HTMLPARSER_DIFF_HPP_
+
+#include "html_parser.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+enum HtmlChangeKind {
+    HTML_CHANGE_ADDED,
+    HTML_CHANGE_REMOVED,
+    HTML_CHANGE_MODIFIED    // name kept, attributes or value changed
+};
+
+/**
+ * struct HtmlChange
+ * an element that differs between two versions, before is null for an
+ * added element and after for a removed one. changes below a modified
+ * element are reported by themselves, text by its plain elements.
+ */
+struct HtmlChange {
+    HtmlChangeKind kind;
+    shared_ptr<HtmlElement> before;
+    shared_ptr<HtmlElement> after;
+};
+
+/**
+ * class HtmlTreeDiff
+ * compares two trees parsed with HtmlParser::SetSubtreeHashes and the same
+ * options. subtrees with equal hashes are skipped without being walked
+ * (nor built when lazy), so the work follows the changed elements and the
+ * sibling lists they are in, not the size of the document. children are
+ * matched by hash first, an element moved among its siblings is no change,
+ * the rest is paired in order by name. without hashes every element is compared.
+ */
+class HtmlTreeDiff {
+public:
+    static std::vector<HtmlChange> Compare(const shared_ptr<HtmlDocument> &before,
+                                           const shared_ptr<HtmlDocument> &after) {
+        std::vector<HtmlChange> changes;
+        std::vector<HtmlChange> pending;
+        Children(before->GetRoot(), after->GetRoot(), pending);
+        Run(pending, changes);
+        return changes;
+    }
+
+    static std::vector<HtmlChange> Compare(const shared_ptr<HtmlElement> &before,
+                                           const shared_ptr<HtmlElement> &after) {
+        std::vector<HtmlChange> changes;
+        std::vector<HtmlChange> pending;
+        if (before->name == after->name) {
+            Add(pending, HTML_CHANGE_MODIFIED, before, after);
+        } else {
+            Add(pending, HTML_CHANGE_REMOVED, before, shared_ptr<HtmlElement>());
+            Add(pending, HTML_CHANGE_ADDED, shared_ptr<HtmlElement>(), after);
+        }
+
+        Run(pending, changes);
+        return changes;
+    }
+
+private:
+    static bool Same(const HtmlElement *a, const HtmlElement *b) {
+        return a->hash != 0 && a->hash == b->hash;
+    }
+
+    static void Add(std::vector<HtmlChange> &changes, HtmlChangeKind kind, const shared_ptr<HtmlElement> &before,
+                    const shared_ptr<HtmlElement> &after) {
+        HtmlChange change;
+        change.kind = kind;
+        change.before = before;
+        change.after = after;
+        changes.push_back(change);
+    }
+
+    /**
+     * the two trees are walked in step, so not by HtmlElement::Walk but
+     * with a stack of the sibling lists being compared. a pending
+     * "modified" is a pair of elements with the same name still to
+     * compare, the other kinds are changes already found.
+     */
+    static void Run(std::vector<HtmlChange> &pending, std::vector<HtmlChange> &changes) {
+        std::vector<std::pair<std::vector<HtmlChange>, size_t> > stack;
+        stack.push_back(std::make_pair(std::vector<HtmlChange>(), size_t(0)));
+        stack.back().first.swap(pending);
+        while (!stack.empty()) {
+            std::pair<std::vector<HtmlChange>, size_t> &top = stack.back();
+            if (top.second == top.first.size()) {
+                stack.pop_back();
+                continue;
+            }
+
+            HtmlChange change = top.first[top.second++];
+            if (change.kind != HTML_CHANGE_MODIFIED) {
+                changes.push_back(change);
+                continue;
+            }
+
+            const shared_ptr<HtmlElement> &a = change.before;
+            const shared_ptr<HtmlElement> &b = change.after;
+            if (Same(a.get(), b.get())) continue;
+
+            if (a->Attributes() != b->Attributes() || a->Value() != b->Value()) {
+                changes.push_back(change);
+            }
+
+            stack.push_back(std::make_pair(std::vector<HtmlChange>(), size_t(0)));
+            Children(a, b, stack.back().first);
+        }
+    }
+
+    /**
+     * the changes of the children of a and b in order, the pairs to
+     * compare below them left pending.
+     */
+    static void Children(const shared_ptr<HtmlElement> &a, const shared_ptr<HtmlElement> &b,
+                         std::vector<HtmlChange> &pending) {
+        a->Expand();
+        b->Expand();
+        const std::vector<shared_ptr<HtmlElement> > &x = a->children;
+        const std::vector<shared_ptr<HtmlElement> > &y = b->children;
+
+        // the unchanged ends are passed over first
+        size_t begin = 0;
+        while (begin < x.size() && begin < y.size() && Same(x[begin].get(), y[begin].get())) begin++;
+
+        size_t x_end = x.size();
+        size_t y_end = y.size();
+        while (x_end > begin && y_end > begin && Same(x[x_end - 1].get(), y[y_end - 1].get())) {
+            x_end--;
+            y_end--;
+        }
+
+        if (begin == x_end) {
+            for (size_t j = begin; j < y_end; j++) Add(pending, HTML_CHANGE_ADDED, shared_ptr<HtmlElement>(), y[j]);
+            return;
+        }
+
+        if (begin == y_end) {
+            for (size_t i = begin; i < x_end; i++) Add(pending, HTML_CHANGE_REMOVED, x[i], shared_ptr<HtmlElement>());
+            return;
+        }
+
+        // equal subtrees that moved
+        std::unordered_map<uint64_t, std::vector<size_t> > by_hash;
+        for (size_t i = x_end; i > begin; i--) {
+            if (x[i - 1]->hash) by_hash[x[i - 1]->hash].push_back(i - 1);
+        }
+
+        std::vector<char> x_used(x_end - begin, 0);
+        std::vector<char> y_used(y_end - begin, 0);
+        for (size_t j = begin; j < y_end; j++) {
+            std::unordered_map<uint64_t, std::vector<size_t> >::iterator it = by_hash.find(y[j]->hash);
+            if (it == by_hash.end() || it->second.empty()) continue;
+
+            x_used[it->second.back() - begin] = 1;
+            y_used[j - begin] = 1;
+            it->second.pop_back();
+        }
+
+        // the others are paired in order by name
+        std::unordered_map<std::string, std::deque<size_t> > by_name;
+        for (size_t i = begin; i < x_end; i++) {
+            if (!x_used[i - begin]) by_name[x[i]->name].push_back(i);
+        }
+
+        for (size_t j = begin; j < y_end; j++) {
+            if (y_used[j - begin]) continue;
+
+            std::unordered_map<std::string, std::deque<size_t> >::iterator it = by_name.find(y[j]->name);
+            if (it == by_name.end() || it->second.empty()) {
+                Add(pending, HTML_CHANGE_ADDED, shared_ptr<HtmlElement>(), y[j]);
+                continue;
+            }
+
+            size_t i = it->second.front();
+            it->second.pop_front();
+            x_used[i - begin] = 1;
+            Add(pending, HTML_CHANGE_MODIFIED, x[i], y[j]);
+        }
+
+        for (size_t i = begin; i < x_end; i++) {
+            if (!x_used[i - begin]) Add(pending, HTML_CHANGE_REMOVED, x[i], shared_ptr<HtmlElement>());
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,1082 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Character reference decoding for html_parser.hpp, which includes it.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_ENTITY_HPP_
+#define HTMLPARSER_ENTITY_HPP_
+
+#include <stdint.h>
+#include <cstring>
+#include <string>
+#include <algorithm>
+
+/**
+ * class HtmlEntity
+ * decodes the named character references of the html5 table and numeric
+ * ones, the way the html5 tokenizer does.
+ */
+class HtmlEntity {
+public:
+    friend class HtmlDecoder;
+
+    /**
+     * decodes the references in str in place, a string without '&' is
+     * neither copied nor changed. in an attribute value a named reference
+     * without ';' is kept when '=' or an alphanumeric follows it.
+     */
+    static void Decode(std::string &str, bool attribute) {
+        const char *begin = str.data();
+        const char *end = begin + str.size();
+        const char *amp = (const char *) memchr(begin, '&', str.size());
+        if (!amp) return;
+
+        std::string out;
+        out.reserve(str.size());
+        const char *p = begin;
+        while (amp) {
+            out.append(p, amp - p);
+            size_t used = Reference(amp, end, attribute, out);
+            if (!used) {
+                out.append(1, '&');
+                used = 1;
+            }
+
+            p = amp + used;
+            amp = (const char *) memchr(p, '&', end - p);
+        }
+
+        out.append(p, end - p);
+        str.swap(out);
+    }
+
+    /**
+     * appends data to out escaped for html: '&' and '<' in text, '&' and
+     * '"' in an attribute value.
+     */
+    static void Escape(const char *data, size_t len, bool attribute, std::string &out) {
+        const char *p = data;
+        const char *end = data + len;
+        for (const char *q = data; q < end; q++) {
+            const char *escaped = NULL;
+            if (*q == '&') {
+                escaped = "&amp;";
+            } else if (*q == '<' && !attribute) {
+                escaped = "&lt;";
+            } else if (*q == '"' && attribute) {
+                escaped = "&quot;";
+            }
+
+            if (escaped) {
+                out.append(p, q - p);
+                out.append(escaped);
+                p = q + 1;
+            }
+        }
+
+        out.append(p, end - p);
+    }
+
+    /**
+     * @param name a name of the table, with its ';' if it has one
+     * @param first the code point it stands for
+     * @param second a second code point, 0 for most names
+     */
+    static bool Lookup(const char *name, size_t len, uint32_t &first, uint32_t &second) {
+        struct Entry {
+            unsigned short name;
+            unsigned char len;
+            uint32_t first;
+            unsigned short second;
+        };
+
+        // generated from the html5 named character reference table
+        static const char names[] =
+            "AElig;AMP;Aacute;Abreve;Acirc;Acy;Afr;Agrave;Alpha;Amacr;And;Aogon;Aopf;ApplyFunction;Aring;Ascr"
+            ";Assign;Atilde;Auml;Backslash;Barv;Barwed;Bcy;Because;Bernoullis;Beta;Bfr;Bopf;Breve;Bscr;Bumpeq"
+            ";CHcy;COPY;Cacute;Cap;CapitalDifferentialD;Cayleys;Ccaron;Ccedil;Ccirc;Cconint;Cdot;Cedilla;Cent"
+            "erDot;Cfr;Chi;CircleDot;CircleMinus;CirclePlus;CircleTimes;ClockwiseContourIntegral;CloseCurlyDo"
+            "ubleQuote;CloseCurlyQuote;Colon;Colone;Congruent;Conint;ContourIntegral;Copf;Coproduct;CounterCl"
+            "ockwiseContourIntegral;Cross;Cscr;Cup;CupCap;DD;DDotrahd;DJcy;DScy;DZcy;Dagger;Darr;Dashv;Dcaron"
+            ";Dcy;Del;Delta;Dfr;DiacriticalAcute;DiacriticalDot;DiacriticalDoubleAcute;DiacriticalGrave;Diacr"
+            "iticalTilde;Diamond;DifferentialD;Dopf;Dot;DotDot;DotEqual;DoubleContourIntegral;DoubleDot;Doubl"
+            "eDownArrow;DoubleLeftArrow;DoubleLeftRightArrow;DoubleLeftTee;DoubleLongLeftArrow;DoubleLongLeft"
+            "RightArrow;DoubleLongRightArrow;DoubleRightArrow;DoubleRightTee;DoubleUpArrow;DoubleUpDownArrow;"
+            "DoubleVerticalBar;DownArrow;DownArrowBar;DownArrowUpArrow;DownBreve;DownLeftRightVector;DownLeft"
+            "TeeVector;DownLeftVector;DownLeftVectorBar;DownRightTeeVector;DownRightVector;DownRightVectorBar"
+            ";DownTee;DownTeeArrow;Downarrow;Dscr;Dstrok;ENG;ETH;Eacute;Ecaron;Ecirc;Ecy;Edot;Efr;Egrave;Elem"
+            "ent;Emacr;EmptySmallSquare;EmptyVerySmallSquare;Eogon;Eopf;Epsilon;Equal;EqualTilde;Equilibrium;"
+            "Escr;Esim;Eta;Euml;Exists;ExponentialE;Fcy;Ffr;FilledSmallSquare;FilledVerySmallSquare;Fopf;ForA"
+            "ll;Fouriertrf;Fscr;GJcy;GT;Gamma;Gammad;Gbreve;Gcedil;Gcirc;Gcy;Gdot;Gfr;Gg;Gopf;GreaterEqual;Gr"
+            "eaterEqualLess;GreaterFullEqual;GreaterGreater;GreaterLess;GreaterSlantEqual;GreaterTilde;Gscr;G"
+            "t;HARDcy;Hacek;Hat;Hcirc;Hfr;HilbertSpace;Hopf;HorizontalLine;Hscr;Hstrok;HumpDownHump;HumpEqual"
+            ";IEcy;IJlig;IOcy;Iacute;Icirc;Icy;Idot;Ifr;Igrave;Im;Imacr;ImaginaryI;Implies;Int;Integral;Inter"
+            "section;InvisibleComma;InvisibleTimes;Iogon;Iopf;Iota;Iscr;Itilde;Iukcy;Iuml;Jcirc;Jcy;Jfr;Jopf;"
+            "Jscr;Jsercy;Jukcy;KHcy;KJcy;Kappa;Kcedil;Kcy;Kfr;Kopf;Kscr;LJcy;LT;Lacute;Lambda;Lang;Laplacetrf"
+            ";Larr;Lcaron;Lcedil;Lcy;LeftAngleBracket;LeftArrow;LeftArrowBar;LeftArrowRightArrow;LeftCeiling;"
+            "LeftDoubleBracket;LeftDownTeeVector;LeftDownVector;LeftDownVectorBar;LeftFloor;LeftRightArrow;Le"
+            "ftRightVector;LeftTee;LeftTeeArrow;LeftTeeVector;LeftTriangle;LeftTriangleBar;LeftTriangleEqual;"
+            "LeftUpDownVector;LeftUpTeeVector;LeftUpVector;LeftUpVectorBar;LeftVector;LeftVectorBar;Leftarrow"
+            ";Leftrightarrow;LessEqualGreater;LessFullEqual;LessGreater;LessLess;LessSlantEqual;LessTilde;Lfr"
+            ";Ll;Lleftarrow;Lmidot;LongLeftArrow;LongLeftRightArrow;LongRightArrow;Longleftarrow;Longleftrigh"
+            "tarrow;Longrightarrow;Lopf;LowerLeftArrow;LowerRightArrow;Lscr;Lsh;Lstrok;Lt;Map;Mcy;MediumSpace"
+            ";Mellintrf;Mfr;MinusPlus;Mopf;Mscr;Mu;NJcy;Nacute;Ncaron;Ncedil;Ncy;NegativeMediumSpace;Negative"
+            "ThickSpace;NegativeThinSpace;NegativeVeryThinSpace;NestedGreaterGreater;NestedLessLess;NewLine;N"
+            "fr;NoBreak;NonBreakingSpace;Nopf;Not;NotCongruent;NotCupCap;NotDoubleVerticalBar;NotElement;NotE"
+            "qual;NotEqualTilde;NotExists;NotGreater;NotGreaterEqual;NotGreaterFullEqual;NotGreaterGreater;No"
+            "tGreaterLess;NotGreaterSlantEqual;NotGreaterTilde;NotHumpDownHump;NotHumpEqual;NotLeftTriangle;N"
+            "otLeftTriangleBar;NotLeftTriangleEqual;NotLess;NotLessEqual;NotLessGreater;NotLessLess;NotLessSl"
+            "antEqual;NotLessTilde;NotNestedGreaterGreater;NotNestedLessLess;NotPrecedes;NotPrecedesEqual;Not"
+            "PrecedesSlantEqual;NotReverseElement;NotRightTriangle;NotRightTriangleBar;NotRightTriangleEqual;"
+            "NotSquareSubset;NotSquareSubsetEqual;NotSquareSuperset;NotSquareSupersetEqual;NotSubset;NotSubse"
+            "tEqual;NotSucceeds;NotSucceedsEqual;NotSucceedsSlantEqual;NotSucceedsTilde;NotSuperset;NotSupers"
+            "etEqual;NotTilde;NotTildeEqual;NotTildeFullEqual;NotTildeTilde;NotVerticalBar;Nscr;Ntilde;Nu;OEl"
+            "ig;Oacute;Ocirc;Ocy;Odblac;Ofr;Ograve;Omacr;Omega;Omicron;Oopf;OpenCurlyDoubleQuote;OpenCurlyQuo"
+            "te;Or;Oscr;Oslash;Otilde;Otimes;Ouml;OverBar;OverBrace;OverBracket;OverParenthesis;PartialD;Pcy;"
+            "Pfr;Phi;Pi;PlusMinus;Poincareplane;Popf;Pr;Precedes;PrecedesEqual;PrecedesSlantEqual;PrecedesTil"
+            "de;Prime;Product;Proportion;Proportional;Pscr;Psi;QUOT;Qfr;Qopf;Qscr;RBarr;REG;Racute;Rang;Rarr;"
+            "Rarrtl;Rcaron;Rcedil;Rcy;Re;ReverseElement;ReverseEquilibrium;ReverseUpEquilibrium;Rfr;Rho;Right"
+            "AngleBracket;RightArrow;RightArrowBar;RightArrowLeftArrow;RightCeiling;RightDoubleBracket;RightD"
+            "ownTeeVector;RightDownVector;RightDownVectorBar;RightFloor;RightTee;RightTeeArrow;RightTeeVector"
+            ";RightTriangle;RightTriangleBar;RightTriangleEqual;RightUpDownVector;RightUpTeeVector;RightUpVec"
+            "tor;RightUpVectorBar;RightVector;RightVectorBar;Rightarrow;Ropf;RoundImplies;Rrightarrow;Rscr;Rs"
+            "h;RuleDelayed;SHCHcy;SHcy;SOFTcy;Sacute;Sc;Scaron;Scedil;Scirc;Scy;Sfr;ShortDownArrow;ShortLeftA"
+            "rrow;ShortRightArrow;ShortUpArrow;Sigma;SmallCircle;Sopf;Sqrt;Square;SquareIntersection;SquareSu"
+            "bset;SquareSubsetEqual;SquareSuperset;SquareSupersetEqual;SquareUnion;Sscr;Star;Sub;Subset;Subse"
+            "tEqual;Succeeds;SucceedsEqual;SucceedsSlantEqual;SucceedsTilde;SuchThat;Sum;Sup;Superset;Superse"
+            "tEqual;Supset;THORN;TRADE;TSHcy;TScy;Tab;Tau;Tcaron;Tcedil;Tcy;Tfr;Therefore;Theta;ThickSpace;Th"
+            "inSpace;Tilde;TildeEqual;TildeFullEqual;TildeTilde;Topf;TripleDot;Tscr;Tstrok;Uacute;Uarr;Uarroc"
+            "ir;Ubrcy;Ubreve;Ucirc;Ucy;Udblac;Ufr;Ugrave;Umacr;UnderBar;UnderBrace;UnderBracket;UnderParenthe"
+            "sis;Union;UnionPlus;Uogon;Uopf;UpArrow;UpArrowBar;UpArrowDownArrow;UpDownArrow;UpEquilibrium;UpT"
+            "ee;UpTeeArrow;Uparrow;Updownarrow;UpperLeftArrow;UpperRightArrow;Upsi;Upsilon;Uring;Uscr;Utilde;"
+            "Uuml;VDash;Vbar;Vcy;Vdash;Vdashl;Vee;Verbar;Vert;VerticalBar;VerticalLine;VerticalSeparator;Vert"
+            "icalTilde;VeryThinSpace;Vfr;Vopf;Vscr;Vvdash;Wcirc;Wedge;Wfr;Wopf;Wscr;Xfr;Xi;Xopf;Xscr;YAcy;YIc"
+            "y;YUcy;Yacute;Ycirc;Ycy;Yfr;Yopf;Yscr;Yuml;ZHcy;Zacute;Zcaron;Zcy;Zdot;ZeroWidthSpace;Zeta;Zfr;Z"
+            "opf;Zscr;aacute;abreve;ac;acE;acd;acirc;acute;acy;aelig;af;afr;agrave;alefsym;aleph;alpha;amacr;"
+            "amalg;amp;and;andand;andd;andslope;andv;ang;ange;angle;angmsd;angmsdaa;angmsdab;angmsdac;angmsda"
+            "d;angmsdae;angmsdaf;angmsdag;angmsdah;angrt;angrtvb;angrtvbd;angsph;angst;angzarr;aogon;aopf;ap;"
+            "apE;apacir;ape;apid;apos;approx;approxeq;aring;ascr;ast;asymp;asympeq;atilde;auml;awconint;awint"
+            ";bNot;backcong;backepsilon;backprime;backsim;backsimeq;barvee;barwed;barwedge;bbrk;bbrktbrk;bcon"
+            "g;bcy;bdquo;becaus;because;bemptyv;bepsi;bernou;beta;beth;between;bfr;bigcap;bigcirc;bigcup;bigo"
+            "dot;bigoplus;bigotimes;bigsqcup;bigstar;bigtriangledown;bigtriangleup;biguplus;bigvee;bigwedge;b"
+            "karow;blacklozenge;blacksquare;blacktriangle;blacktriangledown;blacktriangleleft;blacktriangleri"
+            "ght;blank;blk12;blk14;blk34;block;bne;bnequiv;bnot;bopf;bot;bottom;bowtie;boxDL;boxDR;boxDl;boxD"
+            "r;boxH;boxHD;boxHU;boxHd;boxHu;boxUL;boxUR;boxUl;boxUr;boxV;boxVH;boxVL;boxVR;boxVh;boxVl;boxVr;"
+            "boxbox;boxdL;boxdR;boxdl;boxdr;boxh;boxhD;boxhU;boxhd;boxhu;boxminus;boxplus;boxtimes;boxuL;boxu"
+            "R;boxul;boxur;boxv;boxvH;boxvL;boxvR;boxvh;boxvl;boxvr;bprime;breve;brvbar;bscr;bsemi;bsim;bsime"
+            ";bsol;bsolb;bsolhsub;bull;bullet;bump;bumpE;bumpe;bumpeq;cacute;cap;capand;capbrcup;capcap;capcu"
+            "p;capdot;caps;caret;caron;ccaps;ccaron;ccedil;ccirc;ccups;ccupssm;cdot;cedil;cemptyv;cent;center"
+            "dot;cfr;chcy;check;checkmark;chi;cir;cirE;circ;circeq;circlearrowleft;circlearrowright;circledR;"
+            "circledS;circledast;circledcirc;circleddash;cire;cirfnint;cirmid;cirscir;clubs;clubsuit;colon;co"
+            "lone;coloneq;comma;commat;comp;compfn;complement;complexes;cong;congdot;conint;copf;coprod;copy;"
+            "copysr;crarr;cross;cscr;csub;csube;csup;csupe;ctdot;cudarrl;cudarrr;cuepr;cuesc;cularr;cularrp;c"
+            "up;cupbrcap;cupcap;cupcup;cupdot;cupor;cups;curarr;curarrm;curlyeqprec;curlyeqsucc;curlyvee;curl"
+            "ywedge;curren;curvearrowleft;curvearrowright;cuvee;cuwed;cwconint;cwint;cylcty;dArr;dHar;dagger;"
+            "daleth;darr;dash;dashv;dbkarow;dblac;dcaron;dcy;dd;ddagger;ddarr;ddotseq;deg;delta;demptyv;dfish"
+            "t;dfr;dharl;dharr;diam;diamond;diamondsuit;diams;die;digamma;disin;div;divide;divideontimes;divo"
+            "nx;djcy;dlcorn;dlcrop;dollar;dopf;dot;doteq;doteqdot;dotminus;dotplus;dotsquare;doublebarwedge;d"
+            "ownarrow;downdownarrows;downharpoonleft;downharpoonright;drbkarow;drcorn;drcrop;dscr;dscy;dsol;d"
+            "strok;dtdot;dtri;dtrif;duarr;duhar;dwangle;dzcy;dzigrarr;eDDot;eDot;eacute;easter;ecaron;ecir;ec"
+            "irc;ecolon;ecy;edot;ee;efDot;efr;eg;egrave;egs;egsdot;el;elinters;ell;els;elsdot;emacr;empty;emp"
+            "tyset;emptyv;emsp13;emsp14;emsp;eng;ensp;eogon;eopf;epar;eparsl;eplus;epsi;epsilon;epsiv;eqcirc;"
+            "eqcolon;eqsim;eqslantgtr;eqslantless;equals;equest;equiv;equivDD;eqvparsl;erDot;erarr;escr;esdot"
+            ";esim;eta;eth;euml;euro;excl;exist;expectation;exponentiale;fallingdotseq;fcy;female;ffilig;ffli"
+            "g;ffllig;ffr;filig;fjlig;flat;fllig;fltns;fnof;fopf;forall;fork;forkv;fpartint;frac12;frac13;fra"
+            "c14;frac15;frac16;frac18;frac23;frac25;frac34;frac35;frac38;frac45;frac56;frac58;frac78;frasl;fr"
+            "own;fscr;gE;gEl;gacute;gamma;gammad;gap;gbreve;gcirc;gcy;gdot;ge;gel;geq;geqq;geqslant;ges;gescc"
+            ";gesdot;gesdoto;gesdotol;gesl;gesles;gfr;gg;ggg;gimel;gjcy;gl;glE;gla;glj;gnE;gnap;gnapprox;gne;"
+            "gneq;gneqq;gnsim;gopf;grave;gscr;gsim;gsime;gsiml;gt;gtcc;gtcir;gtdot;gtlPar;gtquest;gtrapprox;g"
+            "trarr;gtrdot;gtreqless;gtreqqless;gtrless;gtrsim;gvertneqq;gvnE;hArr;hairsp;half;hamilt;hardcy;h"
+            "arr;harrcir;harrw;hbar;hcirc;hearts;heartsuit;hellip;hercon;hfr;hksearow;hkswarow;hoarr;homtht;h"
+            "ookleftarrow;hookrightarrow;hopf;horbar;hscr;hslash;hstrok;hybull;hyphen;iacute;ic;icirc;icy;iec"
+            "y;iexcl;iff;ifr;igrave;ii;iiiint;iiint;iinfin;iiota;ijlig;imacr;image;imagline;imagpart;imath;im"
+            "of;imped;in;incare;infin;infintie;inodot;int;intcal;integers;intercal;intlarhk;intprod;iocy;iogo"
+            "n;iopf;iota;iprod;iquest;iscr;isin;isinE;isindot;isins;isinsv;isinv;it;itilde;iukcy;iuml;jcirc;j"
+            "cy;jfr;jmath;jopf;jscr;jsercy;jukcy;kappa;kappav;kcedil;kcy;kfr;kgreen;khcy;kjcy;kopf;kscr;lAarr"
+            ";lArr;lAtail;lBarr;lE;lEg;lHar;lacute;laemptyv;lagran;lambda;lang;langd;langle;lap;laquo;larr;la"
+            "rrb;larrbfs;larrfs;larrhk;larrlp;larrpl;larrsim;larrtl;lat;latail;late;lates;lbarr;lbbrk;lbrace;"
+            "lbrack;lbrke;lbrksld;lbrkslu;lcaron;lcedil;lceil;lcub;lcy;ldca;ldquo;ldquor;ldrdhar;ldrushar;lds"
+            "h;le;leftarrow;leftarrowtail;leftharpoondown;leftharpoonup;leftleftarrows;leftrightarrow;leftrig"
+            "htarrows;leftrightharpoons;leftrightsquigarrow;leftthreetimes;leg;leq;leqq;leqslant;les;lescc;le"
+            "sdot;lesdoto;lesdotor;lesg;lesges;lessapprox;lessdot;lesseqgtr;lesseqqgtr;lessgtr;lesssim;lfisht"
+            ";lfloor;lfr;lg;lgE;lhard;lharu;lharul;lhblk;ljcy;ll;llarr;llcorner;llhard;lltri;lmidot;lmoust;lm"
+            "oustache;lnE;lnap;lnapprox;lne;lneq;lneqq;lnsim;loang;loarr;lobrk;longleftarrow;longleftrightarr"
+            "ow;longmapsto;longrightarrow;looparrowleft;looparrowright;lopar;lopf;loplus;lotimes;lowast;lowba"
+            "r;loz;lozenge;lozf;lpar;lparlt;lrarr;lrcorner;lrhar;lrhard;lrm;lrtri;lsaquo;lscr;lsh;lsim;lsime;"
+            "lsimg;lsqb;lsquo;lsquor;lstrok;lt;ltcc;ltcir;ltdot;lthree;ltimes;ltlarr;ltquest;ltrPar;ltri;ltri"
+            "e;ltrif;lurdshar;luruhar;lvertneqq;lvnE;mDDot;macr;male;malt;maltese;map;mapsto;mapstodown;mapst"
+            "oleft;mapstoup;marker;mcomma;mcy;mdash;measuredangle;mfr;mho;micro;mid;midast;midcir;middot;minu"
+            "s;minusb;minusd;minusdu;mlcp;mldr;mnplus;models;mopf;mp;mscr;mstpos;mu;multimap;mumap;nGg;nGt;nG"
+            "tv;nLeftarrow;nLeftrightarrow;nLl;nLt;nLtv;nRightarrow;nVDash;nVdash;nabla;nacute;nang;nap;napE;"
+            "napid;napos;napprox;natur;natural;naturals;nbsp;nbump;nbumpe;ncap;ncaron;ncedil;ncong;ncongdot;n"
+            "cup;ncy;ndash;ne;neArr;nearhk;nearr;nearrow;nedot;nequiv;nesear;nesim;nexist;nexists;nfr;ngE;nge"
+            ";ngeq;ngeqq;ngeqslant;nges;ngsim;ngt;ngtr;nhArr;nharr;nhpar;ni;nis;nisd;niv;njcy;nlArr;nlE;nlarr"
+            ";nldr;nle;nleftarrow;nleftrightarrow;nleq;nleqq;nleqslant;nles;nless;nlsim;nlt;nltri;nltrie;nmid"
+            ";nopf;not;notin;notinE;notindot;notinva;notinvb;notinvc;notni;notniva;notnivb;notnivc;npar;npara"
+            "llel;nparsl;npart;npolint;npr;nprcue;npre;nprec;npreceq;nrArr;nrarr;nrarrc;nrarrw;nrightarrow;nr"
+            "tri;nrtrie;nsc;nsccue;nsce;nscr;nshortmid;nshortparallel;nsim;nsime;nsimeq;nsmid;nspar;nsqsube;n"
+            "sqsupe;nsub;nsubE;nsube;nsubset;nsubseteq;nsubseteqq;nsucc;nsucceq;nsup;nsupE;nsupe;nsupset;nsup"
+            "seteq;nsupseteqq;ntgl;ntilde;ntlg;ntriangleleft;ntrianglelefteq;ntriangleright;ntrianglerighteq;"
+            "nu;num;numero;numsp;nvDash;nvHarr;nvap;nvdash;nvge;nvgt;nvinfin;nvlArr;nvle;nvlt;nvltrie;nvrArr;"
+            "nvrtrie;nvsim;nwArr;nwarhk;nwarr;nwarrow;nwnear;oS;oacute;oast;ocir;ocirc;ocy;odash;odblac;odiv;"
+            "odot;odsold;oelig;ofcir;ofr;ogon;ograve;ogt;ohbar;ohm;oint;olarr;olcir;olcross;oline;olt;omacr;o"
+            "mega;omicron;omid;ominus;oopf;opar;operp;oplus;or;orarr;ord;order;orderof;ordf;ordm;origof;oror;"
+            "orslope;orv;oscr;oslash;osol;otilde;otimes;otimesas;ouml;ovbar;par;para;parallel;parsim;parsl;pa"
+            "rt;pcy;percnt;period;permil;perp;pertenk;pfr;phi;phiv;phmmat;phone;pi;pitchfork;piv;planck;planc"
+            "kh;plankv;plus;plusacir;plusb;pluscir;plusdo;plusdu;pluse;plusmn;plussim;plustwo;pm;pointint;pop"
+            "f;pound;pr;prE;prap;prcue;pre;prec;precapprox;preccurlyeq;preceq;precnapprox;precneqq;precnsim;p"
+            "recsim;prime;primes;prnE;prnap;prnsim;prod;profalar;profline;profsurf;prop;propto;prsim;prurel;p"
+            "scr;psi;puncsp;qfr;qint;qopf;qprime;qscr;quaternions;quatint;quest;questeq;quot;rAarr;rArr;rAtai"
+            "l;rBarr;rHar;race;racute;radic;raemptyv;rang;rangd;range;rangle;raquo;rarr;rarrap;rarrb;rarrbfs;"
+            "rarrc;rarrfs;rarrhk;rarrlp;rarrpl;rarrsim;rarrtl;rarrw;ratail;ratio;rationals;rbarr;rbbrk;rbrace"
+            ";rbrack;rbrke;rbrksld;rbrkslu;rcaron;rcedil;rceil;rcub;rcy;rdca;rdldhar;rdquo;rdquor;rdsh;real;r"
+            "ealine;realpart;reals;rect;reg;rfisht;rfloor;rfr;rhard;rharu;rharul;rho;rhov;rightarrow;rightarr"
+            "owtail;rightharpoondown;rightharpoonup;rightleftarrows;rightleftharpoons;rightrightarrows;rights"
+            "quigarrow;rightthreetimes;ring;risingdotseq;rlarr;rlhar;rlm;rmoust;rmoustache;rnmid;roang;roarr;"
+            "robrk;ropar;ropf;roplus;rotimes;rpar;rpargt;rppolint;rrarr;rsaquo;rscr;rsh;rsqb;rsquo;rsquor;rth"
+            "ree;rtimes;rtri;rtrie;rtrif;rtriltri;ruluhar;rx;sacute;sbquo;sc;scE;scap;scaron;sccue;sce;scedil"
+            ";scirc;scnE;scnap;scnsim;scpolint;scsim;scy;sdot;sdotb;sdote;seArr;searhk;searr;searrow;sect;sem"
+            "i;seswar;setminus;setmn;sext;sfr;sfrown;sharp;shchcy;shcy;shortmid;shortparallel;shy;sigma;sigma"
+            "f;sigmav;sim;simdot;sime;simeq;simg;simgE;siml;simlE;simne;simplus;simrarr;slarr;smallsetminus;s"
+            "mashp;smeparsl;smid;smile;smt;smte;smtes;softcy;sol;solb;solbar;sopf;spades;spadesuit;spar;sqcap"
+            ";sqcaps;sqcup;sqcups;sqsub;sqsube;sqsubset;sqsubseteq;sqsup;sqsupe;sqsupset;sqsupseteq;squ;squar"
+            "e;squarf;squf;srarr;sscr;ssetmn;ssmile;sstarf;star;starf;straightepsilon;straightphi;strns;sub;s"
+            "ubE;subdot;sube;subedot;submult;subnE;subne;subplus;subrarr;subset;subseteq;subseteqq;subsetneq;"
+            "subsetneqq;subsim;subsub;subsup;succ;succapprox;succcurlyeq;succeq;succnapprox;succneqq;succnsim"
+            ";succsim;sum;sung;sup1;sup2;sup3;sup;supE;supdot;supdsub;supe;supedot;suphsol;suphsub;suplarr;su"
+            "pmult;supnE;supne;supplus;supset;supseteq;supseteqq;supsetneq;supsetneqq;supsim;supsub;supsup;sw"
+            "Arr;swarhk;swarr;swarrow;swnwar;szlig;target;tau;tbrk;tcaron;tcedil;tcy;tdot;telrec;tfr;there4;t"
+            "herefore;theta;thetasym;thetav;thickapprox;thicksim;thinsp;thkap;thksim;thorn;tilde;times;timesb"
+            ";timesbar;timesd;tint;toea;top;topbot;topcir;topf;topfork;tosa;tprime;trade;triangle;triangledow"
+            "n;triangleleft;trianglelefteq;triangleq;triangleright;trianglerighteq;tridot;trie;triminus;tripl"
+            "us;trisb;tritime;trpezium;tscr;tscy;tshcy;tstrok;twixt;twoheadleftarrow;twoheadrightarrow;uArr;u"
+            "Har;uacute;uarr;ubrcy;ubreve;ucirc;ucy;udarr;udblac;udhar;ufisht;ufr;ugrave;uharl;uharr;uhblk;ul"
+            "corn;ulcorner;ulcrop;ultri;umacr;uml;uogon;uopf;uparrow;updownarrow;upharpoonleft;upharpoonright"
+            ";uplus;upsi;upsih;upsilon;upuparrows;urcorn;urcorner;urcrop;uring;urtri;uscr;utdot;utilde;utri;u"
+            "trif;uuarr;uuml;uwangle;vArr;vBar;vBarv;vDash;vangrt;varepsilon;varkappa;varnothing;varphi;varpi"
+            ";varpropto;varr;varrho;varsigma;varsubsetneq;varsubsetneqq;varsupsetneq;varsupsetneqq;vartheta;v"
+            "artriangleleft;vartriangleright;vcy;vdash;vee;veebar;veeeq;vellip;verbar;vert;vfr;vltri;vnsub;vn"
+            "sup;vopf;vprop;vrtri;vscr;vsubnE;vsubne;vsupnE;vsupne;vzigzag;wcirc;wedbar;wedge;wedgeq;weierp;w"
+            "fr;wopf;wp;wr;wreath;wscr;xcap;xcirc;xcup;xdtri;xfr;xhArr;xharr;xi;xlArr;xlarr;xmap;xnis;xodot;x"
+            "opf;xoplus;xotime;xrArr;xrarr;xscr;xsqcup;xuplus;xutri;xvee;xwedge;yacute;yacy;ycirc;ycy;yen;yfr"
+            ";yicy;yopf;yscr;yucy;yuml;zacute;zcaron;zcy;zdot;zeetrf;zeta;zfr;zhcy;zigrarr;zopf;zscr;zwj;zwnj"
+            ";";
+
+        // seed of every bucket, hash(name, 0) % 640 picks the bucket
+        static const unsigned char seed[640] = {
+            1, 2, 5, 59, 7, 92, 1, 6, 4, 4, 1, 3, 73, 22, 12, 5,
+            9, 39, 0, 39, 30, 6, 6, 13, 2, 12, 7, 0, 1, 0, 7, 4,
+            0, 84, 24, 13, 11, 13, 1, 8, 2, 13, 30, 6, 1, 6, 4, 3,
+            18, 1, 30, 7, 1, 4, 6, 1, 4, 4, 2, 1, 30, 4, 4, 1,
+            10, 7, 64, 18, 2, 1, 16, 5, 3, 16, 2, 18, 1, 39, 2, 29,
+            1, 1, 21, 1, 5, 10, 4, 1, 93, 27, 36, 5, 3, 1, 94, 49,
+            2, 22, 17, 84, 1, 34, 1, 12, 3, 2, 1, 15, 7, 34, 80, 39,
+            10, 1, 12, 1, 1, 12, 3, 29, 17, 21, 0, 2, 7, 3, 24, 2,
+            4, 95, 4, 5, 2, 60, 23, 29, 120, 15, 3, 28, 12, 91, 5, 1,
+            5, 18, 5, 39, 4, 1, 66, 7, 1, 1, 3, 4, 21, 8, 60, 30,
+            66, 66, 13, 1, 16, 31, 6, 1, 18, 10, 2, 14, 19, 86, 12, 17,
+            1, 4, 4, 47, 7, 6, 3, 1, 4, 2, 33, 3, 26, 14, 7, 17,
+            8, 33, 45, 13, 1, 14, 17, 12, 41, 18, 33, 3, 6, 1, 29, 1,
+            20, 4, 3, 33, 1, 12, 8, 5, 24, 0, 11, 2, 2, 34, 9, 13,
+            1, 11, 16, 22, 36, 45, 4, 43, 4, 5, 2, 48, 10, 1, 59, 73,
+            23, 32, 33, 21, 13, 2, 35, 20, 31, 1, 41, 19, 130, 73, 75, 39,
+            129, 72, 5, 3, 37, 4, 66, 9, 13, 2, 44, 50, 6, 2, 2, 107,
+            5, 2, 57, 2, 2, 46, 3, 26, 13, 12, 20, 26, 16, 80, 3, 1,
+            9, 6, 6, 15, 6, 15, 15, 1, 121, 23, 7, 4, 22, 0, 5, 2,
+            100, 3, 2, 1, 22, 2, 23, 11, 5, 0, 6, 62, 2, 13, 13, 3,
+            1, 1, 66, 132, 2, 16, 2, 6, 20, 4, 3, 94, 9, 18, 1, 13,
+            11, 27, 0, 14, 4, 15, 2, 1, 5, 29, 18, 1, 25, 1, 2, 30,
+            0, 18, 86, 21, 15, 11, 3, 12, 150, 15, 2, 5, 16, 43, 20, 4,
+            27, 48, 73, 20, 26, 11, 22, 33, 22, 58, 82, 40, 25, 22, 13, 2,
+            26, 10, 22, 6, 2, 1, 10, 71, 8, 7, 11, 102, 6, 10, 13, 3,
+            16, 65, 8, 88, 2, 1, 8, 4, 4, 24, 4, 6, 44, 4, 12, 16,
+            122, 12, 22, 64, 20, 3, 2, 1, 11, 23, 25, 1, 41, 19, 62, 0,
+            21, 75, 15, 5, 4, 5, 0, 34, 9, 11, 77, 24, 1, 2, 15, 47,
+            55, 0, 6, 8, 4, 112, 2, 11, 7, 38, 16, 34, 78, 9, 49, 17,
+            32, 1, 89, 2, 16, 6, 5, 18, 19, 69, 98, 20, 17, 1, 15, 1,
+            11, 3, 60, 1, 3, 72, 4, 20, 4, 3, 91, 70, 12, 3, 3, 5,
+            1, 130, 0, 187, 14, 0, 18, 2, 87, 1, 49, 111, 0, 138, 0, 0,
+            114, 21, 91, 2, 22, 27, 59, 8, 34, 1, 2, 36, 0, 138, 3, 21,
+            10, 9, 20, 34, 3, 1, 16, 9, 152, 52, 4, 4, 54, 47, 13, 44,
+            5, 9, 51, 5, 3, 38, 5, 83, 0, 17, 27, 0, 1, 74, 5, 99,
+            9, 47, 76, 1, 1, 1, 15, 55, 74, 9, 10, 130, 7, 30, 1, 12,
+            14, 16, 0, 13, 3, 11, 3, 62, 7, 74, 7, 18, 135, 50, 40, 23,
+            43, 98, 70, 9, 3, 17, 17, 175, 4, 4, 1, 9, 21, 64, 8, 69,
+            67, 29, 71, 11, 19, 25, 112, 3, 129, 22, 10, 5, 45, 5, 41, 50,
+            19, 1, 8, 2, 7, 70, 67, 87, 8, 2, 1, 10, 2, 1, 1, 9,
+        };
+
+        // hash(name, seed) % 2560 picks the entry: name offset, length, code points
+        static const Entry entry[2560] = {
+            {0, 0, 0, 0}, {7687, 5, 0x2193, 0x0}, {250, 7, 0xC7, 0x0}, {0, 0, 0, 0},
+            {3243, 12, 0x226A, 0x338}, {5006, 5, 0xDE, 0x0}, {0, 0, 0, 0}, {24, 6, 0xC2, 0x0},
+            {13589, 6, 0x21C9, 0x0}, {10339, 7, 0x296B, 0x0}, {1200, 4, 0xD0, 0x0}, {6073, 7, 0x2248, 0x0},
+            {14203, 7, 0x25A1, 0x0}, {9572, 3, 0x2062, 0x0}, {0, 0, 0, 0}, {6349, 10, 0x2A02, 0x0},
+            {667, 17, 0x2DC, 0x0}, {14022, 9, 0x29E4, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {2677, 12, 0x205F, 0x0}, {14720, 6, 0xDF, 0x0}, {2551, 15, 0x27F6, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {10992, 5, 0x1D55E, 0x0}, {5692, 5, 0x1D550, 0x0},
+            {13783, 6, 0x2A66, 0x0}, {15753, 6, 0x221D, 0x0}, {15420, 6, 0x16F, 0x0}, {10985, 7, 0x22A7, 0x0},
+            {6945, 5, 0x224E, 0x0}, {9382, 9, 0x2110, 0x0}, {1745, 7, 0xCD, 0x0}, {2036, 4, 0x41B, 0x0},
+            {7650, 6, 0x2231, 0x0}, {6918, 6, 0x29C5, 0x0}, {13140, 6, 0x2773, 0x0}, {547, 5, 0x40F, 0x0},
+            {15825, 7, 0x2259, 0x0}, {0, 0, 0, 0}, {8857, 5, 0x22DB, 0xFE00}, {15663, 17, 0x22B3, 0x0},
+            {12447, 4, 0x2225, 0x0}, {4002, 19, 0x227C, 0x0}, {0, 0, 0, 0}, {10127, 15, 0x22CB, 0x0},
+            {11262, 6, 0x2197, 0x0}, {15378, 8, 0x3C5, 0x0}, {585, 6, 0x394, 0x0}, {8728, 6, 0x2044, 0x0},
+            {7728, 3, 0x2146, 0x0}, {0, 0, 0, 0}, {7438, 6, 0x22EF, 0x0}, {6830, 5, 0x2502, 0x0},
+            {12362, 5, 0xAA, 0x0}, {5012, 6, 0x2122, 0x0}, {11162, 8, 0x266E, 0x0}, {10239, 11, 0x2A8B, 0x0},
+            {0, 0, 0, 0}, {13196, 6, 0x2309, 0x0}, {11127, 4, 0x2249, 0x0}, {10386, 9, 0x2A89, 0x0},
+            {2689, 10, 0x2133, 0x0}, {9400, 6, 0x131, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {9119, 5, 0x2194, 0x0}, {7875, 5, 0x452, 0x0}, {7942, 10, 0x22A1, 0x0}, {12991, 9, 0x29B3, 0x0},
+            {324, 11, 0x2295, 0x0}, {11043, 11, 0x21CD, 0x0}, {0, 0, 0, 0}, {2883, 8, 0x2060, 0x0},
+            {692, 14, 0x2146, 0x0}, {2795, 18, 0x200B, 0x0}, {0, 0, 0, 0}, {8950, 6, 0x60, 0x0},
+            {15966, 5, 0x1D4CD, 0x0}, {15184, 6, 0x45E, 0x0}, {10909, 6, 0xB5, 0x0}, {4349, 19, 0x2955, 0x0},
+            {3379, 18, 0x220C, 0x0}, {0, 0, 0, 0}, {978, 10, 0x2193, 0x0}, {4073, 5, 0x1D4AB, 0x0},
+            {0, 0, 0, 0}, {6063, 5, 0x224B, 0x0}, {12096, 8, 0x22B5, 0x20D2}, {15250, 6, 0x21BE, 0x0},
+            {5629, 5, 0x1D54E, 0x0}, {0, 0, 0, 0}, {3936, 4, 0x1D513, 0x0}, {0, 0, 0, 0},
+            {1984, 3, 0x3C, 0x0}, {3851, 6, 0xD8, 0x0}, {0, 0, 0, 0}, {12687, 5, 0x2AB7, 0x0},
+            {3788, 6, 0x3A9, 0x0}, {0, 0, 0, 0}, {11190, 7, 0x224F, 0x338}, {14566, 8, 0x27C9, 0x0},
+            {86, 6, 0xC5, 0x0}, {10528, 5, 0x1D55D, 0x0}, {10707, 7, 0x22CB, 0x0}, {14911, 7, 0x2336, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {8793, 5, 0x121, 0x0}, {6584, 4, 0x22A5, 0x0},
+            {11938, 14, 0x22EA, 0x0}, {3802, 5, 0x1D546, 0x0}, {11415, 4, 0x2266, 0x338}, {5651, 5, 0x1D4B3, 0x0},
+            {7906, 4, 0x2D9, 0x0}, {0, 0, 0, 0}, {3151, 16, 0x22EA, 0x0}, {16021, 4, 0x44B, 0x0},
+            {6626, 5, 0x2550, 0x0}, {6980, 7, 0x2A44, 0x0}, {15819, 6, 0x2227, 0x0}, {595, 17, 0xB4, 0x0},
+            {416, 7, 0x2A74, 0x0}, {11240, 6, 0x2013, 0x0}, {13062, 7, 0x291E, 0x0}, {7294, 7, 0x2254, 0x0},
+            {9202, 6, 0x21FF, 0x0}, {1189, 7, 0x110, 0x0}, {12788, 5, 0x2AB5, 0x0}, {7697, 6, 0x22A3, 0x0},
+            {13833, 9, 0x2216, 0x0}, {13286, 7, 0x230B, 0x0}, {5465, 7, 0x168, 0x0}, {0, 0, 0, 0},
+            {3923, 9, 0x2202, 0x0}, {0, 0, 0, 0}, {5144, 10, 0x20DB, 0x0}, {14868, 5, 0xD7, 0x0},
+            {5905, 6, 0x2220, 0x0}, {8326, 5, 0x3B5, 0x0}, {15291, 6, 0x16B, 0x0}, {4149, 4, 0x420, 0x0},
+            {7629, 6, 0x22CE, 0x0}, {5634, 5, 0x1D4B2, 0x0}, {9100, 5, 0xBD, 0x0}, {5029, 4, 0x9, 0x0},
+            {9686, 5, 0x1D4C0, 0x0}, {210, 4, 0x22D2, 0x0}, {15490, 6, 0x2AE9, 0x0}, {8644, 7, 0x2155, 0x0},
+            {0, 0, 0, 0}, {12501, 7, 0x2030, 0x0}, {4516, 17, 0x2954, 0x0}, {8603, 5, 0x22D4, 0x0},
+            {0, 0, 0, 0}, {2673, 4, 0x41C, 0x0}, {0, 0, 0, 0}, {12159, 5, 0x229A, 0x0},
+            {6026, 8, 0x237C, 0x0}, {8234, 7, 0x2A97, 0x0}, {3771, 4, 0x1D512, 0x0}, {7209, 11, 0x229B, 0x0},
+            {6896, 6, 0x204F, 0x0}, {13705, 7, 0x161, 0x0}, {7399, 6, 0x21B5, 0x0}, {1302, 5, 0x1D53C, 0x0},
+            {3775, 6, 0xD2, 0x0}, {0, 0, 0, 0}, {6267, 8, 0x29B0, 0x0}, {14672, 7, 0x2AD4, 0x0},
+            {8707, 7, 0x215A, 0x0}, {3747, 7, 0xD3, 0x0}, {1464, 3, 0x3E, 0x0}, {13255, 9, 0x211C, 0x0},
+            {3726, 5, 0x1D4A9, 0x0}, {10623, 6, 0x22BF, 0x0}, {15854, 7, 0x2240, 0x0}, {0, 0, 0, 0},
+            {5210, 7, 0x170, 0x0}, {2377, 14, 0x2952, 0x0}, {3754, 6, 0xD4, 0x0}, {8966, 6, 0x2A8E, 0x0},
+            {15701, 6, 0x225A, 0x0}, {0, 0, 0, 0}, {9047, 11, 0x2A8C, 0x0}, {9999, 14, 0x21A2, 0x0},
+            {3747, 6, 0xD3, 0x0}, {12883, 5, 0x2A0C, 0x0}, {0, 0, 0, 0}, {4417, 14, 0x22B3, 0x0},
+            {14553, 5, 0x2287, 0x0}, {14618, 7, 0x2283, 0x0}, {4926, 19, 0x227D, 0x0}, {12329, 6, 0x2295, 0x0},
+            {14815, 12, 0x2248, 0x0}, {6643, 6, 0x2564, 0x0}, {7047, 7, 0xE7, 0x0}, {1674, 5, 0x210D, 0x0},
+            {10584, 7, 0x2993, 0x0}, {15244, 6, 0x21BF, 0x0}, {12451, 4, 0xB6, 0x0}, {8765, 7, 0x3DD, 0x0},
+            {1358, 5, 0xCB, 0x0}, {6532, 6, 0x2423, 0x0}, {0, 0, 0, 0}, {16010, 5, 0x44F, 0x0},
+            {15426, 6, 0x25F9, 0x0}, {0, 0, 0, 0}, {14529, 4, 0x2283, 0x0}, {11078, 5, 0x226A, 0x338},
+            {7355, 5, 0x2245, 0x0}, {4622, 7, 0x429, 0x0}, {8894, 4, 0x2A92, 0x0}, {896, 17, 0x21D2, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {38, 6, 0xC0, 0x0}, {5306, 5, 0x1D54C, 0x0},
+            {4912, 14, 0x2AB0, 0x0}, {12973, 5, 0x223D, 0x331}, {9138, 5, 0x210F, 0x0}, {12674, 6, 0xA3, 0x0},
+            {10901, 4, 0x1D52A, 0x0}, {15172, 6, 0xFA, 0x0}, {4128, 7, 0x2916, 0x0}, {9345, 6, 0x222D, 0x0},
+            {13629, 7, 0x22CC, 0x0}, {0, 0, 0, 0}, {1307, 8, 0x395, 0x0}, {6649, 6, 0x2567, 0x0},
+            {0, 0, 0, 0}, {72, 14, 0x2061, 0x0}, {12003, 4, 0x23, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {9275, 7, 0x2043, 0x0}, {433, 7, 0x222F, 0x0}, {1787, 11, 0x2148, 0x0},
+            {5033, 4, 0x3A4, 0x0}, {8241, 6, 0x113, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {8876, 4, 0x22D9, 0x0}, {5697, 5, 0x1D4B4, 0x0}, {410, 6, 0x2237, 0x0}, {9575, 7, 0x129, 0x0},
+            {8438, 5, 0x212F, 0x0}, {8158, 6, 0xEA, 0x0}, {5441, 5, 0x3D2, 0x0}, {8409, 8, 0x2A78, 0x0},
+            {7133, 4, 0x3C7, 0x0}, {9588, 5, 0xEF, 0x0}, {4606, 4, 0x21B1, 0x0}, {9193, 9, 0x2926, 0x0},
+            {15848, 3, 0x2118, 0x0}, {0, 0, 0, 0}, {7668, 5, 0x2965, 0x0}, {3665, 14, 0x2244, 0x0},
+            {1081, 18, 0x2956, 0x0}, {9522, 6, 0xBF, 0x0}, {13816, 4, 0xA7, 0x0}, {0, 0, 0, 0},
+            {4314, 19, 0x295D, 0x0}, {13680, 7, 0x15B, 0x0}, {4709, 16, 0x2192, 0x0}, {3731, 6, 0xD1, 0x0},
+            {13636, 7, 0x22CA, 0x0}, {13789, 6, 0x21D8, 0x0}, {1321, 11, 0x2242, 0x0}, {9630, 6, 0x454, 0x0},
+            {5221, 6, 0xD9, 0x0}, {0, 0, 0, 0}, {8840, 8, 0x2A82, 0x0}, {0, 0, 0, 0},
+            {12692, 6, 0x227C, 0x0}, {8339, 6, 0x3F5, 0x0}, {2813, 22, 0x200B, 0x0}, {9743, 7, 0x2112, 0x0},
+            {14965, 13, 0x25BF, 0x0}, {4533, 12, 0x21C0, 0x0}, {6306, 4, 0x1D51F, 0x0}, {1979, 5, 0x409, 0x0},
+            {13368, 15, 0x21C0, 0x0}, {12456, 9, 0x2225, 0x0}, {14400, 11, 0x2ACB, 0x0}, {779, 16, 0x21D0, 0x0},
+            {6614, 6, 0x2556, 0x0}, {3186, 21, 0x22EC, 0x0}, {5075, 11, 0x205F, 0x200A}, {2391, 10, 0x21D0, 0x0},
+            {2006, 11, 0x2112, 0x0}, {9553, 6, 0x22F4, 0x0}, {5661, 5, 0x407, 0x0}, {14772, 4, 0x1D531, 0x0},
+            {14240, 7, 0x2323, 0x0}, {4792, 13, 0x228F, 0x0}, {10754, 6, 0x25C2, 0x0}, {2148, 15, 0x21C3, 0x0},
+            {0, 0, 0, 0}, {11445, 16, 0x21AE, 0x0}, {14686, 6, 0x21D9, 0x0}, {6139, 6, 0x2A11, 0x0},
+            {0, 0, 0, 0}, {3310, 18, 0x2AA1, 0x338}, {15954, 6, 0x27F9, 0x0}, {9895, 6, 0x298B, 0x0},
+            {9779, 6, 0xAB, 0x0}, {2723, 3, 0x39C, 0x0}, {14868, 6, 0xD7, 0x0}, {10787, 5, 0x2268, 0xFE00},
+            {8269, 7, 0x2004, 0x0}, {1694, 5, 0x210B, 0x0}, {10346, 6, 0x25FA, 0x0}, {7040, 7, 0x10D, 0x0},
+            {9681, 5, 0x1D55C, 0x0}, {10997, 3, 0x2213, 0x0}, {9722, 5, 0x2962, 0x0}, {13560, 8, 0x2A35, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4756, 5, 0x1D54A, 0x0},
+            {8978, 3, 0x3E, 0x0}, {6756, 6, 0x2565, 0x0}, {8533, 7, 0xFB03, 0x0}, {10448, 19, 0x27F7, 0x0},
+            {13677, 3, 0x211E, 0x0}, {0, 0, 0, 0}, {9358, 6, 0x2129, 0x0}, {12287, 6, 0x3C9, 0x0},
+            {5267, 17, 0x23DD, 0x0}, {14598, 6, 0x2ACC, 0x0}, {11325, 4, 0x2271, 0x0}, {8873, 3, 0x226B, 0x0},
+            {1391, 18, 0x25FC, 0x0}, {0, 0, 0, 0}, {2972, 9, 0x2260, 0x0}, {6891, 5, 0x1D4B7, 0x0},
+            {0, 0, 0, 0}, {6298, 8, 0x226C, 0x0}, {198, 4, 0xA9, 0x0}, {1001, 17, 0x21F5, 0x0},
+            {243, 7, 0x10C, 0x0}, {2130, 18, 0x2961, 0x0}, {5243, 11, 0x23DF, 0x0}, {8789, 4, 0x433, 0x0},
+            {8522, 4, 0x444, 0x0}, {8107, 5, 0x45F, 0x0}, {9851, 7, 0x2919, 0x0}, {6150, 9, 0x224C, 0x0},
+            {11576, 6, 0x220C, 0x0}, {9593, 6, 0x135, 0x0}, {1901, 6, 0x134, 0x0}, {15480, 5, 0x21D5, 0x0},
+            {10174, 7, 0x2A7F, 0x0}, {503, 6, 0x2A2F, 0x0}, {10266, 7, 0x297C, 0x0}, {13275, 4, 0xAE, 0x0},
+            {9924, 7, 0x13C, 0x0}, {1752, 6, 0xCE, 0x0}, {4107, 3, 0xAE, 0x0}, {12600, 6, 0x229E, 0x0},
+            {15996, 7, 0x22C0, 0x0}, {14199, 4, 0x25A1, 0x0}, {0, 0, 0, 0}, {11799, 8, 0x22E2, 0x0},
+            {1706, 13, 0x224E, 0x0}, {12367, 5, 0xBA, 0x0}, {6, 3, 0x26, 0x0}, {12649, 8, 0x2A27, 0x0},
+            {13816, 5, 0xA7, 0x0}, {11083, 12, 0x21CF, 0x0}, {10555, 7, 0x5F, 0x0}, {4333, 16, 0x21C2, 0x0},
+            {7711, 6, 0x2DD, 0x0}, {11691, 7, 0x219D, 0x338}, {14505, 4, 0x2211, 0x0}, {13247, 8, 0x211B, 0x0},
+            {14418, 7, 0x2AD5, 0x0}, {0, 0, 0, 0}, {10769, 8, 0x2966, 0x0}, {7763, 8, 0x29B1, 0x0},
+            {0, 0, 0, 0}, {12420, 7, 0x2297, 0x0}, {8449, 5, 0x2242, 0x0}, {12164, 6, 0xF4, 0x0},
+            {13518, 6, 0x2AEE, 0x0}, {181, 5, 0x212C, 0x0}, {7017, 5, 0x2229, 0xFE00}, {0, 0, 0, 0},
+            {6415, 7, 0x22C1, 0x0}, {2459, 9, 0x2AA1, 0x0}, {14281, 12, 0x3D5, 0x0}, {10701, 6, 0x22D6, 0x0},
+            {14303, 5, 0x2AC5, 0x0}, {8891, 3, 0x2277, 0x0}, {13450, 16, 0x22CC, 0x0}, {9618, 5, 0x1D4BF, 0x0},
+            {10, 6, 0xC1, 0x0}, {15203, 4, 0x443, 0x0}, {16025, 4, 0xA5, 0x0}, {10434, 14, 0x27F5, 0x0},
+            {14705, 8, 0x2199, 0x0}, {7613, 16, 0x21B7, 0x0}, {0, 0, 0, 0}, {1237, 7, 0xC8, 0x0},
+            {1218, 5, 0xCA, 0x0}, {7527, 5, 0x222A, 0xFE00}, {8345, 7, 0x2256, 0x0}, {3760, 4, 0x41E, 0x0},
+            {12968, 5, 0x2964, 0x0}, {14155, 11, 0x2291, 0x0}, {150, 11, 0x212C, 0x0}, {2619, 15, 0x2199, 0x0},
+            {2650, 5, 0x2112, 0x0}, {10142, 4, 0x22DA, 0x0}, {11774, 6, 0x2244, 0x0}, {0, 0, 0, 0},
+            {10881, 6, 0x2014, 0x0}, {14737, 5, 0x23B4, 0x0}, {5319, 11, 0x2912, 0x0}, {15509, 11, 0x3F5, 0x0},
+            {9931, 6, 0x2308, 0x0}, {6431, 7, 0x290D, 0x0}, {11309, 8, 0x2204, 0x0}, {7375, 5, 0x1D554, 0x0},
+            {0, 0, 0, 0}, {6673, 6, 0x2559, 0x0}, {15888, 4, 0x1D535, 0x0}, {10089, 18, 0x21CB, 0x0},
+            {9750, 7, 0x3BB, 0x0}, {11391, 4, 0x22FC, 0x0}, {15301, 6, 0x173, 0x0}, {7571, 9, 0x22CE, 0x0},
+            {15413, 7, 0x230E, 0x0}, {7334, 11, 0x2201, 0x0}, {6987, 9, 0x2A49, 0x0}, {12781, 7, 0x2119, 0x0},
+            {203, 7, 0x106, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {13297, 6, 0x21C1, 0x0},
+            {15694, 7, 0x22BB, 0x0}, {10287, 4, 0x2A91, 0x0}, {471, 32, 0x2233, 0x0}, {3764, 7, 0x150, 0x0},
+            {9818, 7, 0x21AB, 0x0}, {11672, 6, 0x21CF, 0x0}, {13500, 7, 0x23B1, 0x0}, {13772, 5, 0x22C5, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {12242, 4, 0x3A9, 0x0}, {10926, 7, 0x2AF0, 0x0},
+            {8008, 17, 0x21C2, 0x0}, {3340, 17, 0x2AAF, 0x338}, {10395, 4, 0x2A87, 0x0}, {12220, 5, 0x2DB, 0x0},
+            {4190, 21, 0x296F, 0x0}, {7098, 10, 0xB7, 0x0}, {12508, 5, 0x22A5, 0x0}, {11487, 6, 0x226E, 0x0},
+            {0, 0, 0, 0}, {13153, 7, 0x5D, 0x0}, {198, 5, 0xA9, 0x0}, {15046, 7, 0x25EC, 0x0},
+            {12571, 8, 0x210E, 0x0}, {6252, 7, 0x2235, 0x0}, {0, 0, 0, 0}, {8034, 7, 0x231F, 0x0},
+            {13530, 6, 0x21FE, 0x0}, {4725, 13, 0x2191, 0x0}, {5086, 10, 0x2009, 0x0}, {2634, 16, 0x2198, 0x0},
+            {3979, 9, 0x227A, 0x0}, {14836, 7, 0x2009, 0x0}, {12362, 4, 0xAA, 0x0}, {8146, 7, 0x11B, 0x0},
+            {6574, 5, 0x2310, 0x0}, {12123, 6, 0x2196, 0x0}, {0, 0, 0, 0}, {13746, 7, 0x22E9, 0x0},
+            {6579, 5, 0x1D553, 0x0}, {5800, 5, 0xB4, 0x0}, {8700, 7, 0x2158, 0x0}, {9184, 9, 0x2925, 0x0},
+            {5200, 5, 0xDB, 0x0}, {9603, 4, 0x1D527, 0x0}, {15812, 7, 0x2A5F, 0x0}, {11289, 7, 0x2928, 0x0},
+            {7680, 7, 0x2138, 0x0}, {5850, 6, 0x101, 0x0}, {11246, 3, 0x2260, 0x0}, {5866, 4, 0x2227, 0x0},
+            {13753, 9, 0x2A13, 0x0}, {4589, 12, 0x21DB, 0x0}, {13735, 5, 0x2AB6, 0x0}, {7028, 6, 0x2C7, 0x0},
+            {14356, 8, 0x2979, 0x0}, {0, 0, 0, 0}, {13434, 16, 0x219D, 0x0}, {12318, 5, 0x29B7, 0x0},
+            {518, 7, 0x224D, 0x0}, {0, 0, 0, 0}, {12174, 6, 0x229D, 0x0}, {10352, 7, 0x140, 0x0},
+            {6048, 4, 0x2A70, 0x0}, {2022, 7, 0x13D, 0x0}, {5113, 15, 0x2245, 0x0}, {12465, 7, 0x2AF3, 0x0},
+            {4087, 4, 0x1D514, 0x0}, {7819, 6, 0x2666, 0x0}, {15765, 5, 0x1D4CB, 0x0}, {16053, 5, 0xFF, 0x0},
+            {0, 0, 0, 0}, {14233, 7, 0x2216, 0x0}, {13524, 6, 0x27ED, 0x0}, {8693, 7, 0x215C, 0x0},
+            {14299, 4, 0x2282, 0x0}, {0, 0, 0, 0}, {11634, 8, 0x2A14, 0x0}, {0, 0, 0, 0},
+            {10728, 8, 0x2A7B, 0x0}, {1657, 4, 0x210C, 0x0}, {14432, 5, 0x227B, 0x0}, {0, 0, 0, 0},
+            {5972, 9, 0x29AE, 0x0}, {1534, 17, 0x22DB, 0x0}, {13740, 6, 0x2ABA, 0x0}, {7074, 5, 0x10B, 0x0},
+            {12939, 5, 0x22, 0x0}, {10579, 5, 0x28, 0x0}, {11430, 4, 0x2270, 0x0}, {8981, 5, 0x2AA7, 0x0},
+            {1745, 6, 0xCD, 0x0}, {11434, 11, 0x219A, 0x0}, {7093, 5, 0xA2, 0x0}, {14092, 10, 0x2660, 0x0},
+            {13877, 5, 0x448, 0x0}, {11678, 6, 0x219B, 0x0}, {12838, 5, 0x221D, 0x0}, {1218, 6, 0xCA, 0x0},
+            {8880, 6, 0x2137, 0x0}, {13536, 6, 0x27E7, 0x0}, {8998, 7, 0x2995, 0x0}, {9469, 9, 0x22BA, 0x0},
+            {2995, 10, 0x2204, 0x0}, {9875, 6, 0x2772, 0x0}, {9582, 6, 0x456, 0x0}, {13134, 6, 0x290D, 0x0},
+            {15784, 7, 0x2ACC, 0xFE00}, {5477, 6, 0x22AB, 0x0}, {10667, 6, 0x2018, 0x0}, {3493, 18, 0x2290, 0x338},
+            {8540, 6, 0xFB00, 0x0}, {3872, 5, 0xD6, 0x0}, {12104, 6, 0x223C, 0x20D2}, {10695, 6, 0x2A79, 0x0},
+            {14950, 6, 0x2122, 0x0}, {7003, 7, 0x2A47, 0x0}, {5051, 4, 0x422, 0x0}, {7010, 7, 0x2A40, 0x0},
+            {0, 0, 0, 0}, {24, 5, 0xC2, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {16072, 4, 0x437, 0x0}, {11521, 5, 0x1D55F, 0x0}, {10155, 9, 0x2A7D, 0x0}, {12888, 5, 0x1D562, 0x0},
+            {12843, 7, 0x221D, 0x0}, {3511, 23, 0x22E3, 0x0}, {14371, 9, 0x2286, 0x0}, {0, 0, 0, 0},
+            {3858, 6, 0xD5, 0x0}, {2100, 12, 0x2308, 0x0}, {2518, 14, 0x27F5, 0x0}, {7258, 7, 0x2AEF, 0x0},
+            {456, 5, 0x2102, 0x0}, {0, 0, 0, 0}, {11606, 5, 0x2226, 0x0}, {13024, 5, 0xBB, 0x0},
+            {1244, 8, 0x2208, 0x0}, {5776, 7, 0x103, 0x0}, {8630, 7, 0x2153, 0x0}, {0, 0, 0, 0},
+            {12071, 5, 0x2264, 0x20D2}, {3544, 15, 0x2288, 0x0}, {2191, 15, 0x2194, 0x0}, {8477, 6, 0x2203, 0x0},
+            {5498, 7, 0x2AE6, 0x0}, {13864, 6, 0x266F, 0x0}, {12210, 6, 0x29BF, 0x0}, {7925, 9, 0x2238, 0x0},
+            {0, 0, 0, 0}, {9986, 3, 0x2264, 0x0}, {3885, 10, 0x23DE, 0x0}, {8458, 4, 0xF0, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {8591, 5, 0x1D557, 0x0}, {11744, 10, 0x2224, 0x0},
+            {15832, 7, 0x2118, 0x0}, {5769, 6, 0xE1, 0x0}, {1969, 5, 0x1D542, 0x0}, {0, 0, 0, 0},
+            {2614, 5, 0x1D543, 0x0}, {116, 10, 0x2216, 0x0}, {166, 4, 0x1D505, 0x0}, {8580, 6, 0x25B1, 0x0},
+            {7880, 7, 0x231E, 0x0}, {1153, 8, 0x22A4, 0x0}, {9249, 7, 0x2015, 0x0}, {8956, 5, 0x210A, 0x0},
+            {5830, 8, 0x2135, 0x0}, {5794, 5, 0xE2, 0x0}, {9105, 7, 0x210B, 0x0}, {9013, 10, 0x2A86, 0x0},
+            {0, 0, 0, 0}, {4959, 9, 0x220B, 0x0}, {14897, 5, 0x222D, 0x0}, {8063, 7, 0x111, 0x0},
+            {6835, 6, 0x256A, 0x0}, {61, 6, 0x104, 0x0}, {11034, 4, 0x226B, 0x20D2}, {8557, 6, 0xFB01, 0x0},
+            {8164, 7, 0x2255, 0x0}, {9427, 6, 0x221E, 0x0}, {8262, 7, 0x2205, 0x0}, {6199, 7, 0x22BD, 0x0},
+            {14545, 8, 0x2AD8, 0x0}, {0, 0, 0, 0}, {7200, 9, 0x24C8, 0x0}, {10189, 9, 0x2A83, 0x0},
+            {302, 10, 0x2299, 0x0}, {0, 0, 0, 0}, {7868, 7, 0x22C7, 0x0}, {4738, 6, 0x3A3, 0x0},
+            {9215, 14, 0x21A9, 0x0}, {15361, 6, 0x228E, 0x0}, {4875, 5, 0x22C6, 0x0}, {8992, 6, 0x22D7, 0x0},
+            {1832, 15, 0x2063, 0x0}, {11582, 8, 0x220C, 0x0}, {14733, 4, 0x3C4, 0x0}, {12034, 5, 0x224D, 0x20D2},
+            {13802, 6, 0x2198, 0x0}, {4823, 15, 0x2290, 0x0}, {7301, 8, 0x2254, 0x0}, {13995, 6, 0x2190, 0x0},
+            {12379, 5, 0x2A56, 0x0}, {3944, 3, 0x3A0, 0x0}, {1819, 13, 0x22C2, 0x0}, {394, 16, 0x2019, 0x0},
+            {10284, 3, 0x2276, 0x0}, {684, 8, 0x22C4, 0x0}, {3741, 6, 0x152, 0x0}, {14390, 10, 0x228A, 0x0},
+            {15262, 7, 0x231C, 0x0}, {0, 0, 0, 0}, {3255, 18, 0x2A7D, 0x338}, {1752, 5, 0xCE, 0x0},
+            {0, 0, 0, 0}, {5446, 8, 0x3A5, 0x0}, {0, 0, 0, 0}, {5730, 5, 0x17B, 0x0},
+            {9642, 7, 0x3F0, 0x0}, {175, 6, 0x2D8, 0x0}, {11536, 7, 0x22F9, 0x338}, {8721, 7, 0x215E, 0x0},
+            {15770, 7, 0x2ACB, 0xFE00}, {0, 0, 0, 0}, {12293, 8, 0x3BF, 0x0}, {3976, 3, 0x2ABB, 0x0},
+            {14222, 6, 0x2192, 0x0}, {11030, 4, 0x22D9, 0x338}, {142, 8, 0x2235, 0x0}, {9811, 7, 0x21A9, 0x0},
+            {8672, 7, 0x2156, 0x0}, {10612, 7, 0x296D, 0x0}, {12472, 6, 0x2AFD, 0x0}, {8158, 5, 0xEA, 0x0},
+            {7047, 6, 0xE7, 0x0}, {1228, 5, 0x116, 0x0}, {12806, 5, 0x220F, 0x0}, {16038, 5, 0x1D56A, 0x0},
+            {14699, 6, 0x2199, 0x0}, {3711, 15, 0x2224, 0x0}, {10736, 7, 0x2996, 0x0}, {0, 0, 0, 0},
+            {9173, 7, 0x22B9, 0x0}, {0, 0, 0, 0}, {6865, 6, 0x251C, 0x0}, {9244, 5, 0x1D559, 0x0},
+            {13507, 11, 0x23B1, 0x0}, {0, 0, 0, 0}, {13207, 4, 0x440, 0x0}, {3807, 21, 0x201C, 0x0},
+            {6562, 4, 0x3D, 0x20E5}, {13568, 5, 0x29, 0x0}, {0, 0, 0, 0}, {13718, 4, 0x2AB0, 0x0},
+            {9433, 9, 0x29DD, 0x0}, {9370, 6, 0x12B, 0x0}, {4945, 14, 0x227F, 0x0}, {6878, 6, 0x2D8, 0x0},
+            {5678, 6, 0x176, 0x0}, {1349, 5, 0x2A73, 0x0}, {8070, 6, 0x22F1, 0x0}, {12144, 3, 0x24C8, 0x0},
+            {6406, 9, 0x2A04, 0x0}, {3032, 20, 0x2267, 0x338}, {12925, 6, 0x3F, 0x0}, {10656, 6, 0x2A8F, 0x0},
+            {9088, 5, 0x21D4, 0x0}, {581, 4, 0x2207, 0x0}, {0, 0, 0, 0}, {11875, 5, 0x2285, 0x0},
+            {12702, 5, 0x227A, 0x0}, {15404, 9, 0x231D, 0x0}, {15960, 6, 0x27F6, 0x0}, {10359, 7, 0x23B0, 0x0},
+            {6477, 18, 0x25BE, 0x0}, {850, 25, 0x27FA, 0x0}, {9734, 9, 0x29B4, 0x0}, {9888, 7, 0x5B, 0x0},
+            {6751, 5, 0x2500, 0x0}, {12129, 8, 0x2196, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {9083, 5, 0x2269, 0xFE00}, {10250, 8, 0x2276, 0x0}, {8025, 9, 0x2910, 0x0}, {13005, 6, 0x2992, 0x0},
+            {8308, 5, 0x22D5, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {294, 4, 0x212D, 0x0},
+            {13853, 4, 0x1D530, 0x0}, {5936, 9, 0x29AA, 0x0}, {13548, 5, 0x1D563, 0x0}, {15256, 6, 0x2580, 0x0},
+            {16124, 5, 0x200C, 0x0}, {6714, 6, 0x255F, 0x0}, {0, 0, 0, 0}, {5533, 13, 0x7C, 0x0},
+            {15144, 18, 0x21A0, 0x0}, {5200, 6, 0xDB, 0x0}, {1583, 12, 0x2277, 0x0}, {4884, 7, 0x22D0, 0x0},
+            {6962, 7, 0x224F, 0x0}, {0, 0, 0, 0}, {559, 5, 0x21A1, 0x0}, {9727, 7, 0x13A, 0x0},
+            {10760, 9, 0x294A, 0x0}, {7500, 7, 0x2A46, 0x0}, {15502, 7, 0x299C, 0x0}, {5018, 6, 0x40B, 0x0},
+            {8623, 6, 0xBD, 0x0}, {12147, 6, 0xF3, 0x0}, {12236, 6, 0x29B5, 0x0}, {1987, 7, 0x139, 0x0},
+            {2181, 10, 0x230A, 0x0}, {0, 0, 0, 0}, {16088, 5, 0x3B6, 0x0}, {15913, 6, 0x27F5, 0x0},
+            {5330, 17, 0x21C5, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {2703, 10, 0x2213, 0x0},
+            {15016, 14, 0x25B9, 0x0}, {8978, 2, 0x3E, 0x0}, {0, 0, 0, 0}, {3697, 14, 0x2249, 0x0},
+            {10416, 6, 0x27EC, 0x0}, {12730, 7, 0x2AAF, 0x0}, {3754, 5, 0xD4, 0x0}, {8945, 5, 0x1D558, 0x0},
+            {13905, 3, 0xAD, 0x0}, {15759, 6, 0x22B3, 0x0}, {10645, 5, 0x2272, 0x0}, {14604, 6, 0x228B, 0x0},
+            {12076, 5, 0x3C, 0x20D2}, {1767, 4, 0x2111, 0x0}, {13611, 5, 0x5D, 0x0}, {13648, 6, 0x22B5, 0x0},
+            {7507, 7, 0x2A4A, 0x0}, {8139, 7, 0x2A6E, 0x0}, {16053, 4, 0xFF, 0x0}, {12413, 7, 0xF5, 0x0},
+            {6340, 9, 0x2A01, 0x0}, {3907, 16, 0x23DC, 0x0}, {4968, 4, 0x2211, 0x0}, {12020, 7, 0x22AD, 0x0},
+            {14437, 11, 0x2AB8, 0x0}, {298, 4, 0x3A7, 0x0}, {8193, 3, 0x2A9A, 0x0}, {13237, 5, 0x21B3, 0x0},
+            {7559, 12, 0x22DF, 0x0}, {4091, 5, 0x211A, 0x0}, {5024, 5, 0x426, 0x0}, {0, 0, 0, 0},
+            {7322, 5, 0x2201, 0x0}, {8814, 9, 0x2A7E, 0x0}, {15624, 14, 0x2ACC, 0xFE00}, {3865, 7, 0x2A37, 0x0},
+            {2057, 10, 0x2190, 0x0}, {7487, 4, 0x222A, 0x0}, {12811, 9, 0x232E, 0x0}, {8906, 4, 0x2269, 0x0},
+            {12147, 7, 0xF3, 0x0}, {9478, 9, 0x2A17, 0x0}, {13270, 5, 0x25AD, 0x0}, {9208, 7, 0x223B, 0x0},
+            {7151, 7, 0x2257, 0x0}, {10058, 15, 0x2194, 0x0}, {0, 0, 0, 0}, {10493, 14, 0x21AB, 0x0},
+            {5643, 3, 0x39E, 0x0}, {2366, 11, 0x21BC, 0x0}, {1948, 6, 0x39A, 0x0}, {0, 0, 0, 0},
+            {11509, 7, 0x22EC, 0x0}, {12707, 11, 0x2AB7, 0x0}, {14902, 5, 0x2928, 0x0}, {13768, 4, 0x441, 0x0},
+            {12591, 9, 0x2A23, 0x0}, {12634, 7, 0xB1, 0x0}, {9338, 7, 0x2A0C, 0x0}, {14460, 7, 0x2AB0, 0x0},
+            {6884, 6, 0xA6, 0x0}, {10507, 15, 0x21AC, 0x0}, {3877, 8, 0x203E, 0x0}, {4610, 12, 0x29F4, 0x0},
+            {14102, 5, 0x2225, 0x0}, {6595, 7, 0x22C8, 0x0}, {7807, 12, 0x2666, 0x0}, {4467, 18, 0x294F, 0x0},
+            {0, 0, 0, 0}, {9691, 6, 0x21DA, 0x0}, {2468, 15, 0x2A7D, 0x0}, {0, 0, 0, 0},
+            {3843, 3, 0x2A54, 0x0}, {6181, 8, 0x223D, 0x0}, {15114, 7, 0x167, 0x0}, {13729, 6, 0x15D, 0x0},
+            {11122, 5, 0x2220, 0x20D2}, {7279, 9, 0x2663, 0x0}, {4502, 14, 0x21BE, 0x0}, {14320, 8, 0x2AC3, 0x0},
+            {8915, 9, 0x2A8A, 0x0}, {6806, 6, 0x255B, 0x0}, {8748, 4, 0x2A8C, 0x0}, {8833, 7, 0x2A80, 0x0},
+            {13202, 5, 0x7D, 0x0}, {3070, 15, 0x2279, 0x0}, {9299, 6, 0xEE, 0x0}, {12081, 8, 0x22B4, 0x20D2},
+            {11664, 8, 0x2AAF, 0x338}, {12521, 4, 0x1D52D, 0x0}, {11236, 4, 0x43D, 0x0}, {0, 0, 0, 0},
+            {6608, 6, 0x2554, 0x0}, {6996, 7, 0x2A4B, 0x0}, {6637, 6, 0x2569, 0x0}, {15638, 9, 0x3D1, 0x0},
+            {9453, 7, 0x22BA, 0x0}, {4219, 18, 0x27E9, 0x0}, {7460, 6, 0x22DE, 0x0}, {6034, 6, 0x105, 0x0},
+            {8759, 6, 0x3B3, 0x0}, {9449, 4, 0x222B, 0x0}, {0, 0, 0, 0}, {4142, 7, 0x156, 0x0},
+            {4601, 5, 0x211B, 0x0}, {9881, 7, 0x7B, 0x0}, {12216, 4, 0x1D52C, 0x0}, {3397, 17, 0x22EB, 0x0},
+            {3610, 17, 0x227F, 0x338}, {14756, 4, 0x442, 0x0}, {14519, 4, 0xB2, 0x0}, {1699, 7, 0x126, 0x0},
+            {14217, 5, 0x25AA, 0x0}, {0, 0, 0, 0}, {8132, 7, 0xE9, 0x0}, {8196, 7, 0xE8, 0x0},
+            {16025, 3, 0xA5, 0x0}, {11074, 4, 0x226A, 0x20D2}, {7093, 4, 0xA2, 0x0}, {11787, 6, 0x2224, 0x0},
+            {12313, 5, 0x1D560, 0x0}, {10428, 6, 0x27E6, 0x0}, {1224, 4, 0x42D, 0x0}, {1332, 12, 0x21CC, 0x0},
+            {5193, 7, 0x16C, 0x0}, {1509, 4, 0x1D50A, 0x0}, {271, 5, 0x10A, 0x0}, {0, 0, 0, 0},
+            {13383, 16, 0x21C4, 0x0}, {10164, 4, 0x2A7D, 0x0}, {12246, 5, 0x222E, 0x0}, {14001, 14, 0x2216, 0x0},
+            {7521, 6, 0x2A45, 0x0}, {6052, 7, 0x2A6F, 0x0}, {6976, 4, 0x2229, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {7112, 5, 0x447, 0x0}, {15843, 5, 0x1D568, 0x0},
+            {10650, 6, 0x2A8D, 0x0}, {4282, 13, 0x2309, 0x0}, {9516, 6, 0x2A3C, 0x0}, {6789, 8, 0x229E, 0x0},
+            {1521, 13, 0x2265, 0x0}, {3005, 11, 0x226F, 0x0}, {11807, 8, 0x22E3, 0x0}, {10641, 4, 0x21B0, 0x0},
+            {5810, 5, 0xE6, 0x0}, {1494, 6, 0x11C, 0x0}, {6620, 6, 0x2553, 0x0}, {0, 0, 0, 0},
+            {3782, 6, 0x14C, 0x0}, {11543, 9, 0x22F5, 0x338}, {1443, 11, 0x2131, 0x0}, {0, 0, 0, 0},
+            {8203, 4, 0x2A96, 0x0}, {9500, 6, 0x12F, 0x0}, {0, 0, 0, 0}, {11222, 9, 0x2A6D, 0x338},
+            {15971, 7, 0x2A06, 0x0}, {2981, 14, 0x2242, 0x338}, {111, 4, 0xC4, 0x0}, {6236, 6, 0x224C, 0x0},
+            {9442, 7, 0x131, 0x0}, {6847, 6, 0x255E, 0x0}, {4766, 7, 0x25A1, 0x0}, {2080, 20, 0x21C6, 0x0},
+            {8396, 7, 0x225F, 0x0}, {1938, 5, 0x425, 0x0}, {14051, 6, 0x2AAC, 0xFE00}, {6933, 5, 0x2022, 0x0},
+            {13643, 5, 0x25B9, 0x0}, {0, 0, 0, 0}, {12550, 10, 0x22D4, 0x0}, {9937, 5, 0x7B, 0x0},
+            {525, 3, 0x2145, 0x0}, {5862, 3, 0x26, 0x0}, {14856, 6, 0xFE, 0x0}, {8320, 6, 0x2A71, 0x0},
+            {1771, 7, 0xCC, 0x0}, {6812, 6, 0x2558, 0x0}, {15985, 6, 0x25B3, 0x0}, {0, 0, 0, 0},
+            {16043, 5, 0x1D4CE, 0x0}, {8745, 3, 0x2267, 0x0}, {13024, 6, 0xBB, 0x0}, {3286, 24, 0x2AA2, 0x338},
+            {11867, 8, 0x2AB0, 0x338}, {6950, 6, 0x2AAE, 0x0}, {12534, 7, 0x2133, 0x0}, {14533, 5, 0x2AC6, 0x0},
+            {7327, 7, 0x2218, 0x0}, {8432, 6, 0x2971, 0x0}, {13848, 5, 0x2736, 0x0}, {12856, 7, 0x22B0, 0x0},
+            {11526, 3, 0xAC, 0x0}, {10887, 14, 0x2221, 0x0}, {14625, 9, 0x2287, 0x0}, {12451, 5, 0xB6, 0x0},
+            {6841, 6, 0x2561, 0x0}, {10330, 9, 0x231E, 0x0}, {193, 5, 0x427, 0x0}, {51, 6, 0x100, 0x0},
+            {4082, 4, 0x22, 0x0}, {15898, 6, 0x27F7, 0x0}, {12354, 8, 0x2134, 0x0}, {10798, 4, 0xAF, 0x0},
+            {6655, 6, 0x255D, 0x0}, {5755, 4, 0x2128, 0x0}, {12893, 7, 0x2057, 0x0}, {6013, 7, 0x2222, 0x0},
+            {0, 0, 0, 0}, {45, 6, 0x391, 0x0}, {6538, 6, 0x2592, 0x0}, {15237, 7, 0xF9, 0x0},
+            {9420, 7, 0x2105, 0x0}, {12669, 5, 0x1D561, 0x0}, {16081, 7, 0x2128, 0x0}, {0, 0, 0, 0},
+            {1436, 7, 0x2200, 0x0}, {0, 0, 0, 0}, {15584, 13, 0x228A, 0xFE00}, {14558, 8, 0x2AC4, 0x0},
+            {13105, 6, 0x219D, 0x0}, {14265, 16, 0x3F5, 0x0}, {14765, 7, 0x2315, 0x0}, {8801, 4, 0x22DB, 0x0},
+            {8961, 5, 0x2273, 0x0}, {12621, 7, 0x2A25, 0x0}, {335, 12, 0x2297, 0x0}, {6667, 6, 0x255C, 0x0},
+            {6080, 9, 0x224A, 0x0}, {10714, 7, 0x22C9, 0x0}, {0, 0, 0, 0}, {5596, 5, 0x1D54D, 0x0},
+            {8596, 7, 0x2200, 0x0}, {13696, 4, 0x2AB4, 0x0}, {0, 0, 0, 0}, {4041, 8, 0x220F, 0x0},
+            {5173, 5, 0x219F, 0x0}, {1647, 4, 0x5E, 0x0}, {14930, 8, 0x2ADA, 0x0}, {15520, 9, 0x3F0, 0x0},
+            {10150, 5, 0x2266, 0x0}, {10229, 10, 0x22DA, 0x0}, {12525, 4, 0x3C6, 0x0}, {10803, 5, 0x2642, 0x0},
+            {2756, 20, 0x200B, 0x0}, {14036, 6, 0x2323, 0x0}, {12367, 4, 0xBA, 0x0}, {13316, 4, 0x3C1, 0x0},
+            {10854, 9, 0x21A5, 0x0}, {1099, 19, 0x295F, 0x0}, {13933, 7, 0x2A6A, 0x0}, {2500, 11, 0x21DA, 0x0},
+            {1516, 5, 0x1D53E, 0x0}, {5735, 15, 0x200B, 0x0}, {13595, 7, 0x203A, 0x0}, {5347, 12, 0x2195, 0x0},
+            {0, 0, 0, 0}, {6871, 7, 0x2035, 0x0}, {15207, 6, 0x21C5, 0x0}, {8426, 6, 0x2253, 0x0},
+            {0, 0, 0, 0}, {10721, 7, 0x2976, 0x0}, {15058, 9, 0x2A3A, 0x0}, {8508, 14, 0x2252, 0x0},
+            {13795, 7, 0x2925, 0x0}, {7288, 6, 0x3A, 0x0}, {0, 0, 0, 0}, {2930, 10, 0x226D, 0x0},
+            {14907, 4, 0x22A4, 0x0}, {11900, 10, 0x2289, 0x0}, {9289, 6, 0xED, 0x0}, {7829, 8, 0x3DD, 0x0},
+            {14938, 5, 0x2929, 0x0}, {0, 0, 0, 0}, {15540, 7, 0x3D5, 0x0}, {0, 0, 0, 0},
+            {6956, 6, 0x224F, 0x0}, {1954, 7, 0x136, 0x0}, {7739, 6, 0x21CA, 0x0}, {1641, 6, 0x2C7, 0x0},
+            {0, 0, 0, 0}, {12749, 9, 0x2AB5, 0x0}, {6745, 6, 0x250C, 0x0}, {10673, 7, 0x201A, 0x0},
+            {3846, 5, 0x1D4AA, 0x0}, {7123, 10, 0x2713, 0x0}, {1363, 7, 0x2203, 0x0}, {13048, 8, 0x2920, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {3679, 18, 0x2247, 0x0}, {6004, 9, 0x299D, 0x0},
+            {10478, 15, 0x27F6, 0x0}, {15721, 5, 0x7C, 0x0}, {3988, 14, 0x2AAF, 0x0}, {10933, 6, 0xB7, 0x0},
+            {3895, 12, 0x23B4, 0x0}, {0, 0, 0, 0}, {7916, 9, 0x2251, 0x0}, {16003, 6, 0xFD, 0x0},
+            {5606, 7, 0x22AA, 0x0}, {1467, 6, 0x393, 0x0}, {12427, 9, 0x2A36, 0x0}, {3207, 8, 0x226E, 0x0},
+            {7641, 9, 0x2232, 0x0}, {0, 0, 0, 0}, {8458, 3, 0xF0, 0x0}, {8283, 5, 0x2003, 0x0},
+            {15690, 4, 0x2228, 0x0}, {13542, 6, 0x2986, 0x0}, {6392, 14, 0x25B3, 0x0}, {13842, 6, 0x2216, 0x0},
+            {0, 0, 0, 0}, {13279, 7, 0x297D, 0x0}, {6020, 6, 0xC5, 0x0}, {0, 0, 0, 0},
+            {8714, 7, 0x215D, 0x0}, {6259, 8, 0x2235, 0x0}, {8076, 5, 0x25BF, 0x0}, {8886, 5, 0x453, 0x0},
+            {8827, 6, 0x2AA9, 0x0}, {5996, 8, 0x22BE, 0x0}, {4123, 5, 0x21A0, 0x0}, {9539, 6, 0x22F9, 0x0},
+            {9256, 5, 0x1D4BD, 0x0}, {6733, 6, 0x2552, 0x0}, {15432, 5, 0x1D4CA, 0x0}, {11482, 5, 0x2A7D, 0x338},
+            {5166, 7, 0xDA, 0x0}, {7146, 5, 0x2C6, 0x0}, {1974, 5, 0x1D4A6, 0x0}, {6924, 9, 0x27C8, 0x0},
+            {7837, 6, 0x22F2, 0x0}, {4402, 15, 0x295B, 0x0}, {14956, 9, 0x25B5, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {12863, 5, 0x1D4C5, 0x0}, {1961, 4, 0x41A, 0x0}, {5159, 7, 0x166, 0x0},
+            {0, 0, 0, 0}, {10832, 11, 0x21A7, 0x0}, {10221, 8, 0x22D6, 0x0}, {11815, 5, 0x2284, 0x0},
+            {14856, 5, 0xFE, 0x0}, {9775, 4, 0x2A85, 0x0}, {10909, 5, 0xB5, 0x0}, {2718, 5, 0x2133, 0x0},
+            {8183, 6, 0x2252, 0x0}, {12064, 7, 0x2902, 0x0}, {4999, 7, 0x22D1, 0x0}, {2776, 19, 0x200B, 0x0},
+            {8924, 4, 0x2A88, 0x0}, {15647, 16, 0x22B2, 0x0}, {4021, 14, 0x227E, 0x0}, {0, 0, 0, 0},
+            {6422, 9, 0x22C0, 0x0}, {16097, 5, 0x436, 0x0}, {9166, 7, 0x2026, 0x0}, {14776, 7, 0x2234, 0x0},
+            {12985, 6, 0x221A, 0x0}, {15485, 5, 0x2AE8, 0x0}, {8679, 6, 0xBE, 0x0}, {15081, 8, 0x2A3B, 0x0},
+            {5290, 10, 0x228E, 0x0}, {4744, 12, 0x2218, 0x0}, {6696, 6, 0x2560, 0x0}, {14497, 8, 0x227F, 0x0},
+            {5472, 5, 0xDC, 0x0}, {12392, 4, 0x2A5B, 0x0}, {6544, 6, 0x2591, 0x0}, {12868, 4, 0x3C8, 0x0},
+            {4379, 9, 0x22A2, 0x0}, {3971, 5, 0x2119, 0x0}, {14479, 9, 0x2AB6, 0x0}, {0, 0, 0, 0},
+            {1018, 10, 0x311, 0x0}, {3215, 13, 0x2270, 0x0}, {6068, 5, 0x27, 0x0}, {9779, 5, 0xAB, 0x0},
+            {6690, 6, 0x2563, 0x0}, {6206, 7, 0x2305, 0x0}, {5726, 4, 0x417, 0x0}, {92, 5, 0x1D49C, 0x0},
+            {13870, 7, 0x449, 0x0}, {8623, 7, 0xBD, 0x0}, {650, 17, 0x60, 0x0}, {0, 0, 0, 0},
+            {6824, 6, 0x2514, 0x0}, {11255, 7, 0x2924, 0x0}, {12767, 8, 0x227E, 0x0}, {7244, 5, 0x2257, 0x0},
+            {1984, 2, 0x3C, 0x0}, {11952, 16, 0x22EC, 0x0}, {10013, 16, 0x21BD, 0x0}, {4571, 5, 0x211D, 0x0},
+            {11530, 6, 0x2209, 0x0}, {6368, 8, 0x2605, 0x0}, {2752, 4, 0x41D, 0x0}, {9289, 7, 0xED, 0x0},
+            {11179, 4, 0xA0, 0x0}, {11419, 6, 0x219A, 0x0}, {12051, 5, 0x3E, 0x20D2}, {10808, 5, 0x2720, 0x0},
+            {2835, 21, 0x226B, 0x0}, {2891, 17, 0xA0, 0x0}, {7539, 8, 0x293C, 0x0}, {11005, 7, 0x223E, 0x0},
+            {12170, 4, 0x43E, 0x0}, {284, 10, 0xB7, 0x0}, {10303, 7, 0x296A, 0x0}, {1211, 7, 0x11A, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {12718, 12, 0x227C, 0x0}, {5684, 4, 0x42B, 0x0},
+            {0, 0, 0, 0}, {14843, 6, 0x2248, 0x0}, {0, 0, 0, 0}, {6332, 8, 0x2A00, 0x0},
+            {13951, 5, 0x2A9E, 0x0}, {15030, 16, 0x22B5, 0x0}, {6739, 6, 0x2510, 0x0}, {5769, 7, 0xE1, 0x0},
+            {5410, 15, 0x2196, 0x0}, {5954, 9, 0x29AC, 0x0}, {10029, 14, 0x21BC, 0x0}, {5254, 13, 0x23B5, 0x0},
+            {0, 0, 0, 0}, {5646, 5, 0x1D54F, 0x0}, {11282, 7, 0x2262, 0x0}, {8214, 3, 0x2A99, 0x0},
+            {12338, 6, 0x21BB, 0x0}, {11184, 6, 0x224E, 0x338}, {8153, 5, 0x2256, 0x0}, {12547, 3, 0x3C0, 0x0},
+            {1883, 7, 0x128, 0x0}, {8253, 9, 0x2205, 0x0}, {11142, 6, 0x149, 0x0}, {8121, 6, 0x2A77, 0x0},
+            {5488, 4, 0x412, 0x0}, {1504, 5, 0x120, 0x0}, {9964, 8, 0x2967, 0x0}, {7847, 6, 0xF7, 0x0},
+            {15233, 4, 0x1D532, 0x0}, {13973, 6, 0x2246, 0x0}, {0, 0, 0, 0}, {2112, 18, 0x27E6, 0x0},
+            {12657, 3, 0xB1, 0x0}, {2222, 8, 0x22A3, 0x0}, {0, 0, 0, 0}, {12204, 6, 0x153, 0x0},
+            {1134, 19, 0x2957, 0x0}, {9656, 4, 0x43A, 0x0}, {12793, 6, 0x2AB9, 0x0}, {12478, 5, 0x2202, 0x0},
+            {4679, 15, 0x2193, 0x0}, {12799, 7, 0x22E8, 0x0}, {8462, 4, 0xEB, 0x0}, {0, 0, 0, 0},
+            {5790, 4, 0x223F, 0x0}, {0, 0, 0, 0}, {9599, 4, 0x439, 0x0}, {1943, 5, 0x40C, 0x0},
+            {13042, 6, 0x21E5, 0x0}, {6213, 9, 0x2305, 0x0}, {10540, 8, 0x2A34, 0x0}, {0, 0, 0, 0},
+            {16058, 7, 0x17A, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12962, 6, 0x290F, 0x0},
+            {11231, 5, 0x2A42, 0x0}, {5102, 11, 0x2243, 0x0}, {14925, 5, 0x1D565, 0x0}, {7753, 4, 0xB0, 0x0},
+            {0, 0, 0, 0}, {6762, 6, 0x2568, 0x0}, {2669, 4, 0x2905, 0x0}, {2580, 19, 0x27FA, 0x0},
+            {7315, 7, 0x40, 0x0}, {12007, 7, 0x2116, 0x0}, {11769, 5, 0x2241, 0x0}, {9901, 8, 0x298F, 0x0},
+            {9649, 7, 0x137, 0x0}, {0, 0, 0, 0}, {15940, 7, 0x2A01, 0x0}, {13616, 6, 0x2019, 0x0},
+            {591, 4, 0x1D507, 0x0}, {9664, 7, 0x138, 0x0}, {13687, 6, 0x201A, 0x0}, {15877, 5, 0x22C3, 0x0},
+            {1965, 4, 0x1D50E, 0x0}, {12137, 7, 0x2927, 0x0}, {0, 0, 0, 0}, {12197, 7, 0x29BC, 0x0},
+            {12348, 6, 0x2134, 0x0}, {14188, 11, 0x2292, 0x0}, {1258, 17, 0x25FB, 0x0}, {5918, 9, 0x29A8, 0x0},
+            {12614, 7, 0x2214, 0x0}, {5217, 4, 0x1D518, 0x0}, {11698, 12, 0x219B, 0x0}, {14524, 5, 0xB3, 0x0},
+            {0, 0, 0, 0}, {8752, 7, 0x1F5, 0x0}, {9832, 8, 0x2973, 0x0}, {15726, 4, 0x1D533, 0x0},
+            {7854, 14, 0x22C7, 0x0}, {13293, 4, 0x1D52F, 0x0}, {12917, 8, 0x2A16, 0x0}, {0, 0, 0, 0},
+            {4870, 5, 0x1D4AE, 0x0}, {15067, 8, 0x2A39, 0x0}, {12950, 5, 0x21D2, 0x0}, {12634, 6, 0xB1, 0x0},
+            {5006, 6, 0xDE, 0x0}, {4972, 4, 0x22D1, 0x0}, {4675, 4, 0x1D516, 0x0}, {8175, 5, 0x117, 0x0},
+            {5823, 7, 0xE0, 0x0}, {7794, 5, 0x22C4, 0x0}, {15332, 14, 0x21BF, 0x0}, {11382, 6, 0x2AF2, 0x0},
+            {1847, 15, 0x2062, 0x0}, {15437, 6, 0x22F0, 0x0}, {5492, 6, 0x22A9, 0x0}, {0, 0, 0, 0},
+            {942, 18, 0x21D5, 0x0}, {9989, 10, 0x2190, 0x0}, {14874, 7, 0x22A0, 0x0}, {12541, 6, 0x260E, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {9124, 8, 0x2948, 0x0}, {11197, 5, 0x2A43, 0x0},
+            {12225, 6, 0xF2, 0x0}, {8637, 7, 0xBC, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {3775, 7, 0xD2, 0x0}, {8127, 5, 0x2251, 0x0}, {2666, 3, 0x226A, 0x0}, {14862, 6, 0x2DC, 0x0},
+            {14634, 10, 0x2AC6, 0x0}, {13466, 5, 0x2DA, 0x0}, {5139, 5, 0x1D54B, 0x0}, {5891, 5, 0x2A5A, 0x0},
+            {5390, 8, 0x21D1, 0x0}, {10690, 5, 0x2AA6, 0x0}, {14293, 6, 0xAF, 0x0}, {509, 5, 0x1D49E, 0x0},
+            {13111, 7, 0x291A, 0x0}, {14644, 10, 0x228B, 0x0}, {9529, 5, 0x1D4BE, 0x0}, {7757, 6, 0x3B4, 0x0},
+            {6281, 7, 0x212C, 0x0}, {7060, 6, 0x2A4C, 0x0}, {5601, 5, 0x1D4B1, 0x0}, {2257, 13, 0x22B2, 0x0},
+            {9804, 7, 0x291D, 0x0}, {461, 10, 0x2210, 0x0}, {7598, 15, 0x21B6, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {5856, 6, 0x2A3F, 0x0}, {1932, 6, 0x404, 0x0}, {13762, 6, 0x227F, 0x0},
+            {6797, 9, 0x22A0, 0x0}, {0, 0, 0, 0}, {8189, 4, 0x1D522, 0x0}, {4545, 15, 0x2953, 0x0},
+            {15611, 13, 0x228B, 0xFE00}, {0, 0, 0, 0}, {0, 0, 0, 0}, {7220, 12, 0x229A, 0x0},
+            {13484, 6, 0x21C4, 0x0}, {15179, 5, 0x2191, 0x0}, {4211, 4, 0x211C, 0x0}, {8313, 7, 0x29E3, 0x0},
+            {170, 5, 0x1D539, 0x0}, {9324, 4, 0x1D526, 0x0}, {9506, 5, 0x1D55A, 0x0}, {2879, 4, 0x1D511, 0x0},
+            {12306, 7, 0x2296, 0x0}, {14514, 4, 0xB9, 0x0}, {15839, 4, 0x1D534, 0x0}, {15127, 17, 0x219E, 0x0},
+            {9351, 7, 0x29DC, 0x0}, {1915, 5, 0x1D541, 0x0}, {10606, 6, 0x21CB, 0x0}, {12641, 8, 0x2A26, 0x0},
+            {1651, 6, 0x124, 0x0}, {9495, 5, 0x451, 0x0}, {86, 5, 0xC5, 0x0}, {2163, 18, 0x2959, 0x0},
+            {312, 12, 0x2296, 0x0}, {14080, 5, 0x1D564, 0x0}, {5509, 7, 0x2016, 0x0}, {97, 7, 0x2254, 0x0},
+            {1798, 8, 0x21D2, 0x0}, {14654, 11, 0x2ACC, 0x0}, {6969, 7, 0x107, 0x0}, {15714, 7, 0x7C, 0x0},
+            {9762, 6, 0x2991, 0x0}, {1464, 2, 0x3E, 0x0}, {13275, 3, 0xAE, 0x0}, {15167, 5, 0x2963, 0x0},
+            {8651, 7, 0x2159, 0x0}, {15736, 6, 0x2282, 0x20D2}, {0, 0, 0, 0}, {10291, 6, 0x21BD, 0x0},
+            {0, 0, 0, 0}, {4658, 7, 0x15E, 0x0}, {9676, 5, 0x45C, 0x0}, {11628, 6, 0x2202, 0x338},
+            {0, 0, 0, 0}, {12232, 4, 0x29C1, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {4388, 14, 0x21A6, 0x0}, {16102, 8, 0x21DD, 0x0}, {12344, 4, 0x2A5D, 0x0},
+            {14425, 7, 0x2AD3, 0x0}, {4082, 5, 0x22, 0x0}, {8462, 5, 0xEB, 0x0}, {5187, 6, 0x40E, 0x0},
+            {0, 0, 0, 0}, {14042, 4, 0x2AAA, 0x0}, {10973, 5, 0x2026, 0x0}, {8196, 6, 0xE8, 0x0},
+            {14107, 6, 0x2293, 0x0}, {15861, 5, 0x1D4CC, 0x0}, {8614, 9, 0x2A0D, 0x0}, {15929, 6, 0x2A00, 0x0},
+            {1344, 5, 0x2130, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {11365, 5, 0x226F, 0x0},
+            {4060, 13, 0x221D, 0x0}, {12931, 8, 0x225F, 0x0}, {372, 22, 0x201D, 0x0}, {7703, 8, 0x290F, 0x0},
+            {15684, 6, 0x22A2, 0x0}, {0, 0, 0, 0}, {6702, 6, 0x256B, 0x0}, {0, 0, 0, 0},
+            {9406, 5, 0x22B7, 0x0}, {753, 10, 0xA8, 0x0}, {8217, 9, 0x23E7, 0x0}, {14380, 10, 0x2AC5, 0x0},
+            {7265, 8, 0x29C2, 0x0}, {5234, 9, 0x5F, 0x0}, {12277, 4, 0x29C0, 0x0}, {14210, 7, 0x25AA, 0x0},
+            {2856, 15, 0x226A, 0x0}, {2001, 5, 0x27EA, 0x0}, {5870, 7, 0x2A55, 0x0}, {5877, 5, 0x2A5C, 0x0},
+            {13915, 7, 0x3C2, 0x0}, {0, 0, 0, 0}, {8933, 6, 0x2269, 0x0}, {10422, 6, 0x21FD, 0x0},
+            {12529, 5, 0x3D5, 0x0}, {2731, 7, 0x143, 0x0}, {7479, 8, 0x293D, 0x0}, {2511, 7, 0x13F, 0x0},
+            {9299, 5, 0xEE, 0x0}, {2566, 14, 0x27F8, 0x0}, {0, 0, 0, 0}, {7452, 8, 0x2935, 0x0},
+            {10978, 7, 0x2213, 0x0}, {6727, 6, 0x2555, 0x0}, {15563, 5, 0x2195, 0x0}, {1595, 18, 0x2A7E, 0x0},
+            {9981, 5, 0x21B2, 0x0}, {14448, 12, 0x227D, 0x0}, {7273, 6, 0x2663, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {14519, 5, 0xB2, 0x0}, {0, 0, 0, 0},
+            {11754, 15, 0x2226, 0x0}, {1315, 6, 0x2A75, 0x0}, {7368, 7, 0x222E, 0x0}, {0, 0, 0, 0},
+            {12164, 5, 0xF4, 0x0}, {15197, 5, 0xFB, 0x0}, {1920, 5, 0x1D4A5, 0x0}, {5454, 6, 0x16E, 0x0},
+            {4648, 3, 0x2ABC, 0x0}, {12683, 4, 0x2AB3, 0x0}, {9391, 9, 0x2111, 0x0}, {6913, 5, 0x5C, 0x0},
+            {9768, 7, 0x27E8, 0x0}, {0, 0, 0, 0}, {4049, 11, 0x2237, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {11216, 6, 0x2247, 0x0}, {15461, 6, 0x21C8, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {14808, 7, 0x3D1, 0x0}, {0, 0, 0, 0}, {15372, 6, 0x3D2, 0x0},
+            {7022, 6, 0x2041, 0x0}, {9522, 7, 0xBF, 0x0}, {0, 0, 0, 0}, {11102, 7, 0x22AE, 0x0},
+            {9417, 3, 0x2208, 0x0}, {5055, 4, 0x1D517, 0x0}, {928, 14, 0x21D1, 0x0}, {3472, 21, 0x22E2, 0x0},
+            {7717, 7, 0x10F, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6288, 5, 0x3B2, 0x0},
+            {13011, 6, 0x29A5, 0x0}, {1118, 16, 0x21C1, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {15907, 6, 0x27F8, 0x0}, {11780, 7, 0x2244, 0x0}, {7580, 11, 0x22CF, 0x0}, {6125, 4, 0xE4, 0x0},
+            {0, 0, 0, 0}, {14073, 7, 0x233F, 0x0}, {13580, 9, 0x2A12, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {12396, 5, 0x2134, 0x0}, {542, 5, 0x405, 0x0}, {11202, 7, 0x148, 0x0},
+            {11499, 4, 0x226E, 0x0}, {14890, 7, 0x2A30, 0x0}, {13069, 7, 0x21AA, 0x0}, {1862, 6, 0x12E, 0x0},
+            {4035, 6, 0x2033, 0x0}, {13607, 4, 0x21B1, 0x0}, {9718, 4, 0x2A8B, 0x0}, {2699, 4, 0x1D510, 0x0},
+            {4880, 4, 0x22D0, 0x0}, {0, 0, 0, 0}, {8467, 5, 0x20AC, 0x0}, {13905, 4, 0xAD, 0x0},
+            {10597, 9, 0x231F, 0x0}, {14509, 5, 0x266A, 0x0}, {4761, 5, 0x221A, 0x0}, {7249, 9, 0x2A10, 0x0},
+            {12154, 5, 0x229B, 0x0}, {14524, 4, 0xB3, 0x0}, {2337, 13, 0x21BF, 0x0}, {11646, 7, 0x22E0, 0x0},
+            {0, 0, 0, 0}, {11727, 7, 0x22E1, 0x0}, {13160, 6, 0x298C, 0x0}, {4153, 3, 0x211C, 0x0},
+            {0, 0, 0, 0}, {2029, 7, 0x13B, 0x0}, {0, 0, 0, 0}, {10181, 8, 0x2A81, 0x0},
+            {8230, 4, 0x2A95, 0x0}, {1907, 4, 0x419, 0x0}, {7158, 16, 0x21BA, 0x0}, {14720, 5, 0xDF, 0x0},
+            {1196, 4, 0x14A, 0x0}, {13090, 8, 0x2974, 0x0}, {1358, 4, 0xCB, 0x0}, {14364, 7, 0x2282, 0x0},
+            {5311, 8, 0x2191, 0x0}, {15529, 11, 0x2205, 0x0}, {9320, 4, 0x21D4, 0x0}, {9305, 4, 0x438, 0x0},
+            {6684, 6, 0x256C, 0x0}, {0, 0, 0, 0}, {7894, 7, 0x24, 0x0}, {1370, 13, 0x2147, 0x0},
+            {0, 0, 0, 0}, {9261, 7, 0x210F, 0x0}, {3940, 4, 0x3A6, 0x0}, {9607, 6, 0x237, 0x0},
+            {5044, 7, 0x162, 0x0}, {11926, 7, 0xF1, 0x0}, {5619, 6, 0x22C0, 0x0}, {10748, 6, 0x22B4, 0x0},
+            {15190, 7, 0x16D, 0x0}, {263, 8, 0x2230, 0x0}, {12110, 6, 0x21D6, 0x0}, {1252, 6, 0x112, 0x0},
+            {11409, 6, 0x21CD, 0x0}, {1634, 7, 0x42A, 0x0}, {2483, 10, 0x2272, 0x0}, {9847, 4, 0x2AAB, 0x0},
+            {6275, 6, 0x3F6, 0x0}, {11734, 5, 0x2AB0, 0x338}, {8637, 6, 0xBC, 0x0}, {11926, 6, 0xF1, 0x0},
+            {9588, 4, 0xEF, 0x0}, {1275, 21, 0x25AB, 0x0}, {14488, 9, 0x22E9, 0x0}, {15269, 9, 0x231C, 0x0},
+            {5666, 5, 0x42E, 0x0}, {11024, 6, 0x22B8, 0x0}, {2497, 3, 0x22D8, 0x0}, {186, 7, 0x224E, 0x0},
+            {5712, 7, 0x179, 0x0}, {7392, 7, 0x2117, 0x0}, {5719, 7, 0x17D, 0x0}, {9328, 6, 0xEC, 0x0},
+            {16120, 4, 0x200D, 0x0}, {10946, 7, 0x229F, 0x0}, {9180, 4, 0x1D525, 0x0}, {2659, 7, 0x141, 0x0},
+            {11136, 6, 0x224B, 0x338}, {13700, 5, 0x2AB8, 0x0}, {10953, 7, 0x2238, 0x0}, {12335, 3, 0x2228, 0x0},
+            {10073, 16, 0x21C6, 0x0}, {0, 0, 0, 0}, {7663, 5, 0x21D3, 0x0}, {0, 0, 0, 0},
+            {1237, 6, 0xC8, 0x0}, {6720, 7, 0x29C9, 0x0}, {8058, 5, 0x29F6, 0x0}, {9268, 7, 0x127, 0x0},
+            {13909, 6, 0x3C3, 0x0}, {13216, 8, 0x2969, 0x0}, {2917, 13, 0x2262, 0x0}, {0, 0, 0, 0},
+            {8869, 4, 0x1D524, 0x0}, {3273, 13, 0x2274, 0x0}, {13622, 7, 0x2019, 0x0}, {57, 4, 0x2A53, 0x0},
+            {12737, 12, 0x2AB9, 0x0}, {0, 0, 0, 0}, {8081, 6, 0x25BE, 0x0}, {13660, 9, 0x29CE, 0x0},
+            {3851, 7, 0xD8, 0x0}, {5783, 3, 0x223E, 0x0}, {1161, 13, 0x21A7, 0x0}, {6317, 8, 0x25EF, 0x0},
+            {5671, 7, 0xDD, 0x0}, {1758, 4, 0x418, 0x0}, {10619, 4, 0x200E, 0x0}, {2908, 5, 0x2115, 0x0},
+            {7901, 5, 0x1D555, 0x0}, {5037, 7, 0x164, 0x0}, {0, 0, 0, 0}, {5819, 4, 0x1D51E, 0x0},
+            {1513, 3, 0x22D9, 0x0}, {9296, 3, 0x2063, 0x0}, {10687, 2, 0x3C, 0x0}, {0, 0, 0, 0},
+            {9825, 7, 0x2939, 0x0}, {10562, 4, 0x25CA, 0x0}, {3947, 10, 0xB1, 0x0}, {13320, 5, 0x3F1, 0x0},
+            {6118, 6, 0xE3, 0x0}, {440, 16, 0x222E, 0x0}, {0, 0, 0, 0}, {15748, 5, 0x1D567, 0x0},
+            {14228, 5, 0x1D4C8, 0x0}, {2286, 18, 0x22B4, 0x0}, {0, 0, 0, 0}, {5750, 5, 0x396, 0x0},
+            {12046, 5, 0x2265, 0x20D2}, {11472, 10, 0x2A7D, 0x338}, {14783, 10, 0x2234, 0x0}, {14590, 8, 0x2AC2, 0x0},
+            {10273, 7, 0x230A, 0x0}, {4156, 15, 0x220B, 0x0}, {5688, 4, 0x1D51C, 0x0}, {0, 0, 0, 0},
+            {15162, 5, 0x21D1, 0x0}, {1613, 13, 0x2273, 0x0}, {10877, 4, 0x43C, 0x0}, {14467, 12, 0x2ABA, 0x0},
+            {10843, 11, 0x21A4, 0x0}, {9314, 5, 0xA1, 0x0}, {13166, 8, 0x298E, 0x0}, {6708, 6, 0x2562, 0x0},
+            {3828, 15, 0x2018, 0x0}, {14031, 5, 0x2223, 0x0}, {12192, 5, 0x2299, 0x0}, {2270, 16, 0x29CF, 0x0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {10203, 7, 0x2A93, 0x0}, {14315, 5, 0x2286, 0x0},
+            {347, 25, 0x2232, 0x0}, {0, 0, 0, 0}, {14120, 6, 0x2294, 0x0}, {11840, 10, 0x2288, 0x0},
+            {12027, 7, 0x2904, 0x0}, {14259, 6, 0x2605, 0x0}, {795, 21, 0x21D4, 0x0}, {9030, 7, 0x22D7, 0x0},
+            {6171, 10, 0x2035, 0x0}, {12271, 6, 0x203E, 0x0}, {12900, 5, 0x1D4C6, 0x0}, {11388, 3, 0x220B, 0x0},
+            {0, 0, 0, 0}, {1204, 7, 0xC9, 0x0}, {15172, 7, 0xFA, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {7782, 6, 0x21C3, 0x0}, {1890, 6, 0x406, 0x0},
+            {9328, 7, 0xEC, 0x0}, {0, 0, 0, 0}, {7232, 12, 0x229D, 0x0}, {7934, 8, 0x2214, 0x0},
+            {7472, 7, 0x21B6, 0x0}, {0, 0, 0, 0}, {514, 4, 0x22D3, 0x0}, {15006, 10, 0x225C, 0x0},
+            {13882, 9, 0x2223, 0x0}, {13979, 8, 0x2A24, 0x0}, {13967, 6, 0x2A9F, 0x0}, {10960, 8, 0x2A2A, 0x0},
+            {0, 0, 0, 0}, {2599, 15, 0x27F9, 0x0}, {11376, 6, 0x21AE, 0x0}, {1354, 4, 0x397, 0x0},
+            {1734, 6, 0x132, 0x0}, {8099, 8, 0x29A6, 0x0}, {9858, 5, 0x2AAD, 0x0}, {9636, 6, 0x3BA, 0x0},
+            {13940, 5, 0x2243, 0x0}, {8772, 4, 0x2A86, 0x0}, {5911, 7, 0x2221, 0x0}, {0, 0, 0, 0},
+            {10381, 5, 0x2A89, 0x0}, {11880, 6, 0x2AC6, 0x338}, {3656, 9, 0x2241, 0x0}, {3534, 10, 0x2282, 0x20D2},
+            {13490, 6, 0x21CC, 0x0}, {14064, 4, 0x2F, 0x0}, {14057, 7, 0x44C, 0x0}, {7799, 8, 0x22C4, 0x0},
+            {12872, 7, 0x2008, 0x0}, {11590, 8, 0x22FE, 0x0}, {13146, 7, 0x7D, 0x0}, {4773, 19, 0x2293, 0x0},
+            {9093, 7, 0x200A, 0x0}, {4248, 14, 0x21E5, 0x0}, {5800, 6, 0xB4, 0x0}, {14348, 8, 0x2ABF, 0x0},
+            {15904, 3, 0x3BE, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {8526, 7, 0x2640, 0x0}, {1868, 5, 0x1D540, 0x0}, {5166, 6, 0xDA, 0x0}, {7174, 17, 0x21BB, 0x0},
+            {816, 14, 0x2AE4, 0x0}, {0, 0, 0, 0}, {1204, 6, 0xC9, 0x0}, {1911, 4, 0x1D50D, 0x0},
+            {6902, 5, 0x223D, 0x0}, {913, 15, 0x22A8, 0x0}, {2447, 12, 0x2276, 0x0}, {0, 0, 0, 0},
+            {10280, 4, 0x1D529, 0x0}, {13553, 7, 0x2A2E, 0x0}, {15297, 3, 0xA8, 0x0}, {564, 6, 0x2AE4, 0x0},
+            {8495, 13, 0x2147, 0x0}, {7117, 6, 0x2713, 0x0}, {6602, 6, 0x2557, 0x0}, {10915, 4, 0x2223, 0x0},
+            {612, 15, 0x2D9, 0x0}, {0, 0, 0, 0}, {16003, 7, 0xFD, 0x0}, {8798, 3, 0x2265, 0x0},
+            {14247, 7, 0x22C6, 0x0}, {2871, 8, 0xA, 0x0}, {9376, 6, 0x2111, 0x0}, {5359, 14, 0x296E, 0x0},
+            {12829, 9, 0x2313, 0x0}, {12564, 7, 0x210F, 0x0}, {11968, 15, 0x22EB, 0x0}, {0, 0, 0, 0},
+            {12384, 8, 0x2A57, 0x0}, {9660, 4, 0x1D528, 0x0}, {1762, 5, 0x130, 0x0}, {4295, 19, 0x27E7, 0x0},
+            {12758, 9, 0x22E8, 0x0}, {0, 0, 0, 0}, {9942, 4, 0x43B, 0x0}, {10168, 6, 0x2AA8, 0x0},
+            {10591, 6, 0x21C6, 0x0}, {13035, 7, 0x2975, 0x0}, {1661, 13, 0x210B, 0x0}, {12560, 4, 0x3D6, 0x0},
+            {8053, 5, 0x455, 0x0}, {3872, 4, 0xD6, 0x0}, {11560, 8, 0x22F7, 0x0}, {14085, 7, 0x2660, 0x0},
+            {4903, 9, 0x227B, 0x0}, {8686, 7, 0x2157, 0x0}, {6293, 5, 0x2136, 0x0}, {34, 4, 0x1D504, 0x0},
+            {6884, 7, 0xA6, 0x0}, {0, 0, 0, 0}, {8986, 6, 0x2A7A, 0x0}, {12372, 7, 0x22B6, 0x0},
+            {1810, 9, 0x222B, 0x0}, {7444, 8, 0x2938, 0x0}, {9511, 5, 0x3B9, 0x0}, {9671, 5, 0x445, 0x0},
+            {14827, 9, 0x223C, 0x0}, {13303, 6, 0x21C0, 0x0}, {15075, 6, 0x29CD, 0x0}, {9951, 6, 0x201C, 0x0},
+            {12775, 6, 0x2032, 0x0}, {15730, 6, 0x22B2, 0x0}, {214, 21, 0x2145, 0x0}, {14146, 9, 0x228F, 0x0},
+            {0, 0, 0, 0}, {1487, 7, 0x122, 0x0}, {3106, 16, 0x2275, 0x0}, {7547, 12, 0x22DE, 0x0},
+            {8569, 5, 0x266D, 0x0}, {15108, 6, 0x45B, 0x0}, {1459, 5, 0x403, 0x0}, {11000, 5, 0x1D4C2, 0x0},
+            {6495, 18, 0x25C2, 0x0}, {7421, 6, 0x2AD1, 0x0}, {10821, 4, 0x21A6, 0x0}, {4237, 11, 0x2192, 0x0},
+            {4485, 17, 0x295C, 0x0}, {6550, 6, 0x2593, 0x0}, {7387, 4, 0xA9, 0x0}, {13118, 6, 0x2236, 0x0},
+            {4634, 7, 0x42C, 0x0}, {9863, 6, 0x2AAD, 0xFE00}, {4838, 20, 0x2292, 0x0}, {7079, 5, 0xB8, 0x0},
+            {4368, 11, 0x230B, 0x0}, {10404, 6, 0x2268, 0x0}, {10743, 5, 0x25C3, 0x0}, {0, 0, 0, 0},
+            {10905, 4, 0x2127, 0x0}, {4215, 4, 0x3A1, 0x0}, {627, 23, 0x2DD, 0x0}, {6768, 6, 0x252C, 0x0},
+            {235, 8, 0x212D, 0x0}, {9840, 7, 0x21A2, 0x0}, {15197, 6, 0xFB, 0x0}, {13211, 5, 0x2937, 0x0},
+            {5379, 11, 0x21A5, 0x0}, {10198, 5, 0x22DA, 0xFE00}, {8389, 7, 0x3D, 0x0}, {14713, 7, 0x292A, 0x0},
+            {0, 0, 0, 0}, {12281, 6, 0x14D, 0x0}, {9073, 10, 0x2269, 0xFE00}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {8574, 6, 0xFB02, 0x0}, {1806, 4, 0x222C, 0x0}, {11276, 6, 0x2250, 0x338},
+            {14514, 5, 0xB9, 0x0}, {3731, 7, 0xD1, 0x0}, {0, 0, 0, 0}, {6556, 6, 0x2588, 0x0},
+            {9143, 6, 0x125, 0x0}, {1233, 4, 0x1D508, 0x0}, {13712, 6, 0x227D, 0x0}, {1048, 18, 0x295E, 0x0},
+            {13891, 14, 0x2225, 0x0}, {6310, 7, 0x22C2, 0x0}, {12674, 5, 0xA3, 0x0}, {5592, 4, 0x1D519, 0x0},
+            {5896, 4, 0x2220, 0x0}, {12401, 6, 0xF8, 0x0}, {12905, 12, 0x210D, 0x0}, {5578, 14, 0x200A, 0x0},
+            {5425, 16, 0x2197, 0x0}, {9023, 7, 0x2978, 0x0}, {12487, 7, 0x25, 0x0}, {5838, 6, 0x2135, 0x0},
+            {5810, 6, 0xE6, 0x0}, {5963, 9, 0x29AD, 0x0}, {8679, 7, 0xBE, 0x0}, {7191, 9, 0xAE, 0x0},
+            {0, 0, 0, 0}, {7054, 6, 0x109, 0x0}, {14139, 7, 0x2291, 0x0}, {12513, 8, 0x2031, 0x0},
+            {3639, 17, 0x2289, 0x0}, {8403, 6, 0x2261, 0x0}, {7345, 10, 0x2102, 0x0}, {537, 5, 0x402, 0x0},
+            {0, 0, 0, 0}, {9946, 5, 0x2936, 0x0}, {250, 6, 0xC7, 0x0}, {722, 9, 0x2250, 0x0},
+            {9058, 8, 0x2277, 0x0}, {0, 0, 0, 0}, {6089, 6, 0xE5, 0x0}, {5284, 6, 0x22C3, 0x0},
+            {5178, 9, 0x2949, 0x0}, {12944, 6, 0x21DB, 0x0}, {8902, 4, 0x2AA4, 0x0}, {12180, 7, 0x151, 0x0},
+            {2017, 5, 0x219E, 0x0}, {15707, 7, 0x22EE, 0x0}, {13076, 7, 0x21AC, 0x0}, {15777, 7, 0x228A, 0xFE00},
+            {8443, 6, 0x2250, 0x0}, {14943, 7, 0x2034, 0x0}, {13962, 5, 0x2A9D, 0x0}, {7788, 6, 0x21C2, 0x0},
+            {6859, 6, 0x2524, 0x0}, {5671, 6, 0xDD, 0x0}, {9132, 6, 0x21AD, 0x0}, {14679, 7, 0x2AD6, 0x0},
+            {15935, 5, 0x1D569, 0x0}, {1626, 5, 0x1D4A2, 0x0}, {10919, 7, 0x2A, 0x0}, {6513, 19, 0x25B8, 0x0},
+            {17, 7, 0x102, 0x0}, {0, 0, 0, 0}, {10467, 11, 0x27FC, 0x0}, {13826, 7, 0x2929, 0x0},
+            {12323, 6, 0x29B9, 0x0}, {11820, 6, 0x2AC5, 0x338}, {5460, 5, 0x1D4B0, 0x0}, {6661, 6, 0x255A, 0x0},
+            {6359, 9, 0x2A06, 0x0}, {10399, 5, 0x2A87, 0x0}, {1454, 5, 0x2131, 0x0}, {9790, 6, 0x21E4, 0x0},
+            {5927, 9, 0x29A9, 0x0}, {3627, 12, 0x2283, 0x20D2}, {15213, 7, 0x171, 0x0}, {15798, 8, 0x299A, 0x0},
+            {15680, 4, 0x432, 0x0}, {15450, 5, 0x25B5, 0x0}, {4576, 13, 0x2970, 0x0}, {0, 0, 0, 0},
+            {1719, 10, 0x224F, 0x0}, {13309, 7, 0x296C, 0x0}, {15237, 6, 0xF9, 0x0}, {715, 7, 0x20DC, 0x0},
+            {4671, 4, 0x421, 0x0}, {11156, 6, 0x266E, 0x0}, {7416, 5, 0x2ACF, 0x0}, {0, 0, 0, 0},
+            {10310, 6, 0x2584, 0x0}, {9229, 15, 0x21AA, 0x0}, {0, 0, 0, 0}, {15496, 6, 0x22A8, 0x0},
+            {6463, 14, 0x25B4, 0x0}, {12056, 8, 0x29DE, 0x0}, {15297, 4, 0xA8, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {6222, 5, 0x23B5, 0x0},
+            {6145, 5, 0x2AED, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {4448, 19, 0x22B5, 0x0},
+            {8417, 9, 0x29E5, 0x0}, {9411, 6, 0x1B5, 0x0}, {6907, 6, 0x22CD, 0x0}, {5398, 12, 0x21D5, 0x0},
+            {7731, 8, 0x2021, 0x0}, {12251, 6, 0x21BA, 0x0}, {13351, 17, 0x21C1, 0x0}, {12698, 4, 0x2AAF, 0x0},
+            {14179, 9, 0x2290, 0x0}, {3932, 4, 0x41F, 0x0}, {13417, 17, 0x21C9, 0x0}, {9715, 3, 0x2266, 0x0},
+            {7387, 5, 0xA9, 0x0}, {731, 22, 0x222F, 0x0}, {15278, 7, 0x230F, 0x0}, {5472, 4, 0xDC, 0x0},
+            {0, 0, 0, 0}, {3858, 7, 0xD5, 0x0}, {12483, 4, 0x43F, 0x0}, {2745, 7, 0x145, 0x0},
+            {4694, 15, 0x2190, 0x0}, {7591, 6, 0xA4, 0x0}, {11329, 5, 0x2271, 0x0}, {5816, 3, 0x2061, 0x0},
+            {14342, 6, 0x228A, 0x0}, {3559, 12, 0x2281, 0x0}, {8292, 5, 0x2002, 0x0}, {0, 0, 0, 0},
+            {9613, 5, 0x1D55B, 0x0}, {5564, 14, 0x2240, 0x0}, {10863, 7, 0x25AE, 0x0}, {11395, 5, 0x22FA, 0x0},
+            {12939, 4, 0x22, 0x0}, {4858, 12, 0x2294, 0x0}, {1896, 4, 0xCF, 0x0}, {10933, 7, 0xB7, 0x0},
+            {13956, 6, 0x2AA0, 0x0}, {5639, 4, 0x1D51B, 0x0}, {0, 0, 0, 0}, {9957, 7, 0x201E, 0x0},
+            {11861, 6, 0x2281, 0x0}, {15597, 14, 0x2ACB, 0xFE00}, {8910, 5, 0x2A8A, 0x0}, {0, 0, 0, 0},
+            {11370, 6, 0x21CE, 0x0}, {1729, 5, 0x415, 0x0}, {7635, 6, 0x22CF, 0x0}, {13189, 7, 0x157, 0x0},
+            {8823, 4, 0x2A7E, 0x0}, {8048, 5, 0x1D4B9, 0x0}, {875, 21, 0x27F9, 0x0}, {2401, 15, 0x21D4, 0x0},
+            {5702, 5, 0x178, 0x0}, {6189, 10, 0x22CD, 0x0}, {3328, 12, 0x2280, 0x0}, {8331, 8, 0x3B5, 0x0},
+            {9460, 9, 0x2124, 0x0}, {3228, 15, 0x2278, 0x0}, {15312, 8, 0x2191, 0x0}, {5516, 5, 0x2016, 0x0},
+            {7108, 4, 0x1D520, 0x0}, {1740, 5, 0x401, 0x0}, {1551, 17, 0x2267, 0x0}, {0, 0, 0, 0},
+            {13399, 18, 0x21CC, 0x0}, {138, 4, 0x411, 0x0}, {4096, 5, 0x1D4AC, 0x0}, {5228, 6, 0x16A, 0x0},
+            {0, 0, 0, 0}, {10566, 8, 0x25CA, 0x0}, {10410, 6, 0x22E6, 0x0}, {0, 0, 0, 0},
+            {10146, 4, 0x2264, 0x0}, {1409, 22, 0x25AA, 0x0}, {423, 10, 0x2261, 0x0}, {11340, 10, 0x2A7E, 0x338},
+            {9757, 5, 0x27E8, 0x0}, {570, 7, 0x10E, 0x0}, {0, 0, 0, 0}, {15320, 12, 0x2195, 0x0},
+            {1679, 15, 0x2500, 0x0}, {13000, 5, 0x27E9, 0x0}, {6631, 6, 0x2566, 0x0}, {11070, 4, 0x22D8, 0x338},
+            {0, 0, 0, 0}, {15575, 9, 0x3C2, 0x0}, {11710, 6, 0x22EB, 0x0}, {4805, 18, 0x2291, 0x0},
+            {5069, 6, 0x398, 0x0}, {1500, 4, 0x413, 0x0}, {15346, 15, 0x21BE, 0x0}, {14113, 7, 0x2293, 0xFE00},
+            {161, 5, 0x392, 0x0}, {960, 18, 0x2225, 0x0}, {2350, 16, 0x2958, 0x0}, {11723, 4, 0x2281, 0x0},
+            {5221, 7, 0xD9, 0x0}, {5990, 6, 0x221F, 0x0}, {15866, 5, 0x22C2, 0x0}, {5764, 5, 0x1D4B5, 0x0},
+            {2230, 13, 0x21A4, 0x0}, {8226, 4, 0x2113, 0x0}, {8862, 7, 0x2A94, 0x0}, {15443, 7, 0x169, 0x0},
+            {0, 0, 0, 0}, {4101, 6, 0x2910, 0x0}, {11739, 5, 0x1D4C3, 0x0}, {7309, 6, 0x2C, 0x0},
+            {14328, 8, 0x2AC1, 0x0}, {13224, 6, 0x201D, 0x0}, {11334, 6, 0x2267, 0x338}, {4262, 20, 0x21C4, 0x0},
+            {5794, 6, 0xE2, 0x0}, {1431, 5, 0x1D53D, 0x0}, {11850, 11, 0x2AC5, 0x338}, {10043, 15, 0x21C7, 0x0},
+            {2243, 14, 0x295A, 0x0}, {8658, 7, 0x215B, 0x0}, {7034, 6, 0x2A4D, 0x0}, {16015, 6, 0x177, 0x0},
+            {3414, 20, 0x29D0, 0x338}, {13174, 8, 0x2990, 0x0}, {67, 5, 0x1D538, 0x0}, {0, 0, 0, 0},
+            {10813, 8, 0x2720, 0x0}, {6, 4, 0x26, 0x0}, {12225, 7, 0xF2, 0x0}, {988, 13, 0x2913, 0x0},
+            {13693, 3, 0x227B, 0x0}, {8297, 6, 0x119, 0x0}, {7673, 7, 0x2020, 0x0}, {0, 0, 0, 0},
+            {9697, 5, 0x21D0, 0x0}, {13264, 6, 0x211D, 0x0}, {0, 0, 0, 0}, {9785, 5, 0x2190, 0x0},
+            {2433, 14, 0x2266, 0x0}, {8734, 6, 0x2322, 0x0}, {11361, 4, 0x226F, 0x0}, {3357, 22, 0x22E0, 0x0},
+            {14665, 7, 0x2AC8, 0x0}, {0, 0, 0, 0}, {8041, 7, 0x230C, 0x0}, {3085, 21, 0x2A7E, 0x338},
+            {11516, 5, 0x2224, 0x0}, {11148, 8, 0x2249, 0x0}, {10574, 5, 0x29EB, 0x0}, {12089, 7, 0x2903, 0x0},
+            {15467, 4, 0xFC, 0x0}, {706, 5, 0x1D53B, 0x0}, {4976, 9, 0x2283, 0x0}, {14582, 8, 0x297B, 0x0},
+            {2738, 7, 0x147, 0x0}, {8276, 7, 0x2005, 0x0}, {0, 0, 0, 0}, {6095, 5, 0x1D4B6, 0x0},
+            {2416, 17, 0x22DA, 0x0}, {13030, 5, 0x2192, 0x0}, {7692, 5, 0x2010, 0x0}, {6588, 7, 0x22A5, 0x0},
+            {8939, 6, 0x22E7, 0x0}, {10792, 6, 0x223A, 0x0}, {13602, 5, 0x1D4C7, 0x0}, {0, 0, 0, 0},
+            {9487, 8, 0x2A3C, 0x0}, {2532, 19, 0x27F7, 0x0}, {14610, 8, 0x2AC0, 0x0}, {7085, 8, 0x29B2, 0x0},
+            {12660, 9, 0x2A15, 0x0}, {6938, 7, 0x2022, 0x0}, {10680, 7, 0x142, 0x0}, {104, 6, 0xC3, 0x0},
+            {8848, 9, 0x2A84, 0x0}, {8740, 5, 0x1D4BB, 0x0}, {3167, 19, 0x29CF, 0x338}, {8112, 9, 0x27FF, 0x0},
+            {9559, 7, 0x22F3, 0x0}, {5844, 6, 0x3B1, 0x0}, {1066, 15, 0x21BD, 0x0}, {8483, 12, 0x2130, 0x0},
+            {13857, 7, 0x2322, 0x0}, {8132, 6, 0xE9, 0x0}, {0, 0, 0, 0}, {12494, 7, 0x2E, 0x0},
+            {15307, 5, 0x1D566, 0x0}, {8972, 6, 0x2A90, 0x0}, {8366, 11, 0x2A96, 0x0}, {0, 0, 0, 0},
+            {0, 0, 0, 0}, {10377, 4, 0x2268, 0x0}, {14046, 5, 0x2AAC, 0x0}, {11684, 7, 0x2933, 0x338},
+            {0, 0, 0, 0}, {0, 5, 0xC6, 0x0}, {552, 7, 0x2021, 0x0}, {0, 0, 0, 0},
+            {6438, 13, 0x29EB, 0x0}, {8352, 8, 0x2255, 0x0}, {10825, 7, 0x21A6, 0x0}, {5300, 6, 0x172, 0x0},
+            {15547, 6, 0x3D6, 0x0}, {6125, 5, 0xE4, 0x0}, {1028, 20, 0x2950, 0x0}, {15882, 6, 0x25BD, 0x0},
+            {6089, 5, 0xE5, 0x0}, {13242, 5, 0x211C, 0x0}, {7411, 5, 0x1D4B8, 0x0}, {1383, 4, 0x424, 0x0},
+            {3571, 17, 0x2AB0, 0x338}, {4891, 12, 0x2286, 0x0}, {6045, 3, 0x2248, 0x0}, {7910, 6, 0x2250, 0x0},
+            {15991, 5, 0x22C1, 0x0}, {6246, 6, 0x201E, 0x0}, {13325, 11, 0x2192, 0x0}, {10366, 11, 0x23B0, 0x0},
+            {4111, 7, 0x154, 0x0}, {15568, 7, 0x3F1, 0x0}, {7079, 6, 0xB8, 0x0}, {3016, 16, 0x2271, 0x0},
+            {12606, 8, 0x2A22, 0x0}, {10533, 7, 0x2A2D, 0x0}, {16033, 5, 0x457, 0x0}, {8093, 6, 0x296F, 0x0},
+            {15871, 6, 0x25EF, 0x0}, {7992, 16, 0x21C3, 0x0}, {14166, 6, 0x2290, 0x0}, {12413, 6, 0xF5, 0x0},
+            {0, 0, 0, 0}, {3588, 22, 0x22E1, 0x0}, {8553, 4, 0x1D523, 0x0}, {7887, 7, 0x230D, 0x0},
+            {14742, 7, 0x165, 0x0}, {9909, 8, 0x298D, 0x0}, {0, 0, 0, 0}, {11296, 6, 0x2242, 0x338},
+            {9702, 7, 0x291B, 0x0}, {9309, 5, 0x435, 0x0}, {7843, 4, 0xF7, 0x0}, {5862, 4, 0x26, 0x0},
+            {14574, 8, 0x2AD7, 0x0}, {15791, 7, 0x228B, 0xFE00}, {0, 0, 0, 0}, {6451, 12, 0x25AA, 0x0},
+            {8377, 12, 0x2A95, 0x0}, {5373, 6, 0x22A5, 0x0}, {11400, 4, 0x220B, 0x0}, {12408, 5, 0x2298, 0x0},
+            {12263, 8, 0x29BB, 0x0}, {4107, 4, 0xAE, 0x0}, {8586, 5, 0x192, 0x0}, {11892, 8, 0x2283, 0x20D2},
+            {0, 0, 0, 0}, {9545, 8, 0x22F5, 0x0}, {9112, 7, 0x44A, 0x0}, {4641, 7, 0x15A, 0x0},
+            {12014, 6, 0x2007, 0x0}, {5786, 4, 0x223E, 0x333}, {11249, 6, 0x21D7, 0x0}, {9005, 8, 0x2A7C, 0x0},
+            {0, 0, 0, 0}, {11350, 5, 0x2A7E, 0x338}, {111, 5, 0xC4, 0x0}, {2961, 11, 0x2209, 0x0},
+            {1174, 10, 0x21D3, 0x0}, {0, 0, 0, 0}, {7532, 7, 0x21B7, 0x0}, {10662, 5, 0x5B, 0x0},
+            {11598, 8, 0x22FD, 0x0}, {2713, 5, 0x1D544, 0x0}, {7656, 7, 0x232D, 0x0}, {0, 0, 0, 0},
+            {9869, 6, 0x290C, 0x0}, {131, 7, 0x2306, 0x0}, {9066, 7, 0x2273, 0x0}, {0, 0, 0, 0},
+            {14799, 9, 0x3D1, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {12879, 4, 0x1D52E, 0x0},
+            {9534, 5, 0x2208, 0x0}, {0, 6, 0xC6, 0x0}, {9314, 6, 0xA1, 0x0}, {13573, 7, 0x2994, 0x0},
+            {0, 0, 0, 0}, {11355, 6, 0x2275, 0x0}, {7141, 5, 0x29C3, 0x0}, {11921, 5, 0x2279, 0x0},
+            {10258, 8, 0x2272, 0x0}, {15053, 5, 0x225C, 0x0}, {0, 0, 0, 0}, {14849, 7, 0x223C, 0x0},
+            {12401, 7, 0xF8, 0x0}, {11793, 6, 0x2226, 0x0}, {13929, 4, 0x223C, 0x0}, {9972, 9, 0x294B, 0x0},
+            {10522, 6, 0x2985, 0x0}, {0, 0, 0, 0}, {14015, 7, 0x2A33, 0x0}, {11552, 8, 0x2209, 0x0},
+            {6118, 7, 0xE3, 0x0}, {14254, 5, 0x2606, 0x0}, {6130, 9, 0x2233, 0x0}, {5154, 5, 0x1D4AF, 0x0},
+            {6774, 6, 0x2534, 0x0}, {0, 0, 0, 0}, {10798, 5, 0xAF, 0x0}, {13056, 6, 0x2933, 0x0},
+            {5945, 9, 0x29AB, 0x0}, {11466, 6, 0x2266, 0x338}, {11503, 6, 0x22EA, 0x0}, {3456, 16, 0x228F, 0x338},
+            {13124, 10, 0x211A, 0x0}, {12820, 9, 0x2312, 0x0}, {11170, 9, 0x2115, 0x0}, {0, 0, 0, 0},
+            {14308, 7, 0x2ABD, 0x0}, {3794, 8, 0x39F, 0x0}, {0, 0, 0, 0}, {10316, 5, 0x459, 0x0},
+            {16029, 4, 0x1D536, 0x0}, {11115, 7, 0x144, 0x0}, {276, 8, 0xB8, 0x0}, {0, 0, 0, 0},
+            {2304, 17, 0x2951, 0x0}, {4431, 17, 0x29D0, 0x0}, {14411, 7, 0x2AC7, 0x0}, {6679, 5, 0x2551, 0x0},
+            {1631, 3, 0x226B, 0x0}, {4078, 4, 0x3A8, 0x0}, {13922, 7, 0x3C2, 0x0}, {8928, 5, 0x2A88, 0x0},
+            {104, 7, 0xC3, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {14692, 7, 0x2926, 0x0},
+            {1781, 6, 0x12A, 0x0}, {15098, 5, 0x1D4C9, 0x0}, {10687, 3, 0x3C, 0x0}, {9709, 6, 0x290E, 0x0},
+            {1184, 5, 0x1D49F, 0x0}, {15220, 6, 0x296E, 0x0}, {0, 0, 0, 0}, {15919, 5, 0x27FC, 0x0},
+            {12441, 6, 0x233D, 0x0}, {13821, 5, 0x3B, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0},
+            {12628, 6, 0x2A72, 0x0}, {2040, 17, 0x27E8, 0x0}, {13471, 13, 0x2253, 0x0}, {8454, 4, 0x3B7, 0x0},
+            {4135, 7, 0x158, 0x0}, {15553, 10, 0x221D, 0x0}, {12000, 3, 0x3BD, 0x0}, {11653, 5, 0x2AAF, 0x338},
+            {11493, 6, 0x2274, 0x0}, {5656, 5, 0x42F, 0x0}, {8288, 4, 0x14B, 0x0}, {6059, 4, 0x224A, 0x0},
+            {11658, 6, 0x2280, 0x0}, {14991, 15, 0x22B4, 0x0}, {13336, 15, 0x21A3, 0x0}, {8898, 4, 0x2AA5, 0x0},
+            {11716, 7, 0x22ED, 0x0}, {1896, 5, 0xCF, 0x0}, {0, 0, 0, 0}, {763, 16, 0x21D3, 0x0},
+            {0, 0, 0, 0}, {8360, 6, 0x2242, 0x0}, {4171, 19, 0x21CB, 0x0}, {8472, 5, 0x21, 0x0},
+            {11910, 11, 0x2AC6, 0x338}, {14918, 7, 0x2AF1, 0x0}, {14538, 7, 0x2ABE, 0x0}, {16115, 5, 0x1D4CF, 0x0},
+            {6159, 12, 0x3F6, 0x0}, {15367, 5, 0x3C5, 0x0}, {14336, 6, 0x2ACB, 0x0}, {11054, 16, 0x21CE, 0x0},
+            {6780, 9, 0x229F, 0x0}, {2206, 16, 0x294E, 0x0}, {3122, 16, 0x224E, 0x338}, {12116, 7, 0x2923, 0x0},
+            {5823, 6, 0xE0, 0x0}, {4985, 14, 0x2287, 0x0}, {5759, 5, 0x2124, 0x0}, {0, 0, 0, 0},
+            {577, 4, 0x414, 0x0}, {7724, 4, 0x434, 0x0}, {7977, 15, 0x21CA, 0x0}, {13777, 6, 0x22A1, 0x0},
+            {1873, 5, 0x399, 0x0}, {8665, 7, 0x2154, 0x0}, {9335, 3, 0x2148, 0x0}, {2913, 4, 0x2AEC, 0x0},
+            {5707, 5, 0x416, 0x0}, {5613, 6, 0x174, 0x0}, {2726, 5, 0x40A, 0x0}, {8809, 5, 0x2267, 0x0},
+            {3957, 14, 0x210C, 0x0}, {6566, 8, 0x2261, 0x20E5}, {13987, 8, 0x2972, 0x0}, {7847, 7, 0xF7, 0x0},
+            {14726, 7, 0x2316, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {15472, 8, 0x29A7, 0x0},
+            {16076, 5, 0x17C, 0x0}, {10, 7, 0xC1, 0x0}, {7514, 7, 0x228D, 0x0}, {10324, 6, 0x21C7, 0x0},
+            {13669, 8, 0x2968, 0x0}, {6376, 16, 0x25BD, 0x0}, {11886, 6, 0x2289, 0x0}, {9566, 6, 0x2208, 0x0},
+            {11038, 5, 0x226B, 0x338}, {6818, 6, 0x2518, 0x0}, {5505, 4, 0x22C1, 0x0}, {9282, 7, 0x2010, 0x0},
+            {4651, 7, 0x160, 0x0}, {0, 0, 0, 0}, {7432, 6, 0x2AD2, 0x0}, {11095, 7, 0x22AF, 0x0},
+            {0, 0, 0, 0}, {4665, 6, 0x15C, 0x0}, {11317, 4, 0x1D52B, 0x0}, {11131, 5, 0x2A70, 0x338},
+            {5128, 11, 0x2248, 0x0}, {15924, 5, 0x22FB, 0x0}, {1480, 7, 0x11E, 0x0}, {7825, 4, 0xA8, 0x0},
+            {4118, 5, 0x27EB, 0x0}, {14978, 13, 0x25C3, 0x0}, {10629, 7, 0x2039, 0x0}, {1878, 5, 0x2110, 0x0},
+            {2067, 13, 0x21E4, 0x0}, {13182, 7, 0x159, 0x0}, {10940, 6, 0x2212, 0x0}, {3738, 3, 0x39D, 0x0},
+            {0, 0, 0, 0}, {9037, 10, 0x22DB, 0x0}, {7967, 10, 0x2193, 0x0}, {6242, 4, 0x431, 0x0},
+            {15467, 5, 0xFC, 0x0}, {10548, 7, 0x2217, 0x0}, {10968, 5, 0x2ADB, 0x0}, {11321, 4, 0x2267, 0x338},
+            {0, 0, 0, 0}, {711, 4, 0xA8, 0x0}, {12978, 7, 0x155, 0x0}, {10297, 6, 0x21BC, 0x0},
+            {5206, 4, 0x423, 0x0}, {7778, 4, 0x1D521, 0x0}, {5059, 10, 0x2234, 0x0}, {12955, 7, 0x291C, 0x0},
+            {0, 0, 0, 0}, {12187, 5, 0x2A38, 0x0}, {13496, 4, 0x200F, 0x0}, {11621, 7, 0x2AFD, 0x20E5},
+            {1200, 3, 0xD0, 0x0}, {1296, 6, 0x118, 0x0}, {15103, 5, 0x446, 0x0}, {15806, 6, 0x175, 0x0},
+            {7427, 5, 0x2AD0, 0x0}, {6040, 5, 0x1D552, 0x0}, {9149, 7, 0x2665, 0x0}, {11642, 4, 0x2280, 0x0},
+            {7591, 7, 0xA4, 0x0}, {5096, 6, 0x223C, 0x0}, {6227, 9, 0x23B6, 0x0}, {15386, 11, 0x21C8, 0x0},
+            {12579, 7, 0x210F, 0x0}, {15978, 7, 0x2A04, 0x0}, {9623, 7, 0x458, 0x0}, {11983, 17, 0x22ED, 0x0},
+            {5483, 5, 0x2AEB, 0x0}, {11425, 5, 0x2025, 0x0}, {15226, 7, 0x297E, 0x0}, {15285, 6, 0x25F8, 0x0},
+            {8180, 3, 0x2147, 0x0}, {8171, 4, 0x44D, 0x0}, {11826, 6, 0x2288, 0x0}, {12850, 6, 0x227E, 0x0},
+            {16048, 5, 0x44E, 0x0}, {11568, 8, 0x22F6, 0x0}, {10210, 11, 0x2A85, 0x0}, {16065, 7, 0x17E, 0x0},
+            {5806, 4, 0x430, 0x0}, {0, 0, 0, 0}, {10107, 20, 0x21AD, 0x0}, {12301, 5, 0x29B6, 0x0},
+            {0, 0, 0, 0}, {6853, 6, 0x253C, 0x0}, {15121, 6, 0x226C, 0x0}, {0, 0, 0, 0},
+            {14760, 5, 0x20DB, 0x0}, {12436, 4, 0xF6, 0x0}, {9917, 7, 0x13E, 0x0}, {14749, 7, 0x163, 0x0},
+            {8303, 5, 0x1D556, 0x0}, {7491, 9, 0x2A48, 0x0}, {30, 4, 0x410, 0x0}, {0, 0, 0, 0},
+            {14881, 9, 0x2A31, 0x0}, {11012, 3, 0x3BC, 0x0}, {11015, 9, 0x22B8, 0x0}, {11404, 5, 0x45A, 0x0},
+            {11611, 10, 0x2226, 0x0}, {15742, 6, 0x2283, 0x20D2}, {15455, 6, 0x25B4, 0x0}, {8207, 7, 0x2A98, 0x0},
+            {4629, 5, 0x428, 0x0}, {15892, 6, 0x27FA, 0x0}, {13722, 7, 0x15F, 0x0}, {6110, 8, 0x224D, 0x0},
+            {0, 0, 0, 0}, {7771, 7, 0x297F, 0x0}, {0, 0, 0, 0}, {13654, 6, 0x25B8, 0x0},
+            {8247, 6, 0x2205, 0x0}, {15397, 7, 0x231D, 0x0}, {6104, 6, 0x2248, 0x0}, {8546, 7, 0xFB04, 0x0},
+            {5546, 18, 0x2758, 0x0}, {11209, 7, 0x146, 0x0}, {15947, 7, 0x2A02, 0x0}, {11933, 5, 0x2278, 0x0},
+            {8805, 4, 0x2265, 0x0}, {11268, 8, 0x2197, 0x0}, {15851, 3, 0x2240, 0x0}, {12039, 7, 0x22AC, 0x0},
+            {14126, 7, 0x2294, 0xFE00}, {0, 0, 0, 0}, {38, 7, 0xC0, 0x0}, {126, 5, 0x2AE7, 0x0},
+            {5521, 12, 0x2223, 0x0}, {4560, 11, 0x21D2, 0x0}, {8776, 7, 0x11F, 0x0}, {1568, 15, 0x2AA2, 0x0},
+            {16093, 4, 0x1D537, 0x0}, {5882, 9, 0x2A58, 0x0}, {10870, 7, 0x2A29, 0x0}, {830, 20, 0x27F8, 0x0},
+            {0, 0, 0, 0}, {2940, 21, 0x2226, 0x0}, {11302, 7, 0x2204, 0x0}, {7952, 15, 0x2306, 0x0},
+            {12586, 5, 0x2B, 0x0}, {9364, 6, 0x133, 0x0}, {0, 0, 0, 0}, {2655, 4, 0x21B0, 0x0},
+            {12436, 5, 0xF6, 0x0}, {7405, 6, 0x2717, 0x0}, {6100, 4, 0x2A, 0x0}, {13083, 7, 0x2945, 0x0},
+            {7466, 6, 0x22DF, 0x0}, {14133, 6, 0x228F, 0x0}, {5900, 5, 0x29A4, 0x0}, {3052, 18, 0x226B, 0x338},
+            {257, 6, 0x108, 0x0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {1778, 3, 0x2111, 0x0},
+            {1994, 7, 0x39B, 0x0}, {3434, 22, 0x22ED, 0x0}, {13945, 6, 0x2243, 0x0}, {528, 9, 0x2911, 0x0},
+            {11109, 6, 0x2207, 0x0}, {14172, 7, 0x2292, 0x0}, {10777, 10, 0x2268, 0xFE00}, {14793, 6, 0x3B8, 0x0},
+            {7380, 7, 0x2210, 0x0}, {13098, 7, 0x21A3, 0x0}, {11832, 8, 0x2282, 0x20D2}, {13808, 8, 0x2198, 0x0},
+            {9156, 10, 0x2665, 0x0}, {0, 0, 0, 0}, {13017, 7, 0x27E9, 0x0}, {10636, 5, 0x1D4C1, 0x0},
+            {7137, 4, 0x25CB, 0x0}, {2321, 16, 0x2960, 0x0}, {5981, 9, 0x29AF, 0x0}, {11526, 4, 0xAC, 0x0},
+            {9796, 8, 0x291F, 0x0}, {10321, 3, 0x226A, 0x0}, {13230, 7, 0x201D, 0x0}, {1771, 6, 0xCC, 0x0},
+            {8087, 6, 0x21F5, 0x0}, {8608, 6, 0x2AD9, 0x0}, {14068, 5, 0x29C4, 0x0}, {7753, 3, 0xB0, 0x0},
+            {8783, 6, 0x11D, 0x0}, {1387, 4, 0x1D509, 0x0}, {0, 0, 0, 0}, {6325, 7, 0x22C3, 0x0},
+            {7360, 8, 0x2A6D, 0x0}, {12680, 3, 0x227A, 0x0}, {1925, 7, 0x408, 0x0}, {15089, 9, 0x23E2, 0x0},
+            {11179, 5, 0xA0, 0x0}, {8563, 6, 0x66, 0x6A}, {1473, 7, 0x3DC, 0x0}, {3138, 13, 0x224F, 0x338},
+            {7745, 8, 0x2A77, 0x0}, {2493, 4, 0x1D50F, 0x0}, {11461, 5, 0x2270, 0x0}, {12257, 6, 0x29BE, 0x0},
+            {5625, 4, 0x1D51A, 0x0}, {0, 0, 0, 0}, {16110, 5, 0x1D56B, 0x0}, {7066, 8, 0x2A50, 0x0},
+        };
+
+        const Entry &e = entry[Hash(name, len, seed[Hash(name, len, 0) % BUCKETS]) % SLOTS];
+        if (e.len != len || memcmp(names + e.name, name, len) != 0) return false;
+
+        first = e.first;
+        second = e.second;
+        return true;
+    }
+
+private:
+    enum {
+        BUCKETS = 640,
+        SLOTS = 2560,
+        LONGEST = 32,           // longest name, ';' included
+        LONGEST_LEGACY = 6      // longest name that is also valid without ';'
+    };
+
+    /**
+     * FNV-1a
+     */
+    static uint32_t Hash(const char *name, size_t len, uint32_t seed) {
+        uint32_t h = 2166136261u ^ seed;
+        for (size_t i = 0; i < len; i++) {
+            h ^= (unsigned char) name[i];
+            h *= 16777619u;
+        }
+
+        return h;
+    }
+
+    static bool IsAlnum(char c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    static int Digit(char c, bool hex) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (hex && c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (hex && c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    /**
+     * decodes the reference at p, p[0] being '&', into out.
+     * @return bytes used, 0 when it is no reference
+     */
+    static size_t Reference(const char *p, const char *end, bool attribute, std::string &out) {
+        const char *q = p + 1;
+        if (q < end && *q == '#') {
+            bool hex = ++q < end && (*q == 'x' || *q == 'X');
+            if (hex) q++;
+
+            const char *digits = q;
+            uint32_t cp = 0;
+            for (int d; q < end && (d = Digit(*q, hex)) >= 0; q++) {
+                // every digit is consumed, the value saturates
+                cp = cp > 0x10FFFF ? cp : cp * (hex ? 16 : 10) + d;
+            }
+
+            if (q == digits) return 0;
+            if (q < end && *q == ';') q++;
+
+            AppendUtf8(Numeric(cp), out);
+            return q - p;
+        }
+
+        const char *name = q;
+        while (q < end && IsAlnum(*q) && q - name < LONGEST) q++;
+
+        size_t run = q - name;
+        uint32_t first, second;
+        if (run && q < end && *q == ';' && Lookup(name, run + 1, first, second)) {
+            AppendUtf8(first, out);
+            if (second) AppendUtf8(second, out);
+            return run + 2;
+        }
+
+        // the longest name valid without ';' that the text starts with
+        for (size_t n = std::min(run, (size_t) LONGEST_LEGACY); n >= 2; n--) {
+            if (!Lookup(name, n, first, second)) continue;
+
+            if (attribute && name + n < end && (name[n] == '=' || IsAlnum(name[n]))) return 0;
+
+            AppendUtf8(first, out);
+            if (second) AppendUtf8(second, out);
+            return n + 1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * the code point a numeric reference stands for.
+     */
+    static uint32_t Numeric(uint32_t cp) {
+        // windows-1252 for 0x80 - 0x9f, 0 where it has no character
+        static const unsigned short c1[32] = {
+            0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+            0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+            0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+            0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+        };
+
+        if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return 0xFFFD;
+        if (cp >= 0x80 && cp <= 0x9F && c1[cp - 0x80]) return c1[cp - 0x80];
+        return cp;
+    }
+
+    static void AppendUtf8(uint32_t cp, std::string &out) {
+        if (cp < 0x80) {
+            out.append(1, (char) cp);
+        } else if (cp < 0x800) {
+            out.append(1, (char) (0xC0 | (cp >> 6)));
+            out.append(1, (char) (0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.append(1, (char) (0xE0 | (cp >> 12)));
+            out.append(1, (char) (0x80 | ((cp >> 6) & 0x3F)));
+            out.append(1, (char) (0x80 | (cp & 0x3F)));
+        } else {
+            out.append(1, (char) (0xF0 | (cp >> 18)));
+            out.append(1, (char) (0x80 | ((cp >> 12) & 0x3F)));
+            out.append(1, (char) (0x80 | ((cp >> 6) & 0x3F)));
+            out.append(1, (char) (0x80 | (cp & 0x3F)));
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Parse gzip, zlib or raw deflate compressed html with html_parser.hpp.
+ * Needs zlib (link with -lz).
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_GZIP_HPP_
+#define HTMLPARSER_GZIP_HPP_
+
+#include "html_parser.hpp"
+
+#include <limits>
+#include <zlib.h>
+
+/**
+ * class HtmlInflater
+ * inflates compressed input in bounded chunks straight into an incremental
+ * HtmlParser, so neither the whole inflated document nor a second copy of
+ * it is ever held in memory.
+ */
+class HtmlInflater {
+public:
+    /**
+     * @param parser receives the inflated bytes through Feed
+     * @param chunk size of the inflate output buffer
+     */
+    explicit HtmlInflater(HtmlParser &parser, size_t chunk = 64 * 1024)
+            : parser_(parser), out_(chunk ? chunk : 1), started_(false), ended_(false), failed_(false) {
+        memset(&stream_, 0, sizeof(stream_));
+    }
+
+    ~HtmlInflater() {
+        if (started_) inflateEnd(&stream_);
+    }
+
+    /**
+     * inflates the next piece of compressed input, gzip and zlib headers
+     * are detected from the first bytes, anything else is read as raw deflate.
+     * concatenated gzip members are inflated one after another.
+     * @return false once the input turned out to be corrupt
+     */
+    bool Write(const char *data, size_t len) {
+        if (failed_) return false;
+
+        if (!started_) {
+            // the format is decided on the first two bytes
+            size_t take = std::min(len, 2 - head_.size());
+            head_.append(data, take);
+            data += take;
+            len -= take;
+            if (head_.size() < 2) return true;
+
+            Start();
+            if (failed_) return false;
+        }
+
+        // avail_in is a uInt, longer input goes in slices
+        while (len > 0) {
+            size_t take = std::min(len, (size_t) std::numeric_limits<uInt>::max());
+            stream_.next_in = (Bytef *) data;
+            stream_.avail_in = (uInt) take;
+            if (!Inflate()) return false;
+            // what follows the end of a zlib or raw deflate stream is ignored
+            if (stream_.avail_in > 0) break;
+
+            data += take;
+            len -= take;
+        }
+
+        return true;
+    }
+
+    /**
+     * @return false when the compressed stream was corrupt or truncated
+     */
+    bool Close() {
+        if (!started_ && !head_.empty()) {
+            // shorter than any header, nothing valid can be in there
+            failed_ = true;
+        }
+
+        if (started_ && !ended_ && !failed_) {
+            std::cerr << "WARN : compressed html truncated" << std::endl;
+            failed_ = true;
+        }
+
+        return !failed_;
+    }
+
+private:
+    void Start() {
+        unsigned char b0 = (unsigned char) head_[0];
+        unsigned char b1 = (unsigned char) head_[1];
+        int bits = -MAX_WBITS;
+        if (b0 == 0x1f && b1 == 0x8b) {
+            bits = MAX_WBITS + 16;
+        } else if ((b0 & 0x0f) == Z_DEFLATED && ((b0 << 8) | b1) % 31 == 0) {
+            bits = MAX_WBITS;
+        }
+
+        if (inflateInit2(&stream_, bits) != Z_OK) {
+            std::cerr << "WARN : inflate init failed" << std::endl;
+            failed_ = true;
+            return;
+        }
+
+        started_ = true;
+        gzip_ = bits > MAX_WBITS;
+
+        // run the buffered header bytes through first
+        stream_.next_in = (Bytef *) head_.data();
+        stream_.avail_in = (uInt) head_.size();
+        Inflate();
+    }
+
+    bool Inflate() {
+        while (stream_.avail_in > 0 && !failed_) {
+            if (ended_) {
+                // another gzip member follows, anything else is trailing garbage
+                if (!gzip_) break;
+                inflateReset(&stream_);
+                ended_ = false;
+            }
+
+            stream_.next_out = (Bytef *) &out_[0];
+            stream_.avail_out = (uInt) out_.size();
+            int ret = inflate(&stream_, Z_NO_FLUSH);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                std::cerr << "WARN : inflate failed " << (stream_.msg ? stream_.msg : "") << std::endl;
+                failed_ = true;
+            }
+
+            size_t n = out_.size() - stream_.avail_out;
+            if (n) parser_.Feed(&out_[0], n);
+            if (ret == Z_STREAM_END) ended_ = true;
+        }
+
+        return !failed_;
+    }
+
+private:
+    HtmlParser &parser_;
+    std::vector<char> out_;
+    std::string head_;
+    z_stream stream_;
+    bool started_;
+    bool ended_;
+    bool failed_;
+    bool gzip_;
+};
+
+/**
+ * parse compressed html held in memory.
+ * @return html document object, a corrupt stream gives the part parsed so far
+ */
+inline shared_ptr<HtmlDocument> ParseCompressed(HtmlParser &parser, const char *data, size_t len) {
+    HtmlInflater inflater(parser);
+    inflater.Write(data, len);
+    inflater.Close();
+    return parser.Finish();
+}
+
+/**
+ * parse a compressed html file, read and inflated in bounded chunks.
+ * @return html document object, null if the file can not be opened
+ */
+inline shared_ptr<HtmlDocument> ParseCompressedFile(HtmlParser &parser, const std::string &path) {
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return shared_ptr<HtmlDocument>();
+
+    HtmlInflater inflater(parser);
+    std::vector<char> in(64 * 1024);
+    size_t n;
+    while ((n = fread(&in[0], 1, in.size(), fp)) > 0 && inflater.Write(&in[0], n)) {}
+    fclose(fp);
+
+    inflater.Close();
+    return parser.Finish();
+}
+
+#endif
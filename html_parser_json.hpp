@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * JSON export of documents, elements and select results for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_JSON_HPP_
+#define HTMLPARSER_JSON_HPP_
+
+#include "html_parser.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * what HtmlJsonWriter writes of an element besides its name
+ */
+enum HtmlJsonField {
+    HTML_JSON_ATTRIBUTES = 1,   // "attributes": {"name": "value", ...}
+    HTML_JSON_TEXT = 2,         // text nodes as strings among the children, "value" of script and style
+    HTML_JSON_CHILDREN = 4,     // "children": [...]
+    HTML_JSON_POSITIONS = 8,    // "position" of elements parsed with HtmlParser::SetSourceSpans
+    HTML_JSON_PLAIN_TEXT = 16,  // "text": what text() returns
+    HTML_JSON_DEFAULT = HTML_JSON_ATTRIBUTES | HTML_JSON_TEXT | HTML_JSON_CHILDREN
+};
+
+/**
+ * class HtmlJsonWriter
+ * writes elements as json straight from the tree to an output sink, in
+ * pieces of about the buffer size. an element is an object:
+ *
+ *     {"name":"a","attributes":{"href":"/"},"children":["home"]}
+ *
+ * a text node is a string. a document is the array of its top-level
+ * elements, a select result the array of the elements found. text and
+ * attribute values are written decoded, strings are taken to be utf-8
+ * (see html_parser_charset.hpp for other input).
+ */
+class HtmlJsonWriter {
+public:
+    typedef std::function<void(const char *, size_t)> Sink;
+
+    explicit HtmlJsonWriter(const Sink &sink, unsigned fields = HTML_JSON_DEFAULT, size_t buffer = 64 * 1024)
+            : sink_(sink), fields_(fields), buffer_(buffer) {}
+
+    ~HtmlJsonWriter() {
+        Flush();
+    }
+
+    void Write(const shared_ptr<HtmlDocument> &doc) {
+        Writer writer(*this);
+        out_.push_back('[');
+        writer.first.push_back(true);
+        doc->GetRoot()->Walk(writer);
+        out_.push_back(']');
+    }
+
+    void Write(const shared_ptr<HtmlElement> &e) {
+        Writer writer(*this);
+        e->Walk(writer, true);
+    }
+
+    void Write(const std::vector<shared_ptr<HtmlElement> > &elements) {
+        out_.push_back('[');
+        for (size_t i = 0; i < elements.size(); i++) {
+            if (i) out_.push_back(',');
+            Write(elements[i]);
+        }
+        out_.push_back(']');
+    }
+
+    /**
+     * passes what is buffered to the sink, also done on destruction.
+     */
+    void Flush() {
+        if (!out_.empty()) {
+            sink_(out_.data(), out_.size());
+            out_.clear();
+        }
+    }
+
+    /**
+     * @param v a document, an element or select result
+     */
+    template<typename T>
+    static std::string ToJson(const T &v, unsigned fields = HTML_JSON_DEFAULT) {
+        std::string json;
+        HtmlJsonWriter writer([&json](const char *data, size_t len) { json.append(data, len); }, fields);
+        writer.Write(v);
+        writer.Flush();
+        return json;
+    }
+
+    /**
+     * appends data escaped as the content of a json string. runs without
+     * a quote, backslash or control character are found 16 bytes a step.
+     */
+    static void Escape(const char *data, size_t len, std::string &out) {
+        static const char hex[] = "0123456789abcdef";
+        const char *end = data + len;
+        while (data < end) {
+            const char *run = data;
+            data = Plain(data, end);
+            out.append(run, data - run);
+            if (data == end) break;
+
+            unsigned char c = (unsigned char) *data++;
+            switch (c) {
+                case '"': out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\n': out.append("\\n"); break;
+                case '\r': out.append("\\r"); break;
+                case '\t': out.append("\\t"); break;
+                case '\b': out.append("\\b"); break;
+                case '\f': out.append("\\f"); break;
+                default: {
+                    char u[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 15]};
+                    out.append(u, 6);
+                }
+            }
+        }
+    }
+
+private:
+    static bool Special(char c) {
+        return c == '"' || c == '\\' || (unsigned char) c < 0x20;
+    }
+
+    /**
+     * @return the first byte from p that has to be escaped, or end
+     */
+    static const char *Plain(const char *p, const char *end) {
+#if defined(__SSE2__)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1F);
+        for (; end - p >= 16; p += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *) p);
+            __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                       _mm_cmpeq_epi8(_mm_min_epu8(v, control), v));
+            if (_mm_movemask_epi8(hit)) break;
+        }
+#else
+        const uint64_t ones = 0x0101010101010101ULL;
+        const uint64_t high = 0x8080808080808080ULL;
+        for (; end - p >= 8; p += 8) {
+            uint64_t word;
+            memcpy(&word, p, 8);
+            uint64_t q = word ^ (ones * '"');
+            uint64_t b = word ^ (ones * '\\');
+            if ((((q - ones) & ~q) | ((b - ones) & ~b) | ((word - ones * 0x20) & ~word)) & high) break;
+        }
+#endif
+        while (p < end && !Special(*p)) p++;
+        return p;
+    }
+
+    void String(const std::string &str) {
+        out_.push_back('"');
+        Escape(str.data(), str.size(), out_);
+        out_.push_back('"');
+    }
+
+    void Number(size_t n) {
+        char digits[24];
+        char *p = digits + sizeof(digits);
+        do {
+            *--p = (char) ('0' + n % 10);
+            n /= 10;
+        } while (n);
+        out_.append(p, digits + sizeof(digits) - p);
+    }
+
+    /**
+     * writes the elements it walks, an element with children is closed
+     * when it is left.
+     */
+    struct Writer : HtmlVisitor {
+        explicit Writer(HtmlJsonWriter &w)
+                : writer(w) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            std::string &out = writer.out_;
+            unsigned fields = writer.fields_;
+            bool plain = e->name == "plain";
+            if (!first.empty()) {
+                if (plain && !(fields & HTML_JSON_TEXT)) {
+                    open.push_back(false);
+                    return HTML_WALK_SKIP;
+                }
+
+                if (!first.back()) out.push_back(',');
+                first.back() = false;
+            }
+
+            if (plain) {
+                writer.String(e->Value());
+                open.push_back(false);
+                return HTML_WALK_SKIP;
+            }
+
+            writer.Element(e.get());
+            bool children = fields & HTML_JSON_CHILDREN;
+            if (children) {
+                out.append(",\"children\":[");
+                first.push_back(true);
+            } else {
+                out.push_back('}');
+            }
+
+            open.push_back(children);
+            return children ? HTML_WALK_CONTINUE : HTML_WALK_SKIP;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &) {
+            if (open.back()) {
+                writer.out_.append("]}");
+                first.pop_back();
+            }
+
+            open.pop_back();
+            if (writer.out_.size() >= writer.buffer_) writer.Flush();
+        }
+
+        HtmlJsonWriter &writer;
+        std::vector<bool> first;    // of the children arrays open, nothing written to it yet
+        std::vector<bool> open;     // of the elements entered, a children array was opened
+    };
+
+    /**
+     * the name and the fields of an element up to its children.
+     */
+    void Element(HtmlElement *e) {
+        out_.append("{\"name\":");
+        String(e->name);
+
+        if (fields_ & HTML_JSON_ATTRIBUTES) {
+            out_.append(",\"attributes\":{");
+            const std::map<std::string, std::string> &attribute = e->Attributes();
+            std::map<std::string, std::string>::const_iterator it = attribute.begin();
+            for (; it != attribute.end(); ++it) {
+                if (it != attribute.begin()) out_.push_back(',');
+                String(it->first);
+                out_.push_back(':');
+                String(it->second);
+            }
+            out_.push_back('}');
+        }
+
+        if ((fields_ & HTML_JSON_TEXT) && !e->Value().empty()) {
+            out_.append(",\"value\":");
+            String(e->Value());
+        }
+
+        if ((fields_ & HTML_JSON_POSITIONS) && e->span) {
+            out_.append(",\"position\":{\"begin\":");
+            Number(e->span->outer_begin);
+            out_.append(",\"end\":");
+            Number(e->span->outer_end);
+            out_.append(",\"line\":");
+            Number(e->span->line);
+            out_.append(",\"column\":");
+            Number(e->span->column);
+            out_.push_back('}');
+        }
+
+        if (fields_ & HTML_JSON_PLAIN_TEXT) {
+            out_.append(",\"text\":");
+            String(e->text());
+        }
+    }
+
+    Sink sink_;
+    unsigned fields_;
+    size_t buffer_;
+    std::string out_;
+};
+
+#endif
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Opt-in parallel query evaluation for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_PARALLEL_HPP_
+#define HTMLPARSER_PARALLEL_HPP_
+
+#include "html_parser.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+/**
+ * class HtmlWorkStealingPool
+ * fixed size thread pool, every worker owns a task deque and steals
+ * from the back of the others once its own deque runs dry.
+ */
+class HtmlWorkStealingPool {
+public:
+    /**
+     * @param threads worker count including the calling thread, 0 means hardware concurrency
+     */
+    explicit HtmlWorkStealingPool(size_t threads = 0)
+            : queues_(threads ? threads : DefaultThreads()), task_(NULL), pending_(0),
+              generation_(0), active_(0), stop_(false) {
+        for (size_t i = 1; i < queues_.size(); i++) {
+            workers_.push_back(std::thread(&HtmlWorkStealingPool::Worker, this, i));
+        }
+    }
+
+    ~HtmlWorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        wake_.notify_all();
+        for (size_t i = 0; i < workers_.size(); i++) {
+            workers_[i].join();
+        }
+    }
+
+    size_t Size() const {
+        return queues_.size();
+    }
+
+    /**
+     * run task(0) .. task(count - 1), blocks until all of them finished.
+     * the calling thread works on the first deque. tasks must not throw.
+     */
+    void Run(size_t count, const std::function<void(size_t)> &task) {
+        if (count == 0) return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            pending_ = count;
+        }
+
+        // contiguous blocks keep neighbouring subtrees on one worker
+        size_t n = queues_.size();
+        for (size_t i = 0; i < n; i++) {
+            std::lock_guard<std::mutex> lock(queues_[i].mutex);
+            for (size_t t = count * i / n; t < count * (i + 1) / n; t++) {
+                queues_[i].tasks.push_back(t);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            generation_++;
+        }
+
+        wake_.notify_all();
+        Drain(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0 && active_ == 0; });
+        task_ = NULL;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    static size_t DefaultThreads() {
+        size_t n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+
+    void Worker(size_t id) {
+        size_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+                active_++;
+            }
+
+            Drain(id);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                active_--;
+            }
+            done_.notify_all();
+        }
+    }
+
+    void Drain(size_t id) {
+        size_t index;
+        while (Pop(id, index) || Steal(id, index)) {
+            (*task_)(index);
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.notify_all();
+            }
+        }
+    }
+
+    bool Pop(size_t id, size_t &index) {
+        std::lock_guard<std::mutex> lock(queues_[id].mutex);
+        if (queues_[id].tasks.empty()) return false;
+        index = queues_[id].tasks.front();
+        queues_[id].tasks.pop_front();
+        return true;
+    }
+
+    bool Steal(size_t id, size_t &index) {
+        for (size_t i = 1; i < queues_.size(); i++) {
+            Queue &victim = queues_[(id + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                index = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    std::vector<Queue> queues_;
+    std::vector<std::thread> workers_;
+    const std::function<void(size_t)> *task_;
+    std::atomic<size_t> pending_;
+    size_t generation_;
+    size_t active_;
+    bool stop_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+};
+
+/**
+ * class HtmlParallelQuery
+ * splits a document into balanced subtree tasks once and evaluates
+ * queries on a work stealing pool. results are merged back into the
+ * same order the serial HtmlDocument queries return.
+ * documents smaller than the serial threshold are queried serially.
+ */
+class HtmlParallelQuery {
+public:
+    /**
+     * @param doc parsed document, must not be modified while queried
+     * @param threads worker count, 0 means hardware concurrency
+     * @param serial_threshold element count below which queries stay serial
+     */
+    HtmlParallelQuery(shared_ptr<HtmlDocument> doc, size_t threads = 0, size_t serial_threshold = 16384)
+            : doc_(doc), pool_(threads), size_(Count(doc->GetRoot()) - 1), serial_threshold_(serial_threshold),
+              grain_(0), spine_(false) {
+        if (!Serial()) {
+            // a few tasks per worker leaves room for stealing
+            grain_ = size_ / (pool_.Size() * 8) + 1;
+            Partitioner partitioner(tasks_, grain_);
+            doc->GetRoot()->Walk(partitioner, true);
+            for (size_t i = 0; i < tasks_.size(); i++) {
+                if (!tasks_[i].subtree) spine_ = true;
+            }
+        }
+    }
+
+    /**
+     * element count of the document, root excluded.
+     */
+    size_t Size() const {
+        return size_;
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByClassName(const std::string &name) {
+        if (Serial()) return doc_->GetElementByClassName(name);
+
+        std::set<std::string> class_name = HtmlElement::SplitClassName(name);
+        return Evaluate([&class_name](const shared_ptr<HtmlElement> &e, size_t depth,
+                                      std::vector<shared_ptr<HtmlElement> > &result, HtmlElement::SelectState &) {
+            if (depth >= 1 && e->MatchClassName(class_name)) result.push_back(e);
+        }, false);
+    }
+
+    std::vector<shared_ptr<HtmlElement> > GetElementByTagName(const std::string &name) {
+        if (Serial()) return doc_->GetElementByTagName(name);
+
+        return Evaluate([&name](const shared_ptr<HtmlElement> &e, size_t depth,
+                                std::vector<shared_ptr<HtmlElement> > &result, HtmlElement::SelectState &) {
+            if (depth >= 1 && e->name == name) result.push_back(e);
+        }, false);
+    }
+
+    /**
+     * only "//..." rules walk the whole tree, others run serially.
+     */
+    std::vector<shared_ptr<HtmlElement> > SelectElement(const std::string &rule) {
+        if (Serial() || rule.size() < 2 || rule.compare(0, 2, "//") != 0) return doc_->SelectElement(rule);
+
+        // the serial walk starts "//" below every top-level element
+        std::string next = rule.substr(1);
+        return Evaluate([&next](const shared_ptr<HtmlElement> &e, size_t depth,
+                                std::vector<shared_ptr<HtmlElement> > &result, HtmlElement::SelectState &state) {
+            if (depth >= 2) e->SelectElement(next, result, state);
+        }, true);
+    }
+
+private:
+    struct Task {
+        Task(const shared_ptr<HtmlElement> &e, size_t d, bool s)
+                : element(e), depth(d), subtree(s) {}
+
+        shared_ptr<HtmlElement> element;
+        size_t depth;
+        bool subtree;
+    };
+
+    /**
+     * called for every element with its depth below the root. the state is
+     * shared by the elements of one task, so a "//" step inside the rule
+     * walks every subtree once per task like it does serially.
+     */
+    typedef std::function<void(const shared_ptr<HtmlElement> &, size_t, std::vector<shared_ptr<HtmlElement> > &,
+                               HtmlElement::SelectState &)> Visitor;
+
+    bool Serial() const {
+        return size_ < serial_threshold_ || pool_.Size() < 2;
+    }
+
+    struct Counter : HtmlVisitor {
+        Counter()
+                : n(0) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &) {
+            n++;
+            return HTML_WALK_CONTINUE;
+        }
+
+        size_t n;
+    };
+
+    static size_t Count(const shared_ptr<HtmlElement> &e) {
+        Counter counter;
+        e->Walk(counter, true);
+        return counter.n;
+    }
+
+    /**
+     * emits tasks in document order: a node whose subtree exceeds the
+     * grain becomes a single node task followed by its children's tasks.
+     */
+    struct Partitioner : HtmlVisitor {
+        Partitioner(std::vector<Task> &t, size_t g)
+                : tasks(t), grain(g) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            open.push_back(std::make_pair(tasks.size(), size_t(1)));
+            tasks.push_back(Task(e, open.size() - 1, false));
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &e) {
+            size_t mark = open.back().first;
+            size_t n = open.back().second;
+            open.pop_back();
+            if (n <= grain) {
+                tasks.erase(tasks.begin() + mark, tasks.end());
+                tasks.push_back(Task(e, open.size(), true));
+            }
+
+            if (!open.empty()) open.back().second += n;
+        }
+
+        std::vector<Task> &tasks;
+        size_t grain;
+        std::vector<std::pair<size_t, size_t> > open;   // first task and size of the elements entered
+    };
+
+    /**
+     * visits a subtree task in document order.
+     */
+    struct TaskVisitor : HtmlVisitor {
+        TaskVisitor(const Visitor &v, size_t d, std::vector<shared_ptr<HtmlElement> > &r,
+                    HtmlElement::SelectState &s)
+                : visit(v), depth(d), result(r), state(s) {}
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            visit(e, depth++, result, state);
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &) {
+            depth--;
+        }
+
+        const Visitor &visit;
+        size_t depth;
+        std::vector<shared_ptr<HtmlElement> > &result;
+        HtmlElement::SelectState &state;
+    };
+
+    /**
+     * the node tasks are the ancestors of the subtree tasks. they run in
+     * order as one more task sharing a state, so a "//" step from one of
+     * them does not walk a subtree again that another one walked already.
+     */
+    std::vector<shared_ptr<HtmlElement> > Evaluate(const Visitor &visit, bool unique) {
+        std::vector<std::vector<shared_ptr<HtmlElement> > > partial(tasks_.size());
+        size_t spine = spine_ ? 1 : 0;
+        pool_.Run(tasks_.size() + spine, [this, &visit, &partial, spine](size_t i) {
+            HtmlElement::SelectState state;
+            if (i < spine) {
+                for (size_t t = 0; t < tasks_.size(); t++) {
+                    if (!tasks_[t].subtree) visit(tasks_[t].element, tasks_[t].depth, partial[t], state);
+                }
+                return;
+            }
+
+            const Task &task = tasks_[i - spine];
+            if (task.subtree) {
+                TaskVisitor visitor(visit, task.depth, partial[i - spine], state);
+                task.element->Walk(visitor, true);
+            }
+        });
+
+        std::vector<shared_ptr<HtmlElement> > result;
+        std::unordered_set<HtmlElement *> seen;
+        for (size_t i = 0; i < partial.size(); i++) {
+            for (size_t j = 0; j < partial[i].size(); j++) {
+                if (!unique || seen.insert(partial[i][j].get()).second) {
+                    result.push_back(partial[i][j]);
+                }
+            }
+        }
+
+        return result;
+    }
+
+private:
+    shared_ptr<HtmlDocument> doc_;
+    HtmlWorkStealingPool pool_;
+    size_t size_;
+    size_t serial_threshold_;
+    size_t grain_;
+    bool spine_;        // some tasks are single nodes
+    std::vector<Task> tasks_;
+};
+
+#endif
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Streaming html rewriter for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_REWRITER_HPP_
+#define HTMLPARSER_REWRITER_HPP_
+
+#include "html_parser.hpp"
+
+#include <cctype>
+#include <unordered_map>
+
+/**
+ * class HtmlRewriteElement
+ * a start tag matched by an HtmlRewriter handler, with the changes the
+ * handler asked for. html passed to the insertion methods is written as is.
+ */
+class HtmlRewriteElement {
+public:
+    friend class HtmlRewriter;
+
+    const std::string &GetName() const {
+        return name_;
+    }
+
+    bool HasAttribute(const std::string &k) const {
+        return attribute_.count(k) != 0;
+    }
+
+    std::string GetAttribute(const std::string &k) const {
+        std::map<std::string, std::string>::const_iterator it = attribute_.find(k);
+        return it == attribute_.end() ? std::string() : it->second;
+    }
+
+    /**
+     * a changed start tag is written again from its attributes, in name order.
+     */
+    void SetAttribute(const std::string &k, const std::string &v) {
+        attribute_[k] = v;
+        modified_ = true;
+    }
+
+    void RemoveAttribute(const std::string &k) {
+        if (attribute_.erase(k)) modified_ = true;
+    }
+
+    /**
+     * drops the element with its content, what was inserted before and after it is kept.
+     */
+    void Remove() {
+        removed_ = true;
+    }
+
+    bool IsRemoved() const {
+        return removed_;
+    }
+
+    void Before(const std::string &html) {
+        before_.append(html);
+    }
+
+    void After(const std::string &html) {
+        after_.insert(0, html);
+    }
+
+    /**
+     * inserts at the start of the content, right after the start tag of
+     * an element without content.
+     */
+    void Prepend(const std::string &html) {
+        prepend_.insert(0, html);
+    }
+
+    /**
+     * inserts at the end of the content, see Prepend.
+     */
+    void Append(const std::string &html) {
+        append_.append(html);
+    }
+
+private:
+    HtmlRewriteElement()
+            : modified_(false), removed_(false) {}
+
+private:
+    std::string name_;
+    std::map<std::string, std::string> attribute_;
+    bool modified_;
+    bool removed_;
+    std::string before_;
+    std::string after_;
+    std::string prepend_;
+    std::string append_;
+};
+
+/**
+ * class HtmlRewriter
+ * rewrites html while it streams from Write to the output sink. text,
+ * comments and tags no handler matched are passed through unchanged and
+ * at once. only an unfinished tag and the open elements are held, so
+ * memory grows with the nesting depth, not with the size of the page.
+ * elements end the way HtmlParser ends them: by their close tag, by the
+ * close tag of an ancestor, or by the end of the input.
+ */
+class HtmlRewriter {
+public:
+    typedef std::function<void(const char *, size_t)> Sink;
+    typedef std::function<void(HtmlRewriteElement &)> Handler;
+
+    explicit HtmlRewriter(const Sink &sink)
+            : sink_(sink), state_(REWRITE_TEXT), scanned_(0), removed_(0) {}
+
+    /**
+     * handler is called for every start tag that matches selector, one
+     * select step such as "a[@href]" or "script[@src='x.js']". handlers
+     * run in the order they were added, the first Remove ends the run.
+     */
+    void On(const std::string &selector, const Handler &handler) {
+        std::string rule = (!selector.empty() && selector[0] == '/') ? selector : "/" + selector;
+        handlers_.push_back(std::make_pair(HtmlSelectStep(rule, rule.size()), handler));
+    }
+
+    void Write(const char *data, size_t len) {
+        if (pending_.empty()) {
+            size_t used = Run(data, len, false);
+            pending_.assign(data + used, len - used);
+        } else {
+            pending_.append(data, len);
+            pending_.erase(0, Run(pending_.data(), pending_.size(), false));
+        }
+    }
+
+    void Write(const std::string &data) {
+        Write(data.data(), data.size());
+    }
+
+    /**
+     * the input ended, elements still open end here.
+     */
+    void End() {
+        Run(pending_.data(), pending_.size(), true);
+        pending_.clear();
+        while (!stack_.empty()) Close(NULL, 0);
+        state_ = REWRITE_TEXT;
+    }
+
+private:
+    enum RewriteState {
+        REWRITE_TEXT,
+        REWRITE_COMMENT,
+        REWRITE_RAW_TEXT
+    };
+
+    struct Open {
+        std::string name;
+        bool removed;
+        std::string append;
+        std::string after;
+    };
+
+    /**
+     * rewrites as much of data as can be decided.
+     * @return bytes used, the rest has to wait for more data
+     */
+    size_t Run(const char *data, size_t len, bool final) {
+        size_t scanned = scanned_;
+        scanned_ = 0;
+        size_t i = 0;
+        while (i < len) {
+            if (state_ == REWRITE_COMMENT) {
+                const char *end = Find(data + i, len - i, "-->", 3);
+                if (!end) {
+                    // keep what may be the start of "-->"
+                    size_t n = final ? len - i : (len - i > 2 ? len - i - 2 : 0);
+                    Emit(data + i, n);
+                    return i + n;
+                }
+
+                Emit(data + i, end + 3 - (data + i));
+                i = end + 3 - data;
+                state_ = REWRITE_TEXT;
+                continue;
+            }
+
+            if (state_ == REWRITE_RAW_TEXT) {
+                const std::string &close = raw_close_;
+                const char *end = Find(data + i, len - i, close.data(), close.size());
+                if (!end) {
+                    size_t n = final ? len - i : (len - i >= close.size() ? len - i - close.size() + 1 : 0);
+                    Emit(data + i, n);
+                    return i + n;
+                }
+
+                Emit(data + i, end - (data + i));
+                i = end + close.size() - data;
+                state_ = REWRITE_TEXT;
+                Close(end, close.size());
+                continue;
+            }
+
+            const char *lt = (const char *) memchr(data + i, '<', len - i);
+            size_t text = (lt ? lt - data : len) - i;
+            Emit(data + i, text);
+            i += text;
+            if (i == len) break;
+
+            if (i + 1 == len && !final) return i;
+
+            char next = i + 1 < len ? data[i + 1] : '\0';
+            if (next == '!' && len - i < 4 && !final) return i;
+
+            if (next == '!' && len - i >= 4 && memcmp(data + i, "<!--", 4) == 0) {
+                Emit(data + i, 4);
+                i += 4;
+                state_ = REWRITE_COMMENT;
+                continue;
+            }
+
+            if (next != '!' && next != '?' && next != '/' && !isalpha((unsigned char) next)) {
+                // not markup, a plain '<'
+                Emit(data + i, 1);
+                i++;
+                continue;
+            }
+
+            // a tag left waiting is not searched again from its start
+            size_t from = i == 0 ? std::min(scanned, len) : i;
+            const char *gt = (const char *) memchr(data + from, '>', len - from);
+            if (!gt) {
+                if (!final) {
+                    scanned_ = len - i;
+                    return i;
+                }
+
+                Emit(data + i, len - i);
+                return len;
+            }
+
+            size_t size = gt + 1 - (data + i);
+            if (next == '/') {
+                EndTag(data + i, size);
+            } else if (next == '!' || next == '?') {
+                Emit(data + i, size);
+            } else {
+                StartTag(data + i, size);
+            }
+            i += size;
+        }
+
+        return i;
+    }
+
+    /**
+     * tag is "<name ...>", the whole start tag.
+     */
+    void StartTag(const char *tag, size_t size) {
+        const char *end = tag + size - 1;
+        bool closed = end[-1] == '/';
+        const char *p = tag + 1;
+        while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != '/') p++;
+
+        HtmlRewriteElement element;
+        element.name_.assign(tag + 1, p - tag - 1);
+        unsigned flags = HtmlTag::Lookup(element.name_);
+        bool content = !closed && !(flags & HTML_TAG_VOID);
+
+        bool parsed = false;
+        for (size_t i = 0; i < handlers_.size() && !element.removed_; i++) {
+            const HtmlSelectStep &step = handlers_[i].first;
+            if (!step.ele.empty() && step.ele != element.name_) continue;
+
+            if (!parsed) {
+                HtmlAttributeReader reader(limits_);
+                reader.Read(p, (closed ? end - 1 : end) - p, element.attribute_);
+                reader.End(element.attribute_);
+                parsed = true;
+            }
+
+            std::map<std::string, std::string>::const_iterator found = element.attribute_.find(step.attr);
+            bool matched = (found == element.attribute_.end())
+                           ? step.Match(element.name_.data(), element.name_.size(), NULL, 0, false)
+                           : step.Match(element.name_.data(), element.name_.size(), found->second.data(),
+                                        found->second.size(), true);
+            if (matched) handlers_[i].second(element);
+        }
+
+        Emit(element.before_);
+        if (element.removed_) {
+            removed_++;
+        } else if (element.modified_) {
+            std::string rewritten = "<" + element.name_;
+            std::map<std::string, std::string>::const_iterator it = element.attribute_.begin();
+            for (; it != element.attribute_.end(); ++it) {
+                rewritten.append(" " + it->first);
+                if (!it->second.empty()) rewritten.append("=" + Quote(it->second));
+            }
+            rewritten.append(closed ? "/>" : ">");
+            Emit(rewritten);
+        } else {
+            Emit(tag, size);
+        }
+
+        Emit(element.prepend_);
+        if (!content) {
+            Emit(element.append_);
+            if (element.removed_) removed_--;
+            Emit(element.after_);
+            return;
+        }
+
+        open_[element.name_]++;
+        stack_.push_back(Open());
+        Open &open = stack_.back();
+        open.name.swap(element.name_);
+        open.removed = element.removed_;
+        open.append.swap(element.append_);
+        open.after.swap(element.after_);
+        if (flags & HTML_TAG_RAW_TEXT) {
+            raw_close_ = "</" + open.name + ">";
+            state_ = REWRITE_RAW_TEXT;
+        }
+    }
+
+    /**
+     * tag is "</name>", it ends the innermost open element of that name
+     * and the ones open inside it. one that is not open is passed through.
+     * the name is taken as HtmlParser takes it, see HtmlTag::CloseName.
+     */
+    void EndTag(const char *tag, size_t size) {
+        HtmlTag::CloseName(tag + 2, tag + size, limits_.max_name_length, close_name_);
+        if (open_.find(close_name_) == open_.end()) {
+            Emit(tag, size);
+            return;
+        }
+
+        while (stack_.back().name != close_name_) Close(NULL, 0);
+        Close(tag, size);
+    }
+
+    /**
+     * ends the innermost open element, at its close tag when there is one.
+     */
+    void Close(const char *tag, size_t size) {
+        Open &open = stack_.back();
+        Emit(open.append);
+        if (tag) Emit(tag, size);
+
+        std::unordered_map<std::string, size_t>::iterator it = open_.find(open.name);
+        if (--it->second == 0) open_.erase(it);
+
+        std::string after;
+        after.swap(open.after);
+        if (open.removed) removed_--;
+        stack_.pop_back();
+        Emit(after);
+    }
+
+    static std::string Quote(const std::string &v) {
+        if (v.find('"') == std::string::npos) return "\"" + v + "\"";
+        if (v.find('\'') == std::string::npos) return "'" + v + "'";
+
+        std::string quoted("\"");
+        for (size_t i = 0; i < v.size(); i++) {
+            if (v[i] == '"') {
+                quoted.append("&quot;");
+            } else {
+                quoted.append(1, v[i]);
+            }
+        }
+
+        return quoted + "\"";
+    }
+
+    static const char *Find(const char *data, size_t len, const char *s, size_t n) {
+        const char *end = data + len;
+        while ((size_t) (end - data) >= n) {
+            const char *p = (const char *) memchr(data, s[0], end - data - n + 1);
+            if (!p) return NULL;
+            if (memcmp(p, s, n) == 0) return p;
+            data = p + 1;
+        }
+
+        return NULL;
+    }
+
+    /**
+     * writes to the sink unless inside a removed element.
+     */
+    void Emit(const char *data, size_t len) {
+        if (len && !removed_) sink_(data, len);
+    }
+
+    void Emit(const std::string &data) {
+        Emit(data.data(), data.size());
+    }
+
+private:
+    Sink sink_;
+    std::vector<std::pair<HtmlSelectStep, Handler> > handlers_;
+    HtmlParseLimits limits_;
+    RewriteState state_;
+    std::string raw_close_;
+    std::string pending_;       // input that could not be decided yet
+    size_t scanned_;            // bytes of pending_ known to hold no '>'
+    std::vector<Open> stack_;
+    std::unordered_map<std::string, size_t> open_;  // names of the elements in stack_, for close tags
+    std::string close_name_;
+    size_t removed_;            // open elements that are removed
+};
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Evaluate many select rules in one traversal for html_parser.hpp.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_SELECTOR_HPP_
+#define HTMLPARSER_SELECTOR_HPP_
+
+#include "html_parser.hpp"
+
+#include <unordered_map>
+
+/**
+ * class HtmlSelectorSet
+ * select rules compiled once into one automaton and evaluated together
+ * in a single walk of the tree. each element is tested only against the
+ * steps that can apply to it: the ones its parent passed on and the "//"
+ * steps waiting for its tag name. identical steps of different rules are
+ * tested once per element.
+ */
+class HtmlSelectorSet {
+public:
+    typedef std::vector<std::vector<shared_ptr<HtmlElement> > > Results;
+
+    HtmlSelectorSet()
+            : rules_(0) {}
+
+    /**
+     * @param rule same syntax as HtmlElement::SelectElement
+     * @return index of the rule's results in Select
+     */
+    size_t Add(const std::string &rule) {
+        int start = Compile(rule, 0, rules_);
+        if (start >= 0) starts_.push_back(start);
+        return rules_++;
+    }
+
+    size_t Size() const {
+        return rules_;
+    }
+
+    /**
+     * the elements HtmlDocument::SelectElement returns for each rule, in document order.
+     */
+    Results Select(const shared_ptr<HtmlDocument> &doc) const {
+        Walk walk(*this);
+        Visitor visitor(*this, walk);
+        doc->GetRoot()->Walk(visitor);
+        return walk.results;
+    }
+
+    /**
+     * the elements HtmlElement::SelectElement returns for each rule, in document order.
+     */
+    Results Select(const shared_ptr<HtmlElement> &element) const {
+        Walk walk(*this);
+        Visitor visitor(*this, walk);
+        element->Walk(visitor, true);
+        return walk.results;
+    }
+
+private:
+    /**
+     * a rule suffix: "//rest" hands rest to all descendants, "/step/rest"
+     * hands rest to the children when the element matches step.
+     */
+    struct State {
+        bool descendant;
+        size_t step;            // index in steps_
+        int next;               // -1 when the rule is complete
+        size_t rule;
+    };
+
+    /**
+     * scratch of one Select, so a set can be used by several threads.
+     */
+    struct Walk {
+        explicit Walk(const HtmlSelectorSet &set)
+                : results(set.rules_), active(set.states_.size(), 0), tested(set.steps_.size(), 0),
+                  matched(set.steps_.size(), 0), emitted(set.rules_, 0), node(0), in_force(0) {}
+
+        Results results;
+        std::vector<size_t> active;     // descendant states in force, by how many ancestors
+        std::vector<size_t> tested;     // node the step was last tested on
+        std::vector<char> matched;
+        std::vector<size_t> emitted;    // node last added to the rule's results
+        size_t node;
+        size_t in_force;                // sum of active
+    };
+
+    int Compile(const std::string &rule, size_t offset, size_t index) {
+        if (offset >= rule.size() || rule[offset] != '/') return -1;
+
+        State state;
+        state.rule = index;
+        state.step = 0;
+        if (offset + 1 < rule.size() && rule[offset + 1] == '/') {
+            state.descendant = true;
+            state.next = Compile(rule, offset + 1, index);
+        } else {
+            std::string::size_type p = rule.find('/', offset + 1);
+            std::string::size_type end = (p == std::string::npos) ? rule.size() : p;
+            state.descendant = false;
+            state.step = Step(rule.substr(offset, end - offset));
+            state.next = end < rule.size() ? Compile(rule, end, index) : -1;
+        }
+
+        states_.push_back(state);
+        int id = (int) states_.size() - 1;
+        if (state.descendant && state.next >= 0) {
+            // the state it hands down is looked up by tag name on every descendant
+            const State &target = states_[state.next];
+            if (target.descendant || steps_[target.step].ele.empty()) {
+                any_tag_.push_back(state.next);
+            } else {
+                by_tag_[steps_[target.step].ele].push_back(state.next);
+            }
+        }
+
+        return id;
+    }
+
+    size_t Step(const std::string &text) {
+        std::unordered_map<std::string, size_t>::const_iterator it = step_index_.find(text);
+        if (it != step_index_.end()) return it->second;
+
+        steps_.push_back(HtmlSelectStep(text, text.size()));
+        step_index_[text] = steps_.size() - 1;
+        return steps_.size() - 1;
+    }
+
+    bool Match(Walk &walk, size_t step, HtmlElement *e) const {
+        if (walk.tested[step] == walk.node) return walk.matched[step] != 0;
+
+        const HtmlSelectStep &s = steps_[step];
+        const std::map<std::string, std::string> &attribute = e->Attributes();
+        std::map<std::string, std::string>::const_iterator found = attribute.find(s.attr);
+        bool matched = (found == attribute.end())
+                       ? s.Match(e->name.data(), e->name.size(), NULL, 0, false)
+                       : s.Match(e->name.data(), e->name.size(), found->second.data(), found->second.size(), true);
+
+        walk.tested[step] = walk.node;
+        walk.matched[step] = matched;
+        return matched;
+    }
+
+    void Apply(Walk &walk, int id, const shared_ptr<HtmlElement> &e, std::vector<int> &children,
+               std::vector<int> &descendants) const {
+        const State &state = states_[id];
+        if (state.descendant) {
+            if (state.next >= 0) descendants.push_back(state.next);
+        } else if (Match(walk, state.step, e.get())) {
+            if (state.next >= 0) {
+                children.push_back(state.next);
+            } else if (walk.emitted[state.rule] != walk.node) {
+                walk.emitted[state.rule] = walk.node;
+                walk.results[state.rule].push_back(e);
+            }
+        }
+    }
+
+    /**
+     * evaluates the states given by the parent and the descendant states
+     * in force on every element it enters.
+     */
+    struct Visitor : HtmlVisitor {
+        Visitor(const HtmlSelectorSet &s, Walk &w)
+                : set(s), walk(w), depth(0) {}
+
+        /**
+         * the states an element hands to its children and the descendant
+         * states it puts in force below it
+         */
+        struct Level {
+            std::vector<int> children;
+            std::vector<int> descendants;
+        };
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            // levels are kept when left, so their vectors are reused
+            if (levels.size() <= depth) levels.resize(depth + 1);
+            const std::vector<int> &given = depth ? levels[depth - 1].children : set.starts_;
+            std::vector<int> &children = levels[depth].children;
+            std::vector<int> &descendants = levels[depth].descendants;
+            children.clear();
+            descendants.clear();
+            depth++;
+            if (e->name == "plain") return HTML_WALK_SKIP;
+
+            walk.node++;
+            for (size_t i = 0; i < given.size(); i++) {
+                set.Apply(walk, given[i], e, children, descendants);
+            }
+
+            std::unordered_map<std::string, std::vector<int> >::const_iterator tag = set.by_tag_.find(e->name);
+            if (tag != set.by_tag_.end()) {
+                for (size_t i = 0; i < tag->second.size(); i++) {
+                    if (walk.active[tag->second[i]]) set.Apply(walk, tag->second[i], e, children, descendants);
+                }
+            }
+
+            for (size_t i = 0; i < set.any_tag_.size(); i++) {
+                if (walk.active[set.any_tag_[i]]) set.Apply(walk, set.any_tag_[i], e, children, descendants);
+            }
+
+            std::sort(children.begin(), children.end());
+            children.erase(std::unique(children.begin(), children.end()), children.end());
+            // nothing can match below, the subtree is not walked (nor built when lazy)
+            if (children.empty() && descendants.empty() && walk.in_force == 0) return HTML_WALK_SKIP;
+
+            for (size_t i = 0; i < descendants.size(); i++) walk.active[descendants[i]]++;
+            walk.in_force += descendants.size();
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &) {
+            const std::vector<int> &descendants = levels[--depth].descendants;
+            walk.in_force -= descendants.size();
+            for (size_t i = 0; i < descendants.size(); i++) walk.active[descendants[i]]--;
+        }
+
+        const HtmlSelectorSet &set;
+        Walk &walk;
+        std::vector<Level> levels;      // of the elements entered
+        size_t depth;
+    };
+
+private:
+    size_t rules_;
+    std::vector<int> starts_;
+    std::vector<State> states_;
+    std::vector<HtmlSelectStep> steps_;
+    std::unordered_map<std::string, size_t> step_index_;
+    std::unordered_map<std::string, std::vector<int> > by_tag_;     // descendant targets by tag name
+    std::vector<int> any_tag_;      // descendant targets that apply to any tag
+};
+
+#endif
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2017 SPLI (rangerlee@foxmail.com)
+ * Latest version available at: http://github.com/rangerlee/htmlparser.git
+ *
+ * Binary snapshot of a parsed document for html_parser.hpp, written once
+ * and queried again through mmap without parsing.
+ * More information can get from README.md
+ *
+ */
+
+#ifndef HTMLPARSER_SNAPSHOT_HPP_
+#define HTMLPARSER_SNAPSHOT_HPP_
+
+#include "html_parser.hpp"
+
+#include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+class HtmlSnapshot;
+
+/**
+ * class HtmlSnapshotNode
+ * handle of one element inside a snapshot, valid while the snapshot lives
+ */
+class HtmlSnapshotNode {
+public:
+    HtmlSnapshotNode()
+            : snapshot_(NULL), index_(0) {}
+
+    HtmlSnapshotNode(const HtmlSnapshot *snapshot, uint32_t index)
+            : snapshot_(snapshot), index_(index) {}
+
+    bool Valid() const {
+        return snapshot_ != NULL;
+    }
+
+    uint32_t Index() const {
+        return index_;
+    }
+
+    bool operator==(const HtmlSnapshotNode &other) const {
+        return snapshot_ == other.snapshot_ && index_ == other.index_;
+    }
+
+    inline std::string GetName() const;
+
+    inline std::string GetValue() const;
+
+    inline std::string GetAttribute(const std::string &k) const;
+
+    inline std::string text() const;
+
+    inline size_t ChildCount() const;
+
+    inline HtmlSnapshotNode Child(size_t i) const;
+
+    inline HtmlSnapshotNode GetParent() const;
+
+private:
+    const HtmlSnapshot *snapshot_;
+    uint32_t index_;
+};
+
+/**
+ * class HtmlSnapshot
+ * flat, relocatable image of a document:
+ *
+ *     header | node table | child table | attribute table | string pool
+ *
+ * nodes are stored in document order with the unnamed root first, so a
+ * subtree is the index range [node, node.end). every string is an offset
+ * and a length into the pool, equal strings are stored once. all integers
+ * are native endian uint32.
+ */
+class HtmlSnapshot {
+public:
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t endian;
+        uint32_t node_count;
+        uint32_t child_count;
+        uint32_t attr_count;
+        uint32_t pool_size;
+    };
+
+    struct Node {
+        uint32_t name, name_len;
+        uint32_t value, value_len;
+        uint32_t parent;
+        uint32_t end;           // one past the last node of the subtree
+        uint32_t child, child_count;
+        uint32_t attr, attr_count;
+        uint32_t flags;
+    };
+
+    struct Attribute {
+        uint32_t key, key_len;
+        uint32_t value, value_len;
+    };
+
+    ~HtmlSnapshot() {
+#if !defined(_WIN32)
+        if (mapped_) munmap((void *) data_, size_);
+#endif
+    }
+
+    /**
+     * serialize a parsed document into a snapshot image.
+     * @return empty if the image would be 4 GiB or more, its offsets are 32 bit
+     */
+    static std::string Serialize(const shared_ptr<HtmlDocument> &doc) {
+        Writer writer;
+        doc->GetRoot()->Walk(writer, true);
+
+        uint64_t size = sizeof(Header) + (uint64_t) writer.nodes.size() * sizeof(Node) +
+                        (uint64_t) writer.children.size() * sizeof(uint32_t) +
+                        (uint64_t) writer.attrs.size() * sizeof(Attribute) + writer.pool.size();
+        if (size > UINT32_MAX) return std::string();
+
+        Header header;
+        memcpy(header.magic, "HTMLSNAP", 8);
+        header.version = 1;
+        header.endian = 0x01020304;
+        header.node_count = (uint32_t) writer.nodes.size();
+        header.child_count = (uint32_t) writer.children.size();
+        header.attr_count = (uint32_t) writer.attrs.size();
+        header.pool_size = (uint32_t) writer.pool.size();
+
+        std::string image((const char *) &header, sizeof(header));
+        image.append((const char *) writer.nodes.data(), writer.nodes.size() * sizeof(Node));
+        image.append((const char *) writer.children.data(), writer.children.size() * sizeof(uint32_t));
+        image.append((const char *) writer.attrs.data(), writer.attrs.size() * sizeof(Attribute));
+        image.append(writer.pool);
+        return image;
+    }
+
+    /**
+     * write a snapshot of doc to a file.
+     */
+    static bool Save(const shared_ptr<HtmlDocument> &doc, const std::string &path) {
+        std::string image = Serialize(doc);
+        if (image.empty()) return false;
+
+        FILE *fp = fopen(path.c_str(), "wb");
+        if (!fp) return false;
+
+        bool ok = fwrite(image.data(), 1, image.size(), fp) == image.size();
+        return fclose(fp) == 0 && ok;
+    }
+
+    /**
+     * use an image in memory without copying it, data must stay valid and
+     * be 4 byte aligned.
+     * @return null if the image is malformed
+     */
+    static shared_ptr<HtmlSnapshot> Load(const char *data, size_t len) {
+        shared_ptr<HtmlSnapshot> snapshot(new HtmlSnapshot(data, len, false));
+        if (!snapshot->Validate()) return shared_ptr<HtmlSnapshot>();
+        return snapshot;
+    }
+
+    /**
+     * map a snapshot file, nothing is copied or allocated per node.
+     * @return null if the file can not be read or is malformed
+     */
+    static shared_ptr<HtmlSnapshot> Open(const std::string &path) {
+#if defined(_WIN32)
+        FILE *fp = fopen(path.c_str(), "rb");
+        if (!fp) return shared_ptr<HtmlSnapshot>();
+
+        shared_ptr<HtmlSnapshot> snapshot(new HtmlSnapshot(NULL, 0, false));
+        char buf[64 * 1024];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) snapshot->owned_.append(buf, n);
+        fclose(fp);
+        snapshot->data_ = snapshot->owned_.data();
+        snapshot->size_ = snapshot->owned_.size();
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return shared_ptr<HtmlSnapshot>();
+
+        struct stat st;
+        void *p = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            p = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (p == MAP_FAILED) return shared_ptr<HtmlSnapshot>();
+
+        shared_ptr<HtmlSnapshot> snapshot(new HtmlSnapshot((const char *) p, (size_t) st.st_size, true));
+#endif
+        if (!snapshot->Validate()) return shared_ptr<HtmlSnapshot>();
+        return snapshot;
+    }
+
+    /**
+     * the unnamed root, parent of the top-level elements.
+     */
+    HtmlSnapshotNode GetRoot() const {
+        return HtmlSnapshotNode(this, 0);
+    }
+
+    size_t Size() const {
+        return header_->node_count;
+    }
+
+    /**
+     * same lookup as HtmlDocument::GetElementById.
+     * @return invalid node if nothing matches
+     */
+    HtmlSnapshotNode GetElementById(const std::string &id) const {
+        for (uint32_t i = 1; i < header_->node_count; i++) {
+            const Attribute *a = FindAttribute(i, "id");
+            size_t len = a ? a->value_len : 0;
+            if (len == id.size() && memcmp(pool_ + (a ? a->value : 0), id.data(), len) == 0) {
+                return HtmlSnapshotNode(this, i);
+            }
+        }
+
+        return HtmlSnapshotNode();
+    }
+
+    /**
+     * same rules and result order as HtmlDocument::SelectElement.
+     */
+    std::vector<HtmlSnapshotNode> SelectElement(const std::string &rule) const {
+        std::vector<uint32_t> found;
+        SelectState state(header_->node_count);
+        const Node &root = nodes_[0];
+        for (uint32_t c = 0; c < root.child_count; c++) {
+            Select(children_[root.child + c], rule, found, state);
+        }
+
+        std::vector<HtmlSnapshotNode> result;
+        result.reserve(found.size());
+        for (size_t i = 0; i < found.size(); i++) {
+            result.push_back(HtmlSnapshotNode(this, found[i]));
+        }
+
+        return result;
+    }
+
+    std::string text() const {
+        std::string str;
+        PlainStylize(0, str);
+        return str;
+    }
+
+private:
+    friend class HtmlSnapshotNode;
+
+    HtmlSnapshot(const char *data, size_t size, bool mapped)
+            : data_(data), size_(size), mapped_(mapped), header_(NULL), nodes_(NULL), children_(NULL),
+              attrs_(NULL), pool_(NULL) {}
+
+    /**
+     * lays out the nodes in document order, the child list of a node is
+     * written when it is left.
+     */
+    struct Writer : HtmlVisitor {
+        std::vector<Node> nodes;
+        std::vector<uint32_t> children;
+        std::vector<Attribute> attrs;
+        std::string pool;
+        std::unordered_map<std::string, uint32_t> interned;
+        std::vector<std::pair<uint32_t, std::vector<uint32_t> > > open;    // elements entered and their children
+
+        uint32_t Intern(const std::string &str) {
+            std::unordered_map<std::string, uint32_t>::const_iterator it = interned.find(str);
+            if (it != interned.end()) return it->second;
+
+            uint32_t offset = (uint32_t) pool.size();
+            pool.append(str);
+            interned[str] = offset;
+            return offset;
+        }
+
+        HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+            uint32_t index = (uint32_t) nodes.size();
+            Node node;
+            node.name = Intern(e->name);
+            node.name_len = (uint32_t) e->name.size();
+            node.value = Intern(e->Value());
+            node.value_len = (uint32_t) e->value.size();
+            node.parent = open.empty() ? 0 : open.back().first;
+            node.flags = e->flags;
+            node.attr = (uint32_t) attrs.size();
+            const std::map<std::string, std::string> &attribute = e->Attributes();
+            node.attr_count = (uint32_t) attribute.size();
+
+            std::map<std::string, std::string>::const_iterator it = attribute.begin();
+            for (; it != attribute.end(); ++it) {
+                Attribute a;
+                a.key = Intern(it->first);
+                a.key_len = (uint32_t) it->first.size();
+                a.value = Intern(it->second);
+                a.value_len = (uint32_t) it->second.size();
+                attrs.push_back(a);
+            }
+            nodes.push_back(node);
+
+            if (!open.empty()) open.back().second.push_back(index);
+            open.push_back(std::make_pair(index, std::vector<uint32_t>()));
+            return HTML_WALK_CONTINUE;
+        }
+
+        void Leave(const shared_ptr<HtmlElement> &) {
+            uint32_t index = open.back().first;
+            const std::vector<uint32_t> &kids = open.back().second;
+            nodes[index].end = (uint32_t) nodes.size();
+            nodes[index].child = (uint32_t) children.size();
+            nodes[index].child_count = (uint32_t) kids.size();
+            children.insert(children.end(), kids.begin(), kids.end());
+            open.pop_back();
+        }
+    };
+
+    /**
+     * bounds checks every table entry once, queries trust them afterwards.
+     */
+    bool Validate() {
+        if (size_ < sizeof(Header) || size_ > UINT32_MAX || ((uintptr_t) data_ % 4) != 0) return false;
+
+        header_ = (const Header *) data_;
+        if (memcmp(header_->magic, "HTMLSNAP", 8) != 0 || header_->version != 1 ||
+            header_->endian != 0x01020304 || header_->node_count == 0) {
+            return false;
+        }
+
+        uint64_t need = sizeof(Header) + (uint64_t) header_->node_count * sizeof(Node) +
+                        (uint64_t) header_->child_count * sizeof(uint32_t) +
+                        (uint64_t) header_->attr_count * sizeof(Attribute) + header_->pool_size;
+        if (need != size_) return false;
+
+        nodes_ = (const Node *) (data_ + sizeof(Header));
+        children_ = (const uint32_t *) (nodes_ + header_->node_count);
+        attrs_ = (const Attribute *) (children_ + header_->child_count);
+        pool_ = (const char *) (attrs_ + header_->attr_count);
+
+        uint64_t n = header_->node_count;
+        for (uint32_t i = 0; i < n; i++) {
+            const Node &node = nodes_[i];
+            if (!InPool(node.name, node.name_len) || !InPool(node.value, node.value_len) ||
+                node.end <= i || node.end > n || (i > 0 && node.parent >= i) ||
+                (uint64_t) node.child + node.child_count > header_->child_count ||
+                (uint64_t) node.attr + node.attr_count > header_->attr_count) {
+                return false;
+            }
+
+            for (uint32_t c = 0; c < node.child_count; c++) {
+                uint32_t child = children_[node.child + c];
+                if (child <= i || child >= node.end) return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < header_->attr_count; i++) {
+            if (!InPool(attrs_[i].key, attrs_[i].key_len) || !InPool(attrs_[i].value, attrs_[i].value_len)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool InPool(uint32_t offset, uint32_t len) const {
+        return (uint64_t) offset + len <= header_->pool_size;
+    }
+
+    std::string String(uint32_t offset, uint32_t len) const {
+        return std::string(pool_ + offset, len);
+    }
+
+    bool IsPlain(uint32_t i) const {
+        return nodes_[i].name_len == 5 && memcmp(pool_ + nodes_[i].name, "plain", 5) == 0;
+    }
+
+    const Attribute *FindAttribute(uint32_t i, const char *key) const {
+        size_t len = strlen(key);
+        const Node &node = nodes_[i];
+        for (uint32_t a = node.attr; a < node.attr + node.attr_count; a++) {
+            if (attrs_[a].key_len == len && memcmp(pool_ + attrs_[a].key, key, len) == 0) return &attrs_[a];
+        }
+
+        return NULL;
+    }
+
+    /**
+     * (node, length of the remaining rule) pairs already evaluated and the
+     * nodes already in the result, like HtmlElement::SelectState.
+     */
+    struct SelectState {
+        explicit SelectState(size_t nodes)
+                : found(nodes, 0) {}
+
+        bool Visit(uint32_t i, size_t rule) {
+            return visited.insert(uint64_t(rule) << 32 | i).second;
+        }
+
+        std::unordered_set<uint64_t> visited;
+        std::vector<char> found;
+    };
+
+    void Select(uint32_t i, const std::string &rule, std::vector<uint32_t> &result, SelectState &state) const {
+        if (rule.empty() || rule.at(0) != '/' || IsPlain(i)) return;
+
+        // a second evaluation can only find what the first one added
+        if (!state.Visit(i, rule.size())) return;
+
+        const Node &node = nodes_[i];
+        if (rule.size() >= 2 && rule.at(1) == '/') {
+            // a subtree already walked for the same "//" rule is passed over
+            std::string next = rule.substr(1);
+            for (uint32_t d = i + 1; d < node.end;) {
+                Select(d, next, result, state);
+                d = state.Visit(d, rule.size()) ? d + 1 : nodes_[d].end;
+            }
+
+            return;
+        }
+
+        std::string::size_type p = rule.find('/', 1);
+        std::string::size_type pos = (p == std::string::npos) ? rule.size() : p;
+        HtmlSelectStep step(rule, pos);
+        const Attribute *a = FindAttribute(i, step.attr.c_str());
+        bool matched = a ? step.Match(pool_ + node.name, node.name_len, pool_ + a->value, a->value_len, true)
+                         : step.Match(pool_ + node.name, node.name_len, NULL, 0, false);
+        if (!matched) return;
+
+        if (pos == rule.size()) {
+            if (!state.found[i]) {
+                state.found[i] = 1;
+                result.push_back(i);
+            }
+        } else {
+            std::string next = rule.substr(pos);
+            for (uint32_t c = 0; c < node.child_count; c++) {
+                Select(children_[node.child + c], next, result, state);
+            }
+        }
+    }
+
+    /**
+     * the subtree of i is the nodes up to its end, so it is read in order
+     * without recursion.
+     */
+    void PlainStylize(uint32_t i, std::string &str) const {
+        for (uint32_t d = i; d < nodes_[i].end;) {
+            const Node &node = nodes_[d];
+            // a first child directly follows its parent
+            if (d != i && node.parent + 1 != d) {
+                if (node.flags & HTML_TAG_TABLE_CELL) {
+                    str.append("\t");
+                } else if (node.flags & HTML_TAG_BLOCK) {
+                    str.append("\n");
+                }
+            }
+
+            if (node.flags & HTML_TAG_INVISIBLE) {
+                d = node.end;
+            } else if (IsPlain(d)) {
+                str.append(pool_ + node.value, node.value_len);
+                d = node.end;
+            } else {
+                d++;
+            }
+        }
+    }
+
+private:
+    const char *data_;
+    size_t size_;
+    bool mapped_;
+    std::string owned_;
+    const Header *header_;
+    const Node *nodes_;
+    const uint32_t *children_;
+    const Attribute *attrs_;
+    const char *pool_;
+};
+
+std::string HtmlSnapshotNode::GetName() const {
+    const HtmlSnapshot::Node &node = snapshot_->nodes_[index_];
+    return snapshot_->String(node.name, node.name_len);
+}
+
+std::string HtmlSnapshotNode::GetValue() const {
+    const HtmlSnapshot::Node &node = snapshot_->nodes_[index_];
+    if (node.value_len == 0 && node.child_count == 1 && snapshot_->IsPlain(snapshot_->children_[node.child])) {
+        return Child(0).GetValue();
+    }
+
+    return snapshot_->String(node.value, node.value_len);
+}
+
+std::string HtmlSnapshotNode::GetAttribute(const std::string &k) const {
+    const HtmlSnapshot::Attribute *a = snapshot_->FindAttribute(index_, k.c_str());
+    return a ? snapshot_->String(a->value, a->value_len) : std::string();
+}
+
+std::string HtmlSnapshotNode::text() const {
+    std::string str;
+    snapshot_->PlainStylize(index_, str);
+    return str;
+}
+
+size_t HtmlSnapshotNode::ChildCount() const {
+    return snapshot_->nodes_[index_].child_count;
+}
+
+HtmlSnapshotNode HtmlSnapshotNode::Child(size_t i) const {
+    const HtmlSnapshot::Node &node = snapshot_->nodes_[index_];
+    return HtmlSnapshotNode(snapshot_, snapshot_->children_[node.child + i]);
+}
+
+HtmlSnapshotNode HtmlSnapshotNode::GetParent() const {
+    if (index_ == 0) return HtmlSnapshotNode();
+    return HtmlSnapshotNode(snapshot_, snapshot_->nodes_[index_].parent);
+}
+
+#endif
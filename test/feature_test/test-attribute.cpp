@@ -0,0 +1,53 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static const string kTag =
+    "<div id=main class=\"a b\" data-x='1 > 0' data-empty= checked data-y=\"say 'hi'\" style=\"\" id=\"again\">"
+    "t</div><img src=a.png alt=\"x/\"/><a href=/path/>link</a>";
+
+TEST(attribute, tokenizedFromInput) {
+    HtmlParser parser;
+    cerr.setstate(ios::failbit);
+    shared_ptr<HtmlDocument> doc = parser.Parse(kTag);
+    cerr.clear();
+
+    shared_ptr<HtmlElement> div = doc->GetElementByTagName("div")[0];
+    ASSERT_EQ("main", div->GetAttribute("id"));
+    ASSERT_EQ("a b", div->GetAttribute("class"));
+    ASSERT_EQ("1 ", div->GetAttribute("data-x"));     // a ">" ends the tag even inside quotes
+    ASSERT_EQ(1u, doc->GetElementByTagName("img").size());
+    ASSERT_EQ("x/", doc->GetElementByTagName("img")[0]->GetAttribute("alt"));
+
+    // the '/' before '>' closes the element and is not part of the value
+    shared_ptr<HtmlElement> a = doc->GetElementByTagName("a")[0];
+    ASSERT_EQ("/path", a->GetAttribute("href"));
+    ASSERT_EQ("", a->text());
+}
+
+TEST(attribute, namesAndValuesSplitAcrossChunks) {
+    string html = "<p>x</p><div id=main class=\"a b\" data-empty= checked data-y=\"say 'hi'\" style=\"\">t</div>"
+                  "<img src=a.png alt=\"x/\"/><a href=/path/>link</a>";
+
+    HtmlParser parser;
+    string expected = parser.Parse(html)->html();
+    for (size_t chunk = 1; chunk < 8; chunk++) {
+        for (size_t i = 0; i < html.size(); i += chunk) {
+            parser.Feed(html.data() + i, min(chunk, html.size() - i));
+        }
+        ASSERT_EQ(expected, parser.Finish()->html()) << chunk;
+    }
+
+    shared_ptr<HtmlElement> div = parser.Parse(html)->GetElementByTagName("div")[0];
+    ASSERT_EQ("", div->GetAttribute("data-empty"));
+    ASSERT_EQ("say 'hi'", div->GetAttribute("data-y"));
+    ASSERT_EQ("/path", parser.Parse(html)->GetElementByTagName("a")[0]->GetAttribute("href"));
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "html_parser_cache.hpp"
+
+using namespace std;
+
+static string Page(int id) {
+    return "<html><body><div id=\"page\">" + to_string(id) + "</div><p>" + string(200, 'x') + "</p></body></html>";
+}
+
+TEST(cache, sharesDocumentForIdenticalInput) {
+    HtmlDocumentCache cache(1 << 20, 16);
+    shared_ptr<const HtmlDocument> a = cache.Parse(Page(1));
+    shared_ptr<const HtmlDocument> b = cache.Parse(Page(1));
+    shared_ptr<const HtmlDocument> c = cache.Parse(Page(2));
+
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ("2", c->GetElementById("page")->GetValue());
+
+    HtmlDocumentCache::Stats stats = cache.GetStats();
+    ASSERT_EQ(1u, stats.hits);
+    ASSERT_EQ(2u, stats.misses);
+    ASSERT_EQ(2u, stats.entries);
+    ASSERT_EQ(a->MemoryUsage().Total() + c->MemoryUsage().Total() + Page(1).size() + Page(2).size(), stats.bytes);
+}
+
+TEST(cache, evictsLeastRecentlyUsed) {
+    HtmlDocumentCache cache(1 << 20, 2);
+    cache.Parse(Page(1));
+    cache.Parse(Page(2));
+    cache.Parse(Page(1));
+    cache.Parse(Page(3));
+
+    ASSERT_EQ(1u, cache.GetStats().evictions);
+    cache.Parse(Page(1));
+    ASSERT_EQ(2u, cache.GetStats().hits);
+    cache.Parse(Page(2));
+    ASSERT_EQ(2u, cache.GetStats().hits);
+}
+
+TEST(cache, boundedByBytes) {
+    HtmlParser parser;
+    size_t one = parser.Parse(Page(1))->MemoryUsage().Total() + Page(1).size();
+    HtmlDocumentCache cache(one * 3, 100);
+    for (int i = 0; i < 10; i++) cache.Parse(Page(i));
+
+    HtmlDocumentCache::Stats stats = cache.GetStats();
+    ASSERT_LE(stats.bytes, one * 3);
+    ASSERT_EQ(3u, stats.entries);
+    ASSERT_EQ(7u, stats.evictions);
+
+    HtmlDocumentCache tiny(one / 2, 100);
+    ASSERT_TRUE(tiny.Parse(Page(1)));
+    ASSERT_EQ(0u, tiny.GetStats().entries);
+}
+
+TEST(cache, concurrentReaders) {
+    HtmlDocumentCache cache(1 << 22, 64);
+    vector<thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.push_back(thread([&cache]() {
+            for (int i = 0; i < 200; i++) {
+                shared_ptr<const HtmlDocument> doc = cache.Parse(Page(i % 8));
+                ASSERT_EQ(to_string(i % 8), doc->GetElementById("page")->GetValue());
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) threads[t].join();
+
+    HtmlDocumentCache::Stats stats = cache.GetStats();
+    ASSERT_EQ(800u, stats.hits + stats.misses);
+    ASSERT_EQ(8u, stats.entries);
+}
+
+/**
+ * the 8 byte block whose MurmurHash64A mix differs from the one of block
+ * in the top bit only. two such pairs in a row collide for every seed.
+ */
+static string FlipMix(const char *block) {
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    uint64_t inverse = m;
+    for (int i = 0; i < 5; i++) inverse *= 2 - m * inverse;
+
+    uint64_t k;
+    memcpy(&k, block, 8);
+    k *= m;
+    k ^= k >> 47;
+    k *= m;
+    k ^= uint64_t(1) << 63;
+    k *= inverse;
+    k ^= k >> 47;
+    k *= inverse;
+    return string((const char *) &k, 8);
+}
+
+TEST(cache, collidingInputsGetTheirOwnDocument) {
+    string suffix = "<div id=\"page\">x</div>";
+    string a = string("<b>aaa</b>bbbbbb") + suffix;
+    string b = FlipMix("<b>aaa</") + FlipMix("b>bbbbbb") + suffix;
+    ASSERT_NE(a, b);
+    ASSERT_EQ(HtmlDocumentCache::Hash(a.data(), a.size(), 1), HtmlDocumentCache::Hash(b.data(), b.size(), 1));
+    ASSERT_EQ(HtmlDocumentCache::Hash(a.data(), a.size(), 12345), HtmlDocumentCache::Hash(b.data(), b.size(), 12345));
+
+    HtmlDocumentCache cache(1 << 20, 16);
+    shared_ptr<const HtmlDocument> x = cache.Parse(a);
+    shared_ptr<const HtmlDocument> y = cache.Parse(b);
+    ASSERT_NE(x, y);
+    ASSERT_EQ(HtmlParser().Parse(a)->html(), x->html());
+    ASSERT_EQ(HtmlParser().Parse(b)->html(), y->html());
+    ASSERT_EQ(0u, cache.GetStats().hits);
+    ASSERT_EQ(x, cache.Parse(a));
+}
+
+TEST(cache, parsesWithTheGivenOptions) {
+    HtmlParser parser;
+    parser.SetSkipTag("p", HTML_SKIP_ELEMENT);
+    HtmlDocumentCache cache(1 << 20, 16, parser);
+    shared_ptr<const HtmlDocument> doc = cache.Parse(Page(1));
+    ASSERT_TRUE(doc->GetElementByTagName("p").empty());
+    ASSERT_EQ("1", doc->GetElementById("page")->GetValue());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_charset.hpp"
+
+using namespace std;
+
+static string Text(const string &input, HtmlCharset charset = HTML_CHARSET_UNKNOWN, size_t chunk = 0,
+                   HtmlCharset *sniffed = NULL) {
+    HtmlParser parser;
+    HtmlDecoder decoder(parser, charset, 16);
+    if (chunk == 0) chunk = input.size();
+    for (size_t i = 0; i < input.size(); i += chunk) {
+        decoder.Write(input.data() + i, min(chunk, input.size() - i));
+    }
+    decoder.Close();
+    if (sniffed) *sniffed = decoder.GetCharset();
+    return parser.Finish()->SelectElement("//p")[0]->GetValue();
+}
+
+TEST(charset, lookupLabels) {
+    ASSERT_EQ(HTML_CHARSET_UTF8, HtmlDecoder::Lookup(" UTF-8 "));
+    ASSERT_EQ(HTML_CHARSET_WINDOWS_1252, HtmlDecoder::Lookup("ISO-8859-1"));
+    ASSERT_EQ(HTML_CHARSET_GBK, HtmlDecoder::Lookup("gb2312"));
+    ASSERT_EQ(HTML_CHARSET_BIG5, HtmlDecoder::Lookup("Big5"));
+    ASSERT_EQ(HTML_CHARSET_SHIFT_JIS, HtmlDecoder::Lookup("Shift_JIS"));
+    ASSERT_EQ(HTML_CHARSET_UNKNOWN, HtmlDecoder::Lookup("koi8-r"));
+    // not code page 950, its hkscs rows are not decoded
+    ASSERT_EQ(HTML_CHARSET_UNKNOWN, HtmlDecoder::Lookup("big5-hkscs"));
+}
+
+TEST(charset, sniffsMeta) {
+    string a = "<html><head><meta charset=\"gbk\"></head>";
+    string b = "<html><head><meta http-equiv=\"Content-Type\" content=\"text/html; charset=Shift_JIS\"/></head>";
+    string c = "<html><!-- <meta charset=\"big5\"> --><META CHARSET=big5>";
+    string d = "<html><meta charset=\"utf-16\">";
+    ASSERT_EQ(HTML_CHARSET_GBK, HtmlDecoder::Sniff(a.data(), a.size()));
+    ASSERT_EQ(HTML_CHARSET_SHIFT_JIS, HtmlDecoder::Sniff(b.data(), b.size()));
+    ASSERT_EQ(HTML_CHARSET_BIG5, HtmlDecoder::Sniff(c.data(), c.size()));
+    ASSERT_EQ(HTML_CHARSET_UTF8, HtmlDecoder::Sniff(d.data(), d.size()));
+    ASSERT_EQ(HTML_CHARSET_UNKNOWN, HtmlDecoder::Sniff("<html><meta name=x>", 19));
+}
+
+TEST(charset, decodesLegacyCharsets) {
+    HtmlCharset sniffed;
+    ASSERT_EQ("\xe4\xb8\xad\xe6\x96\x87\xe2\x82\xac",
+              Text("<html><meta charset=gbk><p>\xd6\xd0\xce\xc4\x80</p></html>", HTML_CHARSET_UNKNOWN, 0, &sniffed));
+    ASSERT_EQ(HTML_CHARSET_GBK, sniffed);
+    ASSERT_EQ("\xe4\xb8\xad\xe6\x96\x87", Text("<html><p>\xa4\xa4\xa4\xe5</p></html>", HTML_CHARSET_BIG5));
+    ASSERT_EQ("\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xef\xbd\xb1",
+              Text("<html><p>\x93\xfa\x96\x7b\x8c\xea\xb1</p></html>", HTML_CHARSET_SHIFT_JIS));
+    ASSERT_EQ("caf\xc3\xa9 \xe2\x82\xac", Text("<html><p>caf\xe9 \x80</p></html>", HTML_CHARSET_WINDOWS_1252));
+
+    string utf16("\xff\xfe", 2);
+    string html = "<html><p>a</p></html>";
+    for (size_t i = 0; i < html.size(); i++) utf16 += string(1, html[i]) + '\0';
+    utf16.replace(utf16.find(string("a\0", 2)), 2, string("\x3d\xd8\x00\xde", 4));
+    ASSERT_EQ("\xf0\x9f\x98\x80", Text(utf16, HTML_CHARSET_UNKNOWN, 0, &sniffed));
+    ASSERT_EQ(HTML_CHARSET_UTF16LE, sniffed);
+}
+
+TEST(charset, decisionOrder) {
+    HtmlCharset sniffed;
+    // the byte order mark wins over the transport, the transport over <meta>
+    Text("\xef\xbb\xbf<html><p>x</p></html>", HTML_CHARSET_GBK, 0, &sniffed);
+    ASSERT_EQ(HTML_CHARSET_UTF8, sniffed);
+    ASSERT_EQ("\xe4\xb8\xad", Text("<html><meta charset=big5><p>\xd6\xd0</p></html>", HTML_CHARSET_GBK));
+
+    // without a declaration: utf-8 when valid, windows-1252 when not
+    Text("<html><p>\xc3\xa9</p></html>", HTML_CHARSET_UNKNOWN, 0, &sniffed);
+    ASSERT_EQ(HTML_CHARSET_UTF8, sniffed);
+    ASSERT_EQ("\xc3\xa9", Text("<html><p>\xe9</p></html>", HTML_CHARSET_UNKNOWN, 0, &sniffed));
+    ASSERT_EQ(HTML_CHARSET_WINDOWS_1252, sniffed);
+}
+
+TEST(charset, replacesMalformedInput) {
+    HtmlParser parser;
+    HtmlDecoder decoder(parser, HTML_CHARSET_UTF8);
+    decoder.Write("<html><p>a\xc3(\xed\xa0\x80z\xf0\x9f\x98", 19);
+    decoder.Write("</p></html>");
+    decoder.Close();
+    ASSERT_EQ(5u, decoder.GetReplaced());
+    ASSERT_EQ("a\xef\xbf\xbd(\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbdz\xef\xbf\xbd",
+              parser.Finish()->SelectElement("//p")[0]->GetValue());
+
+    // a four byte gb18030 sequence, the ascii trail is read again
+    ASSERT_EQ("\xef\xbf\xbd" "0\xef\xbf\xbd" "0", Text("<html><p>\x81" "0\x81" "0</p></html>", HTML_CHARSET_GBK));
+    ASSERT_EQ("\xef\xbf\xbd\xef\xbf\xbd", Text("<html><p>\xa0\xfd</p></html>", HTML_CHARSET_SHIFT_JIS));
+}
+
+TEST(charset, chunksDoNotMatter) {
+    string inputs[] = {
+        "<html><meta charset=gbk><p>\xd6\xd0\xce\xc4 x \xd6\xd0</p></html>",
+        "<html><p>\xe4\xb8\xad\xf0\x9f\x98\x80\xc3\xa9 plain</p></html>",
+        "\xfe\xff" + string("\0<\0h\0t\0m\0l\0>\0<\0p\0>\xd8\x3d\xde\x00\0<\0/\0p\0>\0<\0/\0h\0t\0m\0l\0>", 44),
+    };
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        string whole = Text(inputs[i]);
+        for (size_t chunk = 1; chunk < 6; chunk++) {
+            ASSERT_EQ(whole, Text(inputs[i], HTML_CHARSET_UNKNOWN, chunk)) << i << " " << chunk;
+        }
+    }
+}
+
+TEST(charset, validUtf8Prefix) {
+    ASSERT_EQ(3u, HtmlDecoder::ValidUtf8("abc", 3));
+    ASSERT_EQ(40u, HtmlDecoder::ValidUtf8("0123456789012345678901234567890123\xe4\xb8\xad\xc3\xa9z", 40));
+    ASSERT_EQ(1u, HtmlDecoder::ValidUtf8("a\xc0\x80", 3));
+    ASSERT_EQ(1u, HtmlDecoder::ValidUtf8("a\xed\xa0\x80", 4));
+    ASSERT_EQ(1u, HtmlDecoder::ValidUtf8("a\xf4\x90\x80\x80", 5));
+    ASSERT_EQ(1u, HtmlDecoder::ValidUtf8("a\xe4\xb8", 3));
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_coro.hpp"
+
+using namespace std;
+
+/**
+ * in-process byte source, every Read() completes only when the test
+ * loop delivers the next few bytes.
+ */
+struct SlowSource {
+    SlowSource(const string &d, size_t c)
+            : data(d), chunk(c), offset(0) {}
+
+    struct Awaiter {
+        SlowSource *source;
+
+        bool await_ready() {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            source->waiting.push_back(h);
+        }
+
+        string await_resume() {
+            size_t n = min(source->chunk, source->data.size() - source->offset);
+            string bytes = source->data.substr(source->offset, n);
+            source->offset += n;
+            return bytes;
+        }
+    };
+
+    Awaiter Read() {
+        return Awaiter{this};
+    }
+
+    bool Deliver() {
+        if (waiting.empty()) return false;
+        std::coroutine_handle<> h = waiting.front();
+        waiting.pop_front();
+        h.resume();
+        return true;
+    }
+
+    string data;
+    size_t chunk;
+    size_t offset;
+    deque<std::coroutine_handle<> > waiting;
+};
+
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+static Detached Collect(HtmlElementStream &stream, SlowSource &source, vector<string> &values,
+                        vector<size_t> &offsets, bool &done) {
+    while (shared_ptr<HtmlElement> e = co_await stream.Next()) {
+        values.push_back(e->GetName() + ":" + e->text());
+        offsets.push_back(source.offset);
+    }
+
+    done = true;
+}
+
+TEST(coro, yieldsElementsBeforeInputEnds) {
+    SlowSource source("<html><body><ul><li>a</li><li>b</li><li>c</li></ul></body></html>", 5);
+    HtmlElementStream stream = ParseElementsAsync(source);
+    vector<string> values;
+    vector<size_t> offsets;
+    bool done = false;
+    Collect(stream, source, values, offsets, done);
+    while (source.Deliver()) {}
+
+    ASSERT_TRUE(done);
+    ASSERT_EQ(vector<string>({"li:a", "li:b", "li:c", "ul:abc", "body:abc", "html:abc"}), values);
+    ASSERT_LT(offsets[0], source.data.size());
+}
+
+TEST(coro, yieldsOnlyMatchingElements) {
+    SlowSource source("<div><a href='1'>x</a><a>y</a><p><a href='2'>z</a></p></div>", 3);
+    HtmlElementStream stream = ParseElementsAsync(source, "/a[@href]");
+    vector<string> values;
+    vector<size_t> offsets;
+    bool done = false;
+    Collect(stream, source, values, offsets, done);
+    while (source.Deliver()) {}
+
+    ASSERT_TRUE(done);
+    ASSERT_EQ(vector<string>({"a:x", "a:z"}), values);
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_diff.hpp"
+
+using namespace std;
+
+static shared_ptr<HtmlDocument> Parse(const string &html) {
+    HtmlParser parser;
+    parser.SetSubtreeHashes(true);
+    return parser.Parse(html);
+}
+
+static string Page(const string &title, const string &extra = "") {
+    string html = "<html><head><title>" + title + "</title></head><body><ul>";
+    for (int i = 0; i < 200; i++) {
+        html += "<li class=\"item\"><a href=\"/p/" + to_string(i) + "\">item " + to_string(i) + "</a></li>";
+        if (i == 100) html += extra;
+    }
+    return html + "</ul></body></html>";
+}
+
+TEST(diff, hashesFollowContent) {
+    shared_ptr<HtmlDocument> doc = Parse("<html><p a=\"1\" b=\"2\">x<b>y</b></p><p b=\"2\" a=\"1\">x<b>y</b></p>"
+                                         "<p a=\"1\" b=\"2\">x<b>z</b></p></html>");
+    vector<shared_ptr<HtmlElement> > p = doc->GetElementByTagName("p");
+    ASSERT_NE(0u, p[0]->GetHash());
+    ASSERT_EQ(p[0]->GetHash(), p[1]->GetHash());
+    ASSERT_NE(p[0]->GetHash(), p[2]->GetHash());
+    ASSERT_EQ(p[0]->GetHash(), Parse("<html><p a=\"1\" b=\"2\">x<b>y</b></p></html>")->GetElementByTagName("p")[0]->GetHash());
+
+    HtmlParser plain;
+    ASSERT_EQ(0u, plain.Parse("<html><p>x</p></html>")->GetElementByTagName("p")[0]->GetHash());
+
+    // fed in pieces, the hashes are the same
+    string html = Page("t");
+    HtmlParser parser;
+    parser.SetSubtreeHashes(true);
+    for (size_t i = 0; i < html.size(); i += 7) parser.Feed(html.data() + i, min<size_t>(7, html.size() - i));
+    ASSERT_EQ(Parse(html)->GetRoot()->ChildBegin()[0]->GetHash(), parser.Finish()->GetRoot()->ChildBegin()[0]->GetHash());
+}
+
+TEST(diff, identicalDocuments) {
+    ASSERT_TRUE(HtmlTreeDiff::Compare(Parse(Page("t")), Parse(Page("t"))).empty());
+}
+
+TEST(diff, changedText) {
+    shared_ptr<HtmlDocument> before = Parse(Page("old"));
+    shared_ptr<HtmlDocument> after = Parse(Page("new"));
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(before, after);
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(HTML_CHANGE_MODIFIED, changes[0].kind);
+    ASSERT_EQ("old", changes[0].before->GetValue());
+    ASSERT_EQ("new", changes[0].after->GetValue());
+    ASSERT_EQ("title", changes[0].after->GetParent()->GetName());
+}
+
+TEST(diff, changedAttribute) {
+    string before = Page("t");
+    string after = before;
+    after.replace(after.find("/p/150"), 6, "/q/150");
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(Parse(before), Parse(after));
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(HTML_CHANGE_MODIFIED, changes[0].kind);
+    ASSERT_EQ("/p/150", changes[0].before->GetAttribute("href"));
+    ASSERT_EQ("/q/150", changes[0].after->GetAttribute("href"));
+}
+
+TEST(diff, addedRemovedAndMoved) {
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(Parse(Page("t")), Parse(Page("t", "<li>new</li>")));
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(HTML_CHANGE_ADDED, changes[0].kind);
+    ASSERT_FALSE(changes[0].before);
+    ASSERT_EQ("new", changes[0].after->GetValue());
+
+    changes = HtmlTreeDiff::Compare(Parse(Page("t", "<li>new</li>")), Parse(Page("t")));
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(HTML_CHANGE_REMOVED, changes[0].kind);
+    ASSERT_FALSE(changes[0].after);
+
+    changes = HtmlTreeDiff::Compare(Parse("<html><p>a</p><p>b</p><div>c</div></html>"),
+                                    Parse("<html><p>b</p><p>a</p><span>c</span></html>"));
+    ASSERT_EQ(2u, changes.size());
+    ASSERT_EQ(HTML_CHANGE_ADDED, changes[0].kind);
+    ASSERT_EQ("span", changes[0].after->GetName());
+    ASSERT_EQ(HTML_CHANGE_REMOVED, changes[1].kind);
+    ASSERT_EQ("div", changes[1].before->GetName());
+}
+
+TEST(diff, unchangedLazySubtreesAreNotBuilt) {
+    HtmlParser parser;
+    parser.SetSubtreeHashes(true);
+    parser.SetLazySubtrees(3);
+    shared_ptr<HtmlDocument> a = parser.Parse(Page("old"));
+    shared_ptr<HtmlDocument> b = parser.Parse(Page("new"));
+    size_t before = a->MemoryUsage().Total();
+
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(a, b);
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ("new", changes[0].after->GetValue());
+    // the list was not built
+    ASSERT_EQ(before, a->MemoryUsage().Total());
+}
+
+TEST(diff, withoutHashes) {
+    HtmlParser parser;
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(parser.Parse(Page("old")), parser.Parse(Page("new")));
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ("new", changes[0].after->GetValue());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
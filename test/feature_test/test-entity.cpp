@@ -0,0 +1,172 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static string Decode(const string &s, bool attribute = false) {
+    string r = s;
+    HtmlEntity::Decode(r, attribute);
+    return r;
+}
+
+TEST(entity, namedAndNumeric) {
+    ASSERT_EQ("a & b < c > d \" e ' f", Decode("a &amp; b &lt; c &gt; d &quot; e &apos; f"));
+    ASSERT_EQ("\xc2\xa0\xc2\xa9\xe2\x82\xac", Decode("&nbsp;&copy;&euro;"));
+    ASSERT_EQ("AB\xe2\x82\xac", Decode("&#65;&#x42;&#x20AC;"));
+    // two code points
+    ASSERT_EQ("\xe2\x89\xaa\xe2\x83\x92", Decode("&nLt;"));
+    // windows-1252 and invalid numbers
+    ASSERT_EQ("\xe2\x82\xac\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd", Decode("&#x80;&#0;&#xD800;&#99999999999;"));
+    ASSERT_EQ("plain text", Decode("plain text"));
+}
+
+TEST(entity, malformedReferences) {
+    ASSERT_EQ("& &; &# &#x; &unknown;", Decode("& &; &# &#x; &unknown;"));
+    // a missing ';', legacy names also match as a prefix
+    ASSERT_EQ("A<< \xc2\xa9x &x", Decode("&#65<&lt &copyx &ampx"));
+    ASSERT_EQ("\xc2\xacit;", Decode("&notit;"));
+    ASSERT_EQ("\xe2\x88\x89", Decode("&notin;"));
+}
+
+TEST(entity, attributeRules) {
+    // a legacy name without ';' is kept in attributes before '=' or an alphanumeric
+    ASSERT_EQ("?a=1&copy=2&ampx", Decode("?a=1&copy=2&ampx", true));
+    ASSERT_EQ("?a=1\xc2\xa9=2&x", Decode("?a=1&copy;=2&amp;x", true));
+    ASSERT_EQ("x & y", Decode("x &amp y", true));
+    ASSERT_EQ("\xc2\xa9=2", Decode("&copy=2"));
+}
+
+TEST(entity, escape) {
+    string out;
+    HtmlEntity::Escape("a<b>&\"c", 7, false, out);
+    ASSERT_EQ("a&lt;b>&amp;\"c", out);
+    out.clear();
+    HtmlEntity::Escape("a<b>&\"c", 7, true, out);
+    ASSERT_EQ("a<b>&amp;&quot;c", out);
+}
+
+TEST(entity, lazyOnAccess) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(
+            "<html><div id=\"a\" title=\"x &amp; y\"><p>Tom &amp; Jerry &lt;3</p>"
+            "<a href=\"?q=1&amp;r=2&copy=3\">&copy; 2017</a></div></html>");
+
+    shared_ptr<HtmlElement> p = doc->SelectElement("//p")[0];
+    ASSERT_EQ("Tom & Jerry <3", p->GetValue());
+    ASSERT_EQ("Tom & Jerry <3", p->text());
+    ASSERT_EQ("x & y", doc->GetElementById("a")->GetAttribute("title"));
+
+    shared_ptr<HtmlElement> a = doc->SelectElement("//a")[0];
+    ASSERT_EQ("?q=1&r=2&copy=3", a->GetAttribute("href"));
+    ASSERT_EQ("\xc2\xa9 2017", a->text());
+
+    // selectors compare decoded values
+    ASSERT_EQ(1u, doc->SelectElement("//div[@title='x & y']").size());
+    ASSERT_EQ(0u, doc->SelectElement("//div[@title='x &amp; y']").size());
+}
+
+TEST(entity, htmlEscapesAgain) {
+    HtmlParser parser;
+    string html = "<p title=\"&quot;a&quot; &amp; b\">1 &lt; 2 &amp;&amp; 3 &gt; 2</p>";
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    ASSERT_EQ("<p title=\"&quot;a&quot; &amp; b\">1 &lt; 2 &amp;&amp; 3 > 2</p>", doc->html());
+
+    shared_ptr<HtmlDocument> again = parser.Parse(doc->html());
+    ASSERT_EQ(doc->html(), again->html());
+    ASSERT_EQ(doc->text(), again->text());
+}
+
+TEST(entity, rawTextIsNotDecoded) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(
+            "<html><script>if (a &amp;&amp; b < c) x();</script><style>a::after{content:'&lt;'}</style>"
+            "<p>&lt;</p></html>");
+    ASSERT_EQ("if (a &amp;&amp; b < c) x();", doc->SelectElement("//script")[0]->GetValue());
+    ASSERT_EQ("a::after{content:'&lt;'}", doc->SelectElement("//style")[0]->GetValue());
+    ASSERT_EQ("<script>if (a &amp;&amp; b < c) x();</script>", doc->SelectElement("//script")[0]->html());
+    ASSERT_EQ("<", doc->SelectElement("//p")[0]->GetValue());
+
+    HtmlParser skip;
+    skip.SetSkipTag("pre", HTML_SKIP_RAW);
+    doc = skip.Parse("<html><pre>&lt;b&gt;</pre></html>");
+    ASSERT_EQ("&lt;b&gt;", doc->SelectElement("//pre")[0]->GetValue());
+}
+
+TEST(entity, eagerMatchesLazy) {
+    string html = "<html><ul><li class=\"a&amp;b\">&euro;&#8364;&#x20ac;</li><li>&notin &noti; &amp</li>"
+                  "<li data-x=\"&lt;&gt;\">&lt;b&gt;</li></ul></html>";
+    HtmlParser lazy;
+    HtmlParser eager;
+    eager.SetEntityDecoding(HTML_ENTITIES_EAGER);
+    HtmlParser lazy_attributes;
+    lazy_attributes.SetEntityDecoding(HTML_ENTITIES_EAGER);
+    lazy_attributes.SetLazyAttributes(true);
+
+    shared_ptr<HtmlDocument> a = lazy.Parse(html);
+    shared_ptr<HtmlDocument> b = eager.Parse(html);
+    shared_ptr<HtmlDocument> c = lazy_attributes.Parse(html);
+    ASSERT_EQ(a->html(), b->html());
+    ASSERT_EQ(a->text(), b->text());
+    ASSERT_EQ(a->html(), c->html());
+    ASSERT_EQ(a->text(), c->text());
+    ASSERT_EQ("\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac", b->SelectElement("//li")[0]->GetValue());
+    ASSERT_EQ("a&b", c->SelectElement("//li")[0]->GetAttribute("class"));
+}
+
+TEST(entity, defaultHtmlOutput) {
+    // decoding is on by default, html() does not give the input bytes back
+    string html = "<html><p title=\"a&nbsp;&gt;\">x&nbsp;&gt;&#39;&amp;&lt;</p></html>";
+    HtmlParser parser;
+    ASSERT_EQ("<html><p title=\"a\xc2\xa0>\">x\xc2\xa0>'&amp;&lt;</p></html>", parser.Parse(html)->html());
+
+    parser.SetEntityDecoding(HTML_ENTITIES_KEEP);
+    ASSERT_EQ(html, parser.Parse(html)->html());
+}
+
+TEST(entity, keepMode) {
+    HtmlParser parser;
+    parser.SetEntityDecoding(HTML_ENTITIES_KEEP);
+    string html = "<html><p title=\"a &amp; b\">&lt;x&gt; &amp; y</p></html>";
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    ASSERT_EQ(html, doc->html());
+    ASSERT_EQ("&lt;x&gt; &amp; y", doc->text());
+    ASSERT_EQ("a &amp; b", doc->SelectElement("//p")[0]->GetAttribute("title"));
+}
+
+TEST(entity, concurrentValue) {
+    string text;
+    for (size_t i = 0; i < 2000; i++) text += "a &amp; b &lt; c ";
+    string decoded;
+    for (size_t i = 0; i < 2000; i++) decoded += "a & b < c ";
+    string html = "<html>";
+    for (size_t i = 0; i < 64; i++) html += "<p>" + text + "</p>";
+    html += "</html>";
+
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    vector<shared_ptr<HtmlElement> > ps = doc->GetElementByTagName("p");
+    ASSERT_EQ(64u, ps.size());
+
+    // readers that arrive while another thread decodes wait for it
+    vector<thread> threads;
+    vector<size_t> found(8, 0);
+    for (size_t t = 0; t < found.size(); t++) {
+        threads.push_back(thread([&ps, &found, &decoded, t] {
+            for (size_t i = 0; i < ps.size(); i++) {
+                if (ps[i]->GetValue() == decoded) found[t]++;
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) threads[t].join();
+
+    for (size_t t = 0; t < found.size(); t++) ASSERT_EQ(ps.size(), found[t]);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static size_t allocations = 0;
+
+/**
+ * every form of operator new counts, each one is paired with its delete.
+ */
+static void *Allocate(size_t size, size_t align = 0) {
+    allocations++;
+    size = size ? size : 1;
+    void *p = align ? aligned_alloc(align, (size + align - 1) / align * align) : malloc(size);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size) {
+    return Allocate(size);
+}
+
+void *operator new[](size_t size) {
+    return Allocate(size);
+}
+
+void *operator new(size_t size, const nothrow_t &) noexcept {
+    try { return Allocate(size); } catch (...) { return NULL; }
+}
+
+void *operator new[](size_t size, const nothrow_t &) noexcept {
+    try { return Allocate(size); } catch (...) { return NULL; }
+}
+
+void *operator new(size_t size, align_val_t align) {
+    return Allocate(size, (size_t) align);
+}
+
+void *operator new[](size_t size, align_val_t align) {
+    return Allocate(size, (size_t) align);
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+void operator delete(void *p, const nothrow_t &) noexcept { free(p); }
+void operator delete[](void *p, const nothrow_t &) noexcept { free(p); }
+void operator delete(void *p, align_val_t) noexcept { free(p); }
+void operator delete[](void *p, align_val_t) noexcept { free(p); }
+void operator delete(void *p, size_t, align_val_t) noexcept { free(p); }
+void operator delete[](void *p, size_t, align_val_t) noexcept { free(p); }
+
+static HtmlFingerprint Fingerprint(const string &html, size_t lazy = 0) {
+    HtmlParser parser;
+    parser.SetFingerprint(true);
+    if (lazy) parser.SetLazySubtrees(lazy);
+    return parser.Parse(html)->GetFingerprint();
+}
+
+static HtmlFingerprint OfText(const string &text) {
+    HtmlFingerprinter fingerprinter;
+    fingerprinter.Reset(64, 3);
+    fingerprinter.Add(text.data(), text.size());
+    HtmlFingerprint fp;
+    fingerprinter.Finish(fp);
+    return fp;
+}
+
+static string Article(int changed) {
+    static const char *words[] = {"parser", "element", "attribute", "value", "document", "stream", "token", "shingle"};
+    string html = "<html><head><title>t</title><script>var x = 1;</script></head><body><div class=\"main\">";
+    for (int i = 0; i < 300; i++) {
+        if (i % 12 == 0) html += "<p>";
+        html += (i == changed) ? string("changed") : string(words[(i * 7 + i / 8) % 8]) + to_string(i % 50);
+        html += (i % 12 == 11) ? "</p>" : " ";
+    }
+    return html + "</div></body></html>";
+}
+
+TEST(fingerprint, visibleTextTokens) {
+    HtmlFingerprint fp = Fingerprint("<html><head><title>Ignored</title><style>p{}</style></head>"
+                                     "<body><p>Hello, World</p><script>var a;</script><div>again</div></body></html>");
+    ASSERT_EQ(3u, fp.tokens);
+    HtmlFingerprint text = OfText("hello world again");
+    ASSERT_EQ(text.simhash, fp.simhash);
+    ASSERT_EQ(text.minhash, fp.minhash);
+    ASSERT_EQ(64u, fp.minhash.size());
+
+    // blocks separate tokens, inline elements do not
+    ASSERT_EQ(2u, Fingerprint("<html><div>ab</div><div>cd</div></html>").tokens);
+    ASSERT_EQ(1u, Fingerprint("<html><div>ab<b>cd</b></div></html>").tokens);
+    ASSERT_EQ(5u, Fingerprint("<html><p>\xe4\xb8\xad\xe6\x96\x87 x\xc3\xa9</p><p>a&amp;b</p></html>").tokens);
+
+    HtmlParser plain;
+    ASSERT_EQ(0u, plain.Parse("<html><p>x</p></html>")->GetFingerprint().tokens);
+}
+
+TEST(fingerprint, nearDuplicates) {
+    HtmlFingerprint a = Fingerprint(Article(-1));
+    HtmlFingerprint b = Fingerprint(Article(150));
+    HtmlFingerprint c = Fingerprint("<html><p>" + string(2000, 'x') + " something else entirely</p></html>");
+
+    ASSERT_EQ(0, a.Distance(Fingerprint(Article(-1))));
+    ASSERT_EQ(1.0, a.Similarity(Fingerprint(Article(-1))));
+    ASSERT_LT(a.Distance(b), 8);
+    ASSERT_GT(a.Similarity(b), 0.8);
+    ASSERT_GT(a.Distance(c), 10);
+    ASSERT_LT(a.Similarity(c), 0.2);
+
+    // markup around the same text does not matter
+    ASSERT_EQ(OfText("a b c d").simhash, Fingerprint("<html><p><b>a</b> <i>b</i> c <span>d</span></p></html>").simhash);
+}
+
+TEST(fingerprint, sameWhenFedOrLazy) {
+    string html = Article(20);
+    HtmlFingerprint whole = Fingerprint(html);
+
+    HtmlParser parser;
+    parser.SetFingerprint(true);
+    for (size_t i = 0; i < html.size(); i += 5) parser.Feed(html.data() + i, min<size_t>(5, html.size() - i));
+    HtmlFingerprint fed = parser.Finish()->GetFingerprint();
+    ASSERT_EQ(whole.simhash, fed.simhash);
+    ASSERT_EQ(whole.minhash, fed.minhash);
+
+    for (size_t depth = 1; depth < 5; depth++) {
+        HtmlFingerprint lazy = Fingerprint(html, depth);
+        ASSERT_EQ(whole.simhash, lazy.simhash) << depth;
+        ASSERT_EQ(whole.minhash, lazy.minhash) << depth;
+        ASSERT_EQ(whole.tokens, lazy.tokens) << depth;
+    }
+}
+
+TEST(fingerprint, parserAllocatesNothingUntilEnabled) {
+    size_t before = allocations;
+    {
+        HtmlParser parser;
+        parser.SetFingerprint(false);
+    }
+    ASSERT_EQ(before, allocations);
+}
+
+TEST(fingerprint, defaultConstructedWithoutReset) {
+    HtmlFingerprinter fingerprinter;
+    fingerprinter.Add("hello world again", 17);
+    HtmlFingerprint fp;
+    fingerprinter.Finish(fp);
+    HtmlFingerprint text = OfText("hello world again");
+    ASSERT_EQ(text.simhash, fp.simhash);
+    ASSERT_EQ(text.minhash, fp.minhash);
+
+    HtmlFingerprinter empty;
+    empty.Finish(fp);
+    ASSERT_EQ(0u, fp.tokens);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_gzip.hpp"
+
+using namespace std;
+
+static string Compress(const string &data, int bits) {
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    deflateInit2(&z, Z_BEST_SPEED, Z_DEFLATED, bits, 8, Z_DEFAULT_STRATEGY);
+    string out(deflateBound(&z, data.size()) + 32, '\0');
+    z.next_in = (Bytef *) data.data();
+    z.avail_in = data.size();
+    z.next_out = (Bytef *) &out[0];
+    z.avail_out = out.size();
+    deflate(&z, Z_FINISH);
+    out.resize(z.total_out);
+    deflateEnd(&z);
+    return out;
+}
+
+static string Page() {
+    string html("<html><head><title>gz</title><script>var s = '</div>';</script></head><body>");
+    for (int i = 0; i < 2000; i++) {
+        html += "<div class=\"row\"><a href=\"/p/" + to_string(i) + "\">item " + to_string(i) + "</a></div>";
+    }
+    return html + "</body></html>";
+}
+
+TEST(gzip, parsesEveryFormat) {
+    string html = Page();
+    HtmlParser parser;
+    string expected = parser.Parse(html)->html();
+
+    int bits[] = { MAX_WBITS + 16, MAX_WBITS, -MAX_WBITS };
+    for (size_t i = 0; i < 3; i++) {
+        string packed = Compress(html, bits[i]);
+        ASSERT_EQ(expected, ParseCompressed(parser, packed.data(), packed.size())->html());
+    }
+
+    string path = testing::TempDir() + "page.html.gz";
+    string packed = Compress(html, MAX_WBITS + 16);
+    FILE *fp = fopen(path.c_str(), "wb");
+    fwrite(packed.data(), 1, packed.size(), fp);
+    fclose(fp);
+    ASSERT_EQ(expected, ParseCompressedFile(parser, path)->html());
+    remove(path.c_str());
+}
+
+TEST(gzip, inflatesInSmallChunks) {
+    string html = Page();
+    string packed = Compress(html, MAX_WBITS + 16);
+    packed += Compress("<p>second member</p>", MAX_WBITS + 16);
+
+    HtmlParser parser;
+    HtmlInflater inflater(parser, 7);
+    for (size_t i = 0; i < packed.size(); i += 3) {
+        ASSERT_TRUE(inflater.Write(packed.data() + i, min<size_t>(3, packed.size() - i)));
+    }
+    ASSERT_TRUE(inflater.Close());
+
+    shared_ptr<HtmlDocument> doc = parser.Finish();
+    ASSERT_EQ(2000u, doc->SelectElement("//div[@class='row']").size());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+}
+
+TEST(gzip, reportsCorruptInput) {
+    string packed = Compress(Page(), MAX_WBITS + 16);
+    packed.resize(packed.size() / 2);
+
+    HtmlParser parser;
+    HtmlInflater inflater(parser);
+    ASSERT_TRUE(inflater.Write(packed.data(), packed.size()));
+    ASSERT_FALSE(inflater.Close());
+
+    ASSERT_FALSE(ParseCompressedFile(parser, "/nonexistent/page.html.gz"));
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static string FeedBytes(const string &html, size_t chunk) {
+    HtmlParser parser;
+    for (size_t i = 0; i < html.size(); i += chunk) {
+        parser.Feed(html.data() + i, min(chunk, html.size() - i));
+    }
+
+    return parser.Finish()->html();
+}
+
+TEST(incremental, matchesWholeBufferParse) {
+    const char *pages[] = {
+        "<html><head><!-- c -- --><script>if (a</b) {}</script></head><body><p id=x>one<br/>two</p></body></html>",
+        "<table><td>1</td></tr> <td>2</td></tr> <td> <table><td>3</td> <td>4</td></table> <tr><td>5</table>",
+        "<?xml version=\"1.0\"?><!DOCTYPE html><div class='a b'><style> p {} </style><span>x</span></div>",
+        "<div><p>unclosed</div><p>dropped",
+    };
+
+    HtmlParser parser;
+    for (size_t i = 0; i < sizeof(pages) / sizeof(pages[0]); i++) {
+        string expected = parser.Parse(pages[i])->html();
+        for (size_t chunk = 1; chunk < 8; chunk++) {
+            ASSERT_EQ(expected, FeedBytes(pages[i], chunk));
+        }
+    }
+}
+
+TEST(incremental, reportsElementsWhenClosed) {
+    vector<string> closed;
+    HtmlParser parser;
+    parser.SetElementCallback([&closed](const shared_ptr<HtmlElement> &e) {
+        closed.push_back(e->GetName());
+    });
+
+    string html("<ul><li>a</li><li>b</li></ul>");
+    parser.Feed(html.data(), 14);
+    ASSERT_EQ(vector<string>({"li"}), closed);
+
+    parser.Feed(html.data() + 14, html.size() - 14);
+    ASSERT_EQ(vector<string>({"li", "li", "ul"}), closed);
+    ASSERT_EQ("<ul><li>a</li><li>b</li></ul>", parser.Finish()->html());
+}
+
+TEST(incremental, finishWithoutDataIsEmpty) {
+    HtmlParser parser;
+    ASSERT_EQ("", parser.Finish()->html());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_json.hpp"
+
+using namespace std;
+
+static string Escape(const string &s) {
+    string out;
+    HtmlJsonWriter::Escape(s.data(), s.size(), out);
+    return out;
+}
+
+TEST(json, escape) {
+    ASSERT_EQ("plain \xe4\xb8\xad", Escape("plain \xe4\xb8\xad"));
+    ASSERT_EQ("a\\\"b\\\\c\\n\\r\\t\\b\\f\\u0001\\u001f\x7f", Escape("a\"b\\c\n\r\t\b\f\x01\x1f\x7f"));
+    ASSERT_EQ("\\u0000", Escape(string(1, '\0')));
+
+    // every position in and across the blocks read at once
+    for (size_t len = 1; len < 40; len++) {
+        for (size_t at = 0; at < len; at++) {
+            string s(len, 'x');
+            s[at] = '"';
+            string expected(len + 1, 'x');
+            expected.replace(at, 2, "\\\"");
+            ASSERT_EQ(expected, Escape(s)) << len << " " << at;
+        }
+    }
+}
+
+TEST(json, document) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(
+            "<html><head><script>if (a < \"b\") x();</script></head>"
+            "<body><a href=\"/x?a=1&amp;b=2\" id=\"l\">Tom &amp; \"Jerry\"</a><br/></body></html>");
+    ASSERT_EQ("[{\"name\":\"html\",\"attributes\":{},\"children\":["
+              "{\"name\":\"head\",\"attributes\":{},\"children\":["
+              "{\"name\":\"script\",\"attributes\":{},\"value\":\"if (a < \\\"b\\\") x();\",\"children\":[]}]},"
+              "{\"name\":\"body\",\"attributes\":{},\"children\":["
+              "{\"name\":\"a\",\"attributes\":{\"href\":\"/x?a=1&b=2\",\"id\":\"l\"},\"children\":[\"Tom & \\\"Jerry\\\"\"]},"
+              "{\"name\":\"br\",\"attributes\":{},\"children\":[]}]}]}]",
+              HtmlJsonWriter::ToJson(doc));
+}
+
+TEST(json, fields) {
+    HtmlParser parser;
+    parser.SetSourceSpans(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html>\n<ul><li class=\"a\">one</li><li>two <b>2</b></li></ul></html>");
+    vector<shared_ptr<HtmlElement> > li = doc->SelectElement("//li");
+
+    ASSERT_EQ("[{\"name\":\"li\",\"text\":\"one\"},{\"name\":\"li\",\"text\":\"two 2\"}]",
+              HtmlJsonWriter::ToJson(li, HTML_JSON_PLAIN_TEXT));
+    ASSERT_EQ("{\"name\":\"li\",\"children\":[{\"name\":\"b\",\"children\":[]}]}",
+              HtmlJsonWriter::ToJson(li[1], HTML_JSON_CHILDREN));
+    ASSERT_EQ("{\"name\":\"li\",\"attributes\":{\"class\":\"a\"},\"position\":{\"begin\":11,\"end\":33,\"line\":2,\"column\":5}}",
+              HtmlJsonWriter::ToJson(li[0], HTML_JSON_ATTRIBUTES | HTML_JSON_POSITIONS));
+}
+
+TEST(json, streamsToSink) {
+    string html = "<html><ul>";
+    for (int i = 0; i < 2000; i++) html += "<li data-i=\"" + to_string(i) + "\">item \"" + to_string(i) + "\"</li>";
+    html += "</ul></html>";
+
+    HtmlParser parser;
+    parser.SetLazySubtrees(2);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    string whole = HtmlJsonWriter::ToJson(doc);
+
+    string streamed;
+    size_t calls = 0;
+    {
+        HtmlJsonWriter writer([&](const char *data, size_t len) {
+            streamed.append(data, len);
+            calls++;
+        }, HTML_JSON_DEFAULT, 1024);
+        writer.Write(doc);
+    }
+
+    ASSERT_EQ(whole, streamed);
+    ASSERT_GT(calls, whole.size() / 2048);
+    ASSERT_NE(string::npos, whole.find("{\"name\":\"li\",\"attributes\":{\"data-i\":\"1999\"},\"children\":[\"item \\\"1999\\\"\"]}"));
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static string Page() {
+    string html = "<html><body>";
+    for (int i = 0; i < 200; i++) {
+        html += "<div id=\"d" + to_string(i) + "\" class=\"item c" + to_string(i % 3) + "\" data-n=" +
+                to_string(i) + "><a href='/p/" + to_string(i) + "'>x</a></div>";
+    }
+    return html + "</body></html>";
+}
+
+TEST(lazyAttribute, sameResultsAsEager) {
+    string html = Page();
+    HtmlParser eager;
+    HtmlParser lazy;
+    lazy.SetLazyAttributes(true);
+    shared_ptr<HtmlDocument> a = eager.Parse(html);
+    shared_ptr<HtmlDocument> b = lazy.Parse(html);
+
+    ASSERT_EQ("/p/7", b->GetElementById("d7")->ChildBegin()[0]->GetAttribute("href"));
+    ASSERT_EQ(a->GetElementByClassName("c1").size(), b->GetElementByClassName("c1").size());
+    ASSERT_EQ(a->SelectElement("//div[@data-n='42']/a")[0]->text(), b->SelectElement("//div[@data-n='42']/a")[0]->text());
+    ASSERT_EQ(a->html(), b->html());
+}
+
+TEST(lazyAttribute, parsedOnFirstAccess) {
+    HtmlParser parser;
+    parser.SetLazyAttributes(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(Page());
+    shared_ptr<HtmlElement> div = doc->GetElementByTagName("div")[0];
+
+    // the text is kept until something reads the attributes
+    size_t before = doc->MemoryUsage().attributes;
+    ASSERT_EQ("item c0", div->GetAttribute("class"));
+    HtmlElement::AttributeIterator it = div->AttributeBegin();
+    ASSERT_EQ("class", it->first);
+    ASSERT_EQ(3, distance(div->AttributeBegin(), div->AttributeEnd()));
+    ASSERT_NE(before, doc->MemoryUsage().attributes);
+}
+
+TEST(lazyAttribute, concurrentFirstAccess) {
+    HtmlParser parser;
+    parser.SetLazyAttributes(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(Page());
+    vector<shared_ptr<HtmlElement> > divs = doc->GetElementByTagName("div");
+
+    vector<thread> threads;
+    vector<size_t> found(4, 0);
+    for (size_t t = 0; t < found.size(); t++) {
+        threads.push_back(thread([&divs, &found, t] {
+            for (size_t i = 0; i < divs.size(); i++) {
+                if (divs[i]->GetAttribute("data-n") == to_string(i)) found[t]++;
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) threads[t].join();
+
+    for (size_t t = 0; t < found.size(); t++) ASSERT_EQ(divs.size(), found[t]);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static string Page() {
+    string html = "<html><head><title>t</title></head><body>";
+    for (int i = 0; i < 50; i++) {
+        html += "<div id=\"s" + to_string(i) + "\" class=\"section\"><ul>";
+        for (int j = 0; j < 20; j++) {
+            html += "<li class=\"item\"><a href=\"/" + to_string(j) + "\">item " + to_string(j) + "</a><br></li>";
+        }
+        // recovery inside a lazy subtree: unclosed <p>, stray </span>, tags inside a script
+        html += "</ul><p>open <b>bold</span></b><script>var s = '<div>';</script></div>";
+    }
+    return html + "<div id=\"content\"><table><tr><td>a</td><td>b</td></tr></table></div></body></html>";
+}
+
+TEST(lazySubtree, sameResultsAsEager) {
+    string html = Page();
+    cerr.setstate(ios::failbit);
+    HtmlParser eager;
+    shared_ptr<HtmlDocument> a = eager.Parse(html);
+    for (size_t depth = 1; depth <= 4; depth++) {
+        HtmlParser lazy;
+        lazy.SetLazySubtrees(depth, 64);
+        shared_ptr<HtmlDocument> b = lazy.Parse(html);
+
+        // drill in first, then compare everything
+        ASSERT_EQ(a->SelectElement("//div[@id='content']//td").size(), b->SelectElement("//div[@id='content']//td").size());
+        ASSERT_EQ(a->GetElementById("s7")->text(), b->GetElementById("s7")->text());
+        ASSERT_EQ(a->GetElementByClassName("item").size(), b->GetElementByClassName("item").size());
+        ASSERT_EQ(a->html(), b->html());
+        ASSERT_EQ(a->text(), b->text());
+    }
+    cerr.clear();
+}
+
+TEST(lazySubtree, childrenBuiltOnFirstAccess) {
+    HtmlParser parser;
+    parser.SetLazySubtrees(3, 0);
+    cerr.setstate(ios::failbit);
+    shared_ptr<HtmlDocument> doc = parser.Parse(Page());
+    cerr.clear();
+
+    // <html> and <body> are built, the sections are built without children
+    size_t before = doc->MemoryUsage().nodes;
+    shared_ptr<HtmlElement> html = *doc->GetRoot()->ChildBegin();
+    shared_ptr<HtmlElement> body = html->ChildBegin()[1];
+    shared_ptr<HtmlElement> section = body->ChildBegin()[3];
+    ASSERT_EQ("s3", section->GetAttribute("id"));
+    ASSERT_EQ(before, doc->MemoryUsage().nodes);
+
+    // the <ul> and its items are built now
+    shared_ptr<HtmlElement> ul = *section->ChildBegin();
+    ASSERT_EQ("ul", ul->GetName());
+    ASSERT_EQ(20, ul->ChildEnd() - ul->ChildBegin());
+    ASSERT_LT(before, doc->MemoryUsage().nodes);
+    ASSERT_EQ("item 4", (*ul->ChildBegin()[4]->ChildBegin())->text());
+}
+
+TEST(lazySubtree, smallContentIsBuiltRightAway) {
+    HtmlParser parser;
+    parser.SetLazySubtrees(1, 1 << 20);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<div><p>a</p></div>");
+    size_t nodes = doc->MemoryUsage().nodes;
+    ASSERT_EQ("a", doc->GetElementByTagName("p")[0]->text());
+    ASSERT_EQ(nodes, doc->MemoryUsage().nodes);
+}
+
+TEST(lazySubtree, sourceCountedOncePerDocument) {
+    string html = Page();
+    HtmlParser parser;
+    parser.SetLazySubtrees(3, 0);
+    cerr.setstate(ios::failbit);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    cerr.clear();
+
+    // every section holds the one copy of the input
+    HtmlMemoryUsage usage = doc->MemoryUsage();
+    ASSERT_GE(usage.source, html.size());
+    ASSERT_LT(usage.source, html.size() * 2);
+
+    // released when the last subtree is built
+    HtmlVisitor visitor;
+    doc->GetRoot()->Walk(visitor);
+    ASSERT_EQ(0u, doc->MemoryUsage().source);
+}
+
+TEST(lazySubtree, concurrentFirstAccess) {
+    string html = Page();
+    cerr.setstate(ios::failbit);
+    HtmlParser eager;
+    string expected = eager.Parse(html)->text();
+    HtmlParser lazy;
+    lazy.SetLazySubtrees(2, 0);
+    shared_ptr<HtmlDocument> doc = lazy.Parse(html);
+    cerr.clear();
+
+    vector<string> text(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < text.size(); t++) {
+        threads.push_back(thread([&doc, &text, t] { text[t] = doc->text(); }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) threads[t].join();
+
+    for (size_t t = 0; t < text.size(); t++) ASSERT_EQ(expected, text[t]);
+}
+
+TEST(lazySubtree, documentsExpandIndependently) {
+    string html = Page();
+    cerr.setstate(ios::failbit);
+    HtmlParser eager;
+    string expected = eager.Parse(html)->text();
+    HtmlParser lazy;
+    lazy.SetLazySubtrees(2, 0);
+    vector<shared_ptr<HtmlDocument> > docs;
+    for (size_t t = 0; t < 4; t++) docs.push_back(lazy.Parse(html));
+    cerr.clear();
+
+    // every thread reads its own document and one shared with the next
+    vector<string> text(docs.size() * 2);
+    vector<thread> threads;
+    for (size_t t = 0; t < docs.size(); t++) {
+        threads.push_back(thread([&docs, &text, t] {
+            text[t * 2] = docs[t]->text();
+            text[t * 2 + 1] = docs[(t + 1) % docs.size()]->text();
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) threads[t].join();
+
+    for (size_t t = 0; t < text.size(); t++) ASSERT_EQ(expected, text[t]);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
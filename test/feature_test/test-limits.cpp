@@ -0,0 +1,95 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+TEST(limits, unlimitedByDefault) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse("<div a=\"1\" b=\"2\"><p>" + string(1000, 'x') + "</p></div>");
+    ASSERT_EQ(0u, parser.GetExceededLimits());
+    ASSERT_EQ(1000u, doc->GetElementByTagName("p")[0]->text().size());
+}
+
+TEST(limits, depthIgnoresDeeperTags) {
+    HtmlParseLimits limits;
+    limits.max_depth = 2;
+    HtmlParser parser;
+    parser.SetLimits(limits);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><body><div><span>deep</span></div>tail</body></html>");
+
+    ASSERT_EQ(HTML_LIMIT_DEPTH, parser.GetExceededLimits());
+    ASSERT_TRUE(doc->GetElementByTagName("div").empty());
+    ASSERT_TRUE(doc->GetElementByTagName("span").empty());
+    shared_ptr<HtmlElement> body = doc->GetElementByTagName("body")[0];
+    ASSERT_EQ("deeptail", body->text());
+}
+
+TEST(limits, nodesStopAndCloseOpenElements) {
+    HtmlParseLimits limits;
+    limits.max_nodes = 4;
+    HtmlParser parser;
+    parser.SetLimits(limits);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><body><p>a</p><p>b</p><p>c</p></body></html>");
+
+    ASSERT_EQ(HTML_LIMIT_NODES, parser.GetExceededLimits());
+    ASSERT_EQ(1u, doc->GetElementByTagName("html").size());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+    ASSERT_EQ("a", doc->GetElementByTagName("body")[0]->text());
+
+    // the same bound holds when fed chunk by chunk
+    parser.Feed("<html><body><p>a</p>", 20);
+    parser.Feed("<p>b</p><p>c</p></body></html>", 30);
+    doc = parser.Finish();
+    ASSERT_EQ(HTML_LIMIT_NODES, parser.GetExceededLimits());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+}
+
+TEST(limits, attributesAndNamesAreCut) {
+    HtmlParseLimits limits;
+    limits.max_attributes = 2;
+    limits.max_attribute_length = 4;
+    limits.max_name_length = 3;
+    HtmlParser parser;
+    parser.SetLimits(limits);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<abcdef a=\"123456\" b=x c=y d=z></abcdef><p longname=1></p>");
+
+    ASSERT_EQ(unsigned(HTML_LIMIT_ATTRIBUTES | HTML_LIMIT_ATTRIBUTE_LENGTH | HTML_LIMIT_NAME_LENGTH),
+              parser.GetExceededLimits());
+    vector<shared_ptr<HtmlElement> > e = doc->GetElementByTagName("abc");
+    ASSERT_EQ(1u, e.size());
+    ASSERT_EQ("1234", e[0]->GetAttribute("a"));
+    ASSERT_EQ("x", e[0]->GetAttribute("b"));
+    ASSERT_EQ("", e[0]->GetAttribute("c"));
+    ASSERT_EQ("1", doc->GetElementByTagName("p")[0]->GetAttribute("lon"));
+}
+
+TEST(limits, textIsCut) {
+    HtmlParseLimits limits;
+    limits.max_text_length = 8;
+    HtmlParser parser;
+    parser.SetLimits(limits);
+    shared_ptr<HtmlDocument> doc = parser.Parse("<div>" + string(100, 'x') + "<b>y</b></div><script>" +
+                                                string(100, 'z') + "</script>");
+
+    ASSERT_EQ(HTML_LIMIT_TEXT_LENGTH, parser.GetExceededLimits());
+    ASSERT_EQ(string(8, 'x') + "y", doc->GetElementByTagName("div")[0]->text());
+    ASSERT_EQ(string(8, 'z'), doc->GetElementByTagName("script")[0]->GetValue());
+
+    // a huge attribute is not held while it is read
+    parser.SetLimits(HtmlParseLimits());
+    limits = HtmlParseLimits();
+    limits.max_attributes = 1;
+    limits.max_attribute_length = 16;
+    limits.max_name_length = 16;
+    parser.SetLimits(limits);
+    doc = parser.Parse("<p a=\"" + string(1 << 20, 'v') + "\">t</p>");
+    ASSERT_EQ(16u, doc->GetElementByTagName("p")[0]->GetAttribute("a").size());
+    ASSERT_EQ("t", doc->GetElementByTagName("p")[0]->text());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include "html_parser.hpp"
+#include "html_parser_rewriter.hpp"
+
+using namespace std;
+
+static string Repeat(const string &s, size_t n) {
+    string r;
+    r.reserve(s.size() * n);
+    for (size_t i = 0; i < n; i++) r += s;
+    return r;
+}
+
+/**
+ * best of several runs, in nanoseconds per input byte
+ */
+static double NanosPerByte(const function<void(const string &)> &run, const string &input) {
+    double best = 1e18;
+    for (int i = 0; i < 5; i++) {
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        run(input);
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - begin).count();
+        best = min(best, ns);
+    }
+
+    return best / input.size();
+}
+
+/**
+ * input(scale) grows linearly with scale, the cost per byte must not
+ * grow with it. a quadratic path would show a 4x ratio here.
+ */
+static void ExpectLinear(const function<string(size_t)> &input, const function<void(const string &)> &run) {
+    cerr.setstate(ios::failbit);
+    string small = input(5000);
+    string large = input(20000);
+    double a = NanosPerByte(run, small);
+    double b = NanosPerByte(run, large);
+    cerr.clear();
+    EXPECT_LT(b, a * 2.5) << "small " << a << " ns/byte, large " << b << " ns/byte";
+}
+
+static void Parse(const string &html) {
+    HtmlParser parser;
+    parser.Parse(html);
+}
+
+static void Feed(const string &html) {
+    HtmlParser parser;
+    for (size_t i = 0; i < html.size(); i += 16) {
+        parser.Feed(html.data() + i, min<size_t>(16, html.size() - i));
+    }
+    parser.Finish();
+}
+
+TEST(linear, unclosedTagsAndStrayCloseTags) {
+    ExpectLinear([](size_t n) { return Repeat("<div>", n) + Repeat("</span>", n); }, Parse);
+    ExpectLinear([](size_t n) { return Repeat("<div><p>", n) + Repeat("</td>", n) + Repeat("</p>", n); }, Parse);
+}
+
+TEST(linear, closeTagClosingManyElements) {
+    ExpectLinear([](size_t n) {
+        string name(n, 'x');
+        return "<" + name + ">" + Repeat("<b>", n) + "</" + name + ">";
+    }, Parse);
+    ExpectLinear([](size_t n) {
+        string name(n, 'x');
+        return "<" + name + ">" + Repeat("<b>", n) + "</" + name + ">";
+    }, Feed);
+}
+
+TEST(linear, commentLikeSequences) {
+    ExpectLinear([](size_t n) { return "<p><!--" + Repeat("- -", n) + "</p>"; }, Parse);
+    ExpectLinear([](size_t n) { return "<p>" + Repeat("<!-", n) + "</p>"; }, Parse);
+    ExpectLinear([](size_t n) { return "<p></" + string(n * 4, 'x'); }, Feed);
+    ExpectLinear([](size_t n) { return "<script>" + Repeat("</scrip", n) + "</script>"; }, Feed);
+}
+
+TEST(linear, queries) {
+    HtmlParser parser;
+    ExpectLinear([](size_t n) { return "<html>" + Repeat("<div class=\"a\"></div>", n) + "</html>"; },
+                 [&parser](const string &html) {
+                     shared_ptr<HtmlDocument> doc = parser.Parse(html);
+                     doc->GetElementByTagName("div");
+                     doc->GetElementByClassName("a");
+                     doc->SelectElement("//div");
+                 });
+    ExpectLinear([](size_t n) { return Repeat("<div>", n / 4) + "<p></p>" + Repeat("</div>", n / 4); },
+                 [&parser](const string &html) {
+                     shared_ptr<HtmlDocument> doc = parser.Parse(html);
+                     ASSERT_EQ(1u, doc->SelectElement("//div//div//p").size());
+                 });
+    ExpectLinear([](size_t n) { return Repeat("<p><b></b></p>", n / 4); },
+                 [&parser](const string &html) {
+                     shared_ptr<HtmlDocument> doc = parser.Parse(html);
+                     doc->SelectElement("//b");
+                     doc->SelectElement("/p/b");
+                 });
+}
+
+static void Rewrite(const string &html) {
+    HtmlRewriter rewriter([](const char *, size_t) {});
+    rewriter.On("b", [](HtmlRewriteElement &e) { e.Append("!"); });
+    rewriter.Write(html);
+    rewriter.End();
+}
+
+TEST(linear, rewriterCloseTags) {
+    ExpectLinear([](size_t n) { return Repeat("<div>", n) + Repeat("</span>", n); }, Rewrite);
+    ExpectLinear([](size_t n) { return Repeat("<div><b>", n) + Repeat("</div>", n); }, Rewrite);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
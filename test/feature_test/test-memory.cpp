@@ -0,0 +1,53 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+TEST(memory, reportsUsageByCategory) {
+    string text(1000, 'x');
+    string html = "<html><body><div class=\"a long class attribute value\">" + text + "</div>";
+    for (int i = 0; i < 100; i++) {
+        html += "<p id=\"paragraph-" + to_string(i) + "\"><b>short</b></p>";
+    }
+    html += "</body></html>";
+
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    HtmlMemoryUsage usage = doc->MemoryUsage();
+
+    ASSERT_GE(usage.text, text.size());
+    ASSERT_GE(usage.nodes, 300 * sizeof(HtmlElement));
+    ASSERT_GE(usage.attributes, 101 * 2 * sizeof(string));
+    ASSERT_GT(usage.containers, 0u);
+    ASSERT_EQ(0u, usage.source);
+    ASSERT_EQ(usage.nodes + usage.names + usage.text + usage.attributes + usage.containers + usage.source,
+              usage.Total());
+}
+
+TEST(memory, compactReleasesSpareCapacity) {
+    string html = "<div><p>" + string(5000, 'y') + "</p>";
+    for (int i = 0; i < 50; i++) {
+        html += "<span title=\"" + string(100, 't') + "\">s</span>";
+    }
+    html += "</div>";
+
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    string before = doc->html();
+    HtmlMemoryUsage loose = doc->MemoryUsage();
+
+    doc->Compact();
+    HtmlMemoryUsage tight = doc->MemoryUsage();
+
+    ASSERT_LT(tight.text, loose.text);
+    ASSERT_LE(tight.attributes, loose.attributes);
+    ASSERT_LT(tight.Total(), loose.Total());
+    ASSERT_EQ(before, doc->html());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <chrono>
+#include "html_parser_parallel.hpp"
+
+using namespace std;
+
+static string CatalogPage(int items) {
+    string html("<html><head><title>catalog</title></head><body><div id=\"main\">");
+    for (int i = 0; i < items; i++) {
+        html += "<div class=\"item c" + to_string(i % 7) + "\"><span class=\"name\">n" + to_string(i) + "</span>";
+        html += "<ul><li>a</li><li><ul><li>b</li></ul></li></ul><img src=\"" + to_string(i) + "\"></div>";
+    }
+    html += "</div></body></html>";
+    return html;
+}
+
+TEST(parallel, matchesSerialQueries) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(CatalogPage(500));
+    HtmlParallelQuery query(doc, 4, 0);
+
+    ASSERT_EQ(doc->GetElementByClassName("item c3"), query.GetElementByClassName("item c3"));
+    ASSERT_EQ(doc->GetElementByTagName("li"), query.GetElementByTagName("li"));
+    ASSERT_EQ(doc->SelectElement("//div"), query.SelectElement("//div"));
+    ASSERT_EQ(doc->SelectElement("//div/span[@class='name']"), query.SelectElement("//div/span[@class='name']"));
+    ASSERT_EQ(doc->SelectElement("//ul//li"), query.SelectElement("//ul//li"));
+    ASSERT_EQ(doc->SelectElement("/html/body/div"), query.SelectElement("/html/body/div"));
+    ASSERT_EQ(500u, query.GetElementByTagName("img").size());
+}
+
+TEST(parallel, staysSerialBelowThreshold) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(CatalogPage(3));
+    HtmlParallelQuery query(doc, 4);
+
+    // text nodes are elements too
+    ASSERT_EQ(6u + 3u * 11u, query.Size());
+    ASSERT_EQ(doc->SelectElement("//li"), query.SelectElement("//li"));
+}
+
+static string Repeat(const string &s, size_t n) {
+    string r;
+    for (size_t i = 0; i < n; i++) r += s;
+    return r;
+}
+
+/**
+ * best of several runs, in milliseconds
+ */
+template<typename Run>
+static double Millis(Run run) {
+    double best = 1e18;
+    for (int i = 0; i < 3; i++) {
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        run();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count());
+    }
+
+    return best;
+}
+
+TEST(parallel, nestedDescendantStepsStayLinear) {
+    string html = "<html><body>" + Repeat("<div><a>x</a>", 3000) + Repeat("</div>", 3000) + "</body></html>";
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    HtmlParallelQuery query(doc, 4, 0);
+
+    ASSERT_EQ(doc->SelectElement("//div//a"), query.SelectElement("//div//a"));
+    ASSERT_EQ(doc->SelectElement("//div/div//a"), query.SelectElement("//div/div//a"));
+
+    // a fresh state per element walked every subtree again, about 600 times slower
+    double serial = Millis([&doc]() { doc->SelectElement("//div//a"); });
+    double parallel = Millis([&query]() { query.SelectElement("//div//a"); });
+    EXPECT_LT(parallel, serial * 20 + 20) << "serial " << serial << " ms, parallel " << parallel << " ms";
+}
+
+TEST(parallel, deepDocuments) {
+    const size_t depth = 200000;
+    string html = "<html>" + Repeat("<div>", depth) + "<p>deep</p>" + Repeat("</div>", depth) + "</html>";
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    HtmlParallelQuery query(doc, 4, 0);
+
+    ASSERT_EQ(depth + 3, query.Size());
+    ASSERT_EQ(depth, query.GetElementByTagName("div").size());
+    ASSERT_EQ(1u, query.SelectElement("//p").size());
+}
+
+TEST(parallel, poolRunsEveryTaskOnce) {
+    HtmlWorkStealingPool pool(3);
+    for (int round = 0; round < 20; round++) {
+        vector<int> hits(97, 0);
+        pool.Run(hits.size(), [&hits](size_t i) { hits[i]++; });
+        ASSERT_EQ(vector<int>(97, 1), hits);
+    }
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
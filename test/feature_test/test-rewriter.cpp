@@ -0,0 +1,95 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_rewriter.hpp"
+
+using namespace std;
+
+static string Rewrite(HtmlRewriter &rewriter, string &out, const string &html, size_t chunk) {
+    out.clear();
+    for (size_t i = 0; i < html.size(); i += chunk) {
+        rewriter.Write(html.data() + i, min(chunk, html.size() - i));
+    }
+    rewriter.End();
+    return out;
+}
+
+static const string page =
+        "<html><head><title>t</title><script src=\"track.js\">track('<a>');</script></head>"
+        "<body><!-- <a href=\"c\"> --><p>x <a href=\"/p\" class=\"q\">y</a></p><img src=\"i.png\">"
+        "<ul><li>a<li>b</ul></body></html>";
+
+TEST(rewriter, passesThroughUnchanged) {
+    string out;
+    HtmlRewriter rewriter([&out](const char *data, size_t len) { out.append(data, len); });
+    rewriter.On("b", [](HtmlRewriteElement &e) { e.SetAttribute("x", "1"); });
+
+    string html = page + "<p>1 < 2 <3 </x> <!doctype html> <?php ?> unclosed <a";
+    for (size_t chunk = 1; chunk < 8; chunk++) {
+        ASSERT_EQ(html, Rewrite(rewriter, out, html, chunk));
+    }
+}
+
+TEST(rewriter, attributesRemovalAndInsertion) {
+    string out;
+    HtmlRewriter rewriter([&out](const char *data, size_t len) { out.append(data, len); });
+    rewriter.On("a[@href]", [](HtmlRewriteElement &e) {
+        e.SetAttribute("href", "http://example.com" + e.GetAttribute("href"));
+    });
+    rewriter.On("img", [](HtmlRewriteElement &e) {
+        e.SetAttribute("alt", "say \"hi\"");
+        e.RemoveAttribute("src");
+    });
+    rewriter.On("script[@src='track.js']", [](HtmlRewriteElement &e) { e.Remove(); });
+    rewriter.On("head", [](HtmlRewriteElement &e) { e.Append("<base href=\"/\">"); });
+    rewriter.On("p", [](HtmlRewriteElement &e) {
+        e.Before("[");
+        e.After("]");
+        e.Prepend("(");
+        e.Append(")");
+    });
+
+    string expected =
+            "<html><head><title>t</title><base href=\"/\"></head>"
+            "<body><!-- <a href=\"c\"> -->[<p>(x <a class=\"q\" href=\"http://example.com/p\">y</a>)</p>]<img alt='say \"hi\"'>"
+            "<ul><li>a<li>b</ul></body></html>";
+    ASSERT_EQ(expected, Rewrite(rewriter, out, page, page.size()));
+    ASSERT_EQ(expected, Rewrite(rewriter, out, page, 3));
+}
+
+TEST(rewriter, elementsEndLikeTheParserEndsThem) {
+    string out;
+    HtmlRewriter rewriter([&out](const char *data, size_t len) { out.append(data, len); });
+    rewriter.On("li", [](HtmlRewriteElement &e) { e.Append("!"); });
+    rewriter.On("div", [](HtmlRewriteElement &e) { e.Remove(); });
+
+    // closed by the close tag of the parent, by the end of input, a stray close tag is kept
+    ASSERT_EQ("<ul><li>a!</ul></span><p>x", Rewrite(rewriter, out, "<ul><li>a</ul></span><div><p>y</div><p>x", 4));
+    ASSERT_EQ("<ul><li>a!</li><li>b!", Rewrite(rewriter, out, "<ul><li>a</li><li>b<div>open", 5));
+
+    // close tag names are taken whole, as the parser takes them: these close nothing
+    ASSERT_EQ("<ul><li>a</ul ></li/></ul/>!", Rewrite(rewriter, out, "<ul><li>a</ul ></li/></ul/>", 3));
+    HtmlParser parser;
+    ASSERT_EQ("<html><ul><li>a</li></ul></html>", parser.Parse("<html><ul><li>a</ul ></li/></ul/></html>")->html());
+}
+
+TEST(rewriter, streamsWithoutHoldingThePage) {
+    size_t written = 0;
+    HtmlRewriter rewriter([&written](const char *, size_t len) { written += len; });
+    rewriter.On("a", [](HtmlRewriteElement &e) { e.SetAttribute("rel", "nofollow"); });
+
+    string item = "<div class=\"item\"><a href=\"/x\">link</a> some text</div>\n";
+    rewriter.Write("<html><body>");
+    for (int i = 0; i < 10000; i++) {
+        rewriter.Write(item);
+        // everything but a tag cut at the chunk end is written at once
+        ASSERT_EQ(12u + (i + 1) * (item.size() + 15), written);
+    }
+    rewriter.Write("</body></html>");
+    rewriter.End();
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
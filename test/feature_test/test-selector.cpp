@@ -0,0 +1,94 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser_selector.hpp"
+
+using namespace std;
+
+static string CatalogPage(int items) {
+    string html("<html><head><title>catalog</title></head><body><div id=\"main\">");
+    for (int i = 0; i < items; i++) {
+        html += "<div class=\"item c" + to_string(i % 7) + "\"><span class=\"name\">n" + to_string(i) + "</span>";
+        html += "<ul><li>a</li><li><ul><li>b</li></ul></li></ul><img src=\"" + to_string(i) + "\"></div>";
+    }
+    html += "</div></body></html>";
+    return html;
+}
+
+TEST(selector, matchesSelectElement) {
+    const char *rules[] = {"//div", "//div/span[@class='name']", "//ul//li", "/html/body/div", "//div[@class='c3']",
+                           "//*[!@class]", "//div[@class!='c3']//img", "//", "/html//ul/li/ul/li", "//ul///li",
+                           "//li[@class='x']", "body", ""};
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(CatalogPage(50));
+
+    HtmlSelectorSet set;
+    for (size_t i = 0; i < sizeof(rules) / sizeof(rules[0]); i++) {
+        ASSERT_EQ(i, set.Add(rules[i]));
+    }
+
+    HtmlSelectorSet::Results results = set.Select(doc);
+    ASSERT_EQ(set.Size(), results.size());
+    for (size_t i = 0; i < results.size(); i++) {
+        ASSERT_EQ(doc->SelectElement(rules[i]), results[i]) << rules[i];
+    }
+    ASSERT_EQ(50u, results[1].size());
+    ASSERT_TRUE(results[11].empty());
+}
+
+TEST(selector, selectFromElement) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(CatalogPage(10));
+    shared_ptr<HtmlElement> main = doc->GetElementById("main");
+
+    HtmlSelectorSet set;
+    set.Add("/div//li");
+    set.Add("//img");
+    set.Add("/span");
+    HtmlSelectorSet::Results results = set.Select(main);
+
+    vector<shared_ptr<HtmlElement> > expected;
+    main->SelectElement("/div//li", expected);
+    ASSERT_EQ(expected, results[0]);
+    expected.clear();
+    main->SelectElement("//img", expected);
+    ASSERT_EQ(expected, results[1]);
+    ASSERT_EQ(10u, results[1].size());
+    ASSERT_TRUE(results[2].empty());
+}
+
+TEST(selector, documentOrder) {
+    // SelectElement visits the <p> children of the outer <div> before the nested one
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><div><p id=\"1\"><div><p id=\"2\"></p></div></p><p id=\"3\"></p></div></html>");
+
+    HtmlSelectorSet set;
+    set.Add("//div/p");
+    HtmlSelectorSet::Results results = set.Select(doc);
+
+    ASSERT_EQ(3u, results[0].size());
+    ASSERT_EQ("1", results[0][0]->GetAttribute("id"));
+    ASSERT_EQ("2", results[0][1]->GetAttribute("id"));
+    ASSERT_EQ("3", results[0][2]->GetAttribute("id"));
+}
+
+TEST(selector, lazySubtrees) {
+    HtmlParser parser;
+    parser.SetLazySubtrees(3, 0);
+    shared_ptr<HtmlDocument> doc = parser.Parse(CatalogPage(100));
+    size_t nodes = doc->MemoryUsage().nodes;
+
+    HtmlSelectorSet set;
+    set.Add("/html/head/title");
+    HtmlSelectorSet::Results results = set.Select(doc);
+    ASSERT_EQ(1u, results[0].size());
+
+    // subtrees no rule can match in are not walked, so not built either
+    ASSERT_EQ(nodes, doc->MemoryUsage().nodes);
+    ASSERT_EQ("catalog", results[0][0]->text());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
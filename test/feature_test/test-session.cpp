@@ -0,0 +1,87 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static string Page(size_t items) {
+    string html = "<html><head><title>t</title><script>if (a < b) x();</script></head><body><ul>";
+    for (size_t i = 0; i < items; i++) {
+        html += "<li class=\"item\" data-n=\"" + to_string(i) + "\"><a href=\"/p/" + to_string(i) + "\">item &amp; " +
+                to_string(i) + "</a><!-- note --><br/></li>";
+    }
+    return html + "</ul></body></html>";
+}
+
+TEST(session, stepsMatchParse) {
+    string html = Page(50);
+    HtmlParser parser;
+    string whole = parser.Parse(html)->html();
+
+    size_t budgets[] = {1, 3, 7, 64, 1000, html.size()};
+    for (size_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++) {
+        HtmlParseSession session(parser, html);
+        size_t steps = 1;
+        size_t offset = 0;
+        while (!session.Step(budgets[i])) {
+            ASSERT_FALSE(session.GetDocument());
+            ASSERT_LE(offset, session.GetOffset());
+            offset = session.GetOffset();
+            steps++;
+        }
+
+        ASSERT_TRUE(session.Done());
+        ASSERT_EQ(html.size(), session.GetOffset());
+        ASSERT_EQ((html.size() + budgets[i] - 1) / budgets[i], steps) << budgets[i];
+        ASSERT_EQ(whole, session.GetDocument()->html()) << budgets[i];
+        ASSERT_TRUE(session.Step(1));
+    }
+}
+
+TEST(session, keepsOptions) {
+    string html = Page(20);
+    HtmlParser parser;
+    parser.SetLazySubtrees(3);
+    parser.SetSourceSpans(true);
+    parser.SetSkipTag("script", HTML_SKIP_ELEMENT);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+
+    HtmlParseSession session(parser, html);
+    while (!session.Step(5)) {}
+    shared_ptr<HtmlDocument> stepped = session.GetDocument();
+    ASSERT_EQ(doc->html(), stepped->html());
+    ASSERT_EQ(doc->SelectElement("//a")[7]->GetSourceSpan()->outer_begin,
+              stepped->SelectElement("//a")[7]->GetSourceSpan()->outer_begin);
+
+    // limits end the session early
+    HtmlParseLimits limits;
+    limits.max_nodes = 10;
+    HtmlParser limited;
+    limited.SetLimits(limits);
+    HtmlParseSession short_session(limited, html);
+    size_t steps = 1;
+    while (!short_session.Step(16)) steps++;
+    ASSERT_LT(steps, html.size() / 16);
+    ASSERT_EQ(limited.Parse(html)->html(), short_session.GetDocument()->html());
+}
+
+TEST(session, deadline) {
+    string html = Page(20000);
+    HtmlParser parser;
+    HtmlParseSession session(parser, html);
+    size_t steps = 1;
+    while (!session.Step(chrono::steady_clock::now() + chrono::microseconds(200))) steps++;
+    ASSERT_GT(steps, 1u);
+    ASSERT_EQ(20000u, session.GetDocument()->SelectElement("//li").size());
+
+    // a deadline already passed still makes progress
+    HtmlParseSession late(parser, html);
+    ASSERT_FALSE(late.Step(chrono::steady_clock::now() - chrono::seconds(1)));
+    ASSERT_LT(0u, late.GetOffset());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static const char *kPage =
+    "<html><body><div id=\"ad\"><svg class=\"icon\" width=\"10\"><g><svg viewBox=\"0\"><path d=\"M0\"/></svg></g>"
+    "<svg/></svg><script src=\"t.js\">track('</div>')</script><template id=\"t\"><p>a</p><p>b</p></template>"
+    "<p>kept</p></div></body></html>";
+
+static void Configure(HtmlParser &parser) {
+    parser.SetSkipTag("svg", HTML_SKIP_RAW, vector<string>({"class"}));
+    parser.SetSkipTag("script", HTML_SKIP_ELEMENT);
+    parser.SetSkipTag("template", HTML_SKIP_CONTENT, vector<string>({"id"}));
+}
+
+TEST(skip, keepsSkippedSubtreesAsRawSpans) {
+    HtmlParser parser;
+    Configure(parser);
+    shared_ptr<HtmlDocument> doc = parser.Parse(kPage);
+
+    vector<shared_ptr<HtmlElement> > svg = doc->GetElementByTagName("svg");
+    ASSERT_EQ(1u, svg.size());
+    ASSERT_EQ("<g><svg viewBox=\"0\"><path d=\"M0\"/></svg></g><svg/>", svg[0]->GetValue());
+    ASSERT_EQ("icon", svg[0]->GetAttribute("class"));
+    ASSERT_EQ("", svg[0]->GetAttribute("width"));
+    ASSERT_TRUE(doc->GetElementByTagName("path").empty());
+}
+
+TEST(skip, dropsContentOrWholeElements) {
+    HtmlParser parser;
+    Configure(parser);
+    shared_ptr<HtmlDocument> doc = parser.Parse(kPage);
+
+    ASSERT_TRUE(doc->GetElementByTagName("script").empty());
+    shared_ptr<HtmlElement> t = doc->GetElementById("t");
+    ASSERT_TRUE(t);
+    ASSERT_EQ("", t->GetValue());
+    ASSERT_TRUE(t->ChildBegin() == t->ChildEnd());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+    ASSERT_EQ("kept", doc->GetElementByTagName("p")[0]->text());
+}
+
+TEST(skip, sameResultWhenFedInChunks) {
+    HtmlParser parser;
+    Configure(parser);
+    string expected = parser.Parse(kPage)->html();
+
+    string html(kPage);
+    for (size_t chunk = 1; chunk < 6; chunk++) {
+        for (size_t i = 0; i < html.size(); i += chunk) {
+            parser.Feed(html.data() + i, min(chunk, html.size() - i));
+        }
+        ASSERT_EQ(expected, parser.Finish()->html());
+    }
+
+    parser.ClearSkipTags();
+    ASSERT_EQ(1u, parser.Parse(kPage)->GetElementByTagName("script").size());
+}
+
+TEST(skip, rawTextDoesNotNest) {
+    string html = "<html><body><script>document.write('<script src=a.js></scr'+'ipt>')</script><p>after</p></body></html>";
+    HtmlParser parser;
+    parser.SetSkipTag("script", HTML_SKIP_ELEMENT);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    ASSERT_TRUE(doc->GetElementByTagName("script").empty());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+    ASSERT_EQ("<html><body><p>after</p></body></html>", doc->html());
+
+    parser.SetSkipTag("script", HTML_SKIP_RAW);
+    doc = parser.Parse(html);
+    ASSERT_EQ("document.write('<script src=a.js></scr'+'ipt>')", doc->GetElementByTagName("script")[0]->GetValue());
+    ASSERT_EQ(1u, doc->GetElementByTagName("p").size());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
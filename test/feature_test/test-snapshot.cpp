@@ -0,0 +1,102 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include <chrono>
+#include "html_parser_snapshot.hpp"
+
+using namespace std;
+
+static const char *kPage =
+    "<html><head><title>snap</title><style>p {}</style></head><body>"
+    "<div id=\"main\" class=\"a b\"><p>one</p><p class=\"x\">two<br>three</p>"
+    "<table><tr><td>1</td><td>2</td></tr></table><ul><li>x</li><li><ul><li>y</li></ul></li></ul></div>"
+    "<img src=\"pic\"></body></html>";
+
+static vector<string> Html(const vector<shared_ptr<HtmlElement> > &elements) {
+    vector<string> out;
+    for (size_t i = 0; i < elements.size(); i++) out.push_back(elements[i]->GetName() + ":" + elements[i]->text());
+    return out;
+}
+
+static vector<string> Html(const vector<HtmlSnapshotNode> &nodes) {
+    vector<string> out;
+    for (size_t i = 0; i < nodes.size(); i++) out.push_back(nodes[i].GetName() + ":" + nodes[i].text());
+    return out;
+}
+
+TEST(snapshot, answersQueriesLikeTheDocument) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(kPage);
+    string image = HtmlSnapshot::Serialize(doc);
+    shared_ptr<HtmlSnapshot> snap = HtmlSnapshot::Load(image.data(), image.size());
+    ASSERT_TRUE(snap);
+
+    ASSERT_EQ(doc->text(), snap->text());
+    const char *rules[] = { "//p", "//ul//li", "/html/body/div/p[@class='x']", "//div[@class!='c']", "//[!@class]", "//img[@src]" };
+    for (size_t i = 0; i < sizeof(rules) / sizeof(rules[0]); i++) {
+        ASSERT_EQ(Html(doc->SelectElement(rules[i])), Html(snap->SelectElement(rules[i])));
+    }
+
+    HtmlSnapshotNode main = snap->GetElementById("main");
+    ASSERT_TRUE(main.Valid());
+    ASSERT_EQ("div", main.GetName());
+    ASSERT_EQ("a b", main.GetAttribute("class"));
+    ASSERT_EQ("body", main.GetParent().GetName());
+    ASSERT_EQ("one", main.Child(0).GetValue());
+    ASSERT_FALSE(snap->GetElementById("missing").Valid());
+}
+
+TEST(snapshot, nestedDescendantStepsStayLinear) {
+    string html = "<html><body>";
+    for (int i = 0; i < 3000; i++) html += "<div><a>x</a>";
+    for (int i = 0; i < 3000; i++) html += "</div>";
+    html += "</body></html>";
+
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    string image = HtmlSnapshot::Serialize(doc);
+    shared_ptr<HtmlSnapshot> snap = HtmlSnapshot::Load(image.data(), image.size());
+    ASSERT_TRUE(snap);
+    ASSERT_EQ(Html(doc->SelectElement("//div//a")), Html(snap->SelectElement("//div//a")));
+
+    // without the visited pairs every div walked its whole subtree again
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    doc->SelectElement("//div//a");
+    double tree = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+    begin = chrono::steady_clock::now();
+    snap->SelectElement("//div//a");
+    double flat = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+    EXPECT_LT(flat, tree * 20 + 20) << "document " << tree << " ms, snapshot " << flat << " ms";
+}
+
+TEST(snapshot, mapsSavedFile) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(kPage);
+    string path = testing::TempDir() + "page.snap";
+    ASSERT_TRUE(HtmlSnapshot::Save(doc, path));
+
+    shared_ptr<HtmlSnapshot> snap = HtmlSnapshot::Open(path);
+    ASSERT_TRUE(snap);
+    ASSERT_EQ(doc->text(), snap->text());
+    ASSERT_EQ("p {}", snap->SelectElement("//style")[0].GetValue());
+    remove(path.c_str());
+}
+
+TEST(snapshot, rejectsMalformedImages) {
+    HtmlParser parser;
+    string image = HtmlSnapshot::Serialize(parser.Parse(kPage));
+
+    string truncated = image.substr(0, image.size() - 1);
+    ASSERT_FALSE(HtmlSnapshot::Load(truncated.data(), truncated.size()));
+
+    string corrupt = image;
+    HtmlSnapshot::Node *node = (HtmlSnapshot::Node *) &corrupt[sizeof(HtmlSnapshot::Header)];
+    node[1].name = 0x7fffffff;
+    ASSERT_FALSE(HtmlSnapshot::Load(corrupt.data(), corrupt.size()));
+    ASSERT_FALSE(HtmlSnapshot::Open("/nonexistent/page.snap"));
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static const string html =
+        "<html>\n"
+        "<body>\n"
+        "  <div id=\"a\"><p>one <b>two</b></p><br><img src=\"x\"/></div>\n"
+        "  <ul><li>open\n"
+        "  </ul>\n"
+        "  <script>var s = '<b>';</script>\n"
+        "</body>\n"
+        "</html>\n";
+
+static shared_ptr<HtmlElement> Select(const shared_ptr<HtmlDocument> &doc, const string &rule) {
+    vector<shared_ptr<HtmlElement> > result = doc->SelectElement(rule);
+    return result.empty() ? shared_ptr<HtmlElement>() : result[0];
+}
+
+TEST(sourceSpan, outerAndInnerSource) {
+    HtmlParser parser;
+    parser.SetSourceSpans(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+
+    shared_ptr<HtmlElement> div = doc->GetElementById("a");
+    ASSERT_EQ("<div id=\"a\"><p>one <b>two</b></p><br><img src=\"x\"/></div>", div->OuterSource().str());
+    ASSERT_EQ("<p>one <b>two</b></p><br><img src=\"x\"/>", div->InnerSource().str());
+    ASSERT_EQ(html.data() + html.find("<div"), div->OuterSource().data);
+
+    ASSERT_EQ("<b>two</b>", Select(doc, "//b")->OuterSource().str());
+    ASSERT_EQ("var s = '<b>';", Select(doc, "//script")->InnerSource().str());
+
+    // no content: the inner span is empty at the end of the start tag
+    shared_ptr<HtmlElement> br = Select(doc, "//br");
+    ASSERT_EQ("<br>", br->OuterSource().str());
+    ASSERT_EQ(0u, br->InnerSource().size);
+    ASSERT_EQ("<img src=\"x\"/>", Select(doc, "//img")->OuterSource().str());
+
+    // closed by the close tag of its parent
+    ASSERT_EQ("<li>open\n  ", Select(doc, "//li")->OuterSource().str());
+    ASSERT_EQ("<ul><li>open\n  </ul>", Select(doc, "//ul")->OuterSource().str());
+
+    ASSERT_EQ(html.size() - 1, Select(doc, "/html")->GetSourceSpan()->outer_end);
+}
+
+TEST(sourceSpan, lineAndColumn) {
+    HtmlParser parser;
+    parser.SetSourceSpans(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+
+    const HtmlSourceSpan *span = Select(doc, "/html")->GetSourceSpan();
+    ASSERT_EQ(1u, span->line);
+    ASSERT_EQ(1u, span->column);
+
+    span = doc->GetElementById("a")->GetSourceSpan();
+    ASSERT_EQ(3u, span->line);
+    ASSERT_EQ(3u, span->column);
+
+    span = Select(doc, "//b")->GetSourceSpan();
+    ASSERT_EQ(3u, span->line);
+    ASSERT_EQ(22u, span->column);
+
+    span = Select(doc, "//script")->GetSourceSpan();
+    ASSERT_EQ(6u, span->line);
+    ASSERT_EQ(3u, span->column);
+}
+
+TEST(sourceSpan, offSpansAndTextChildren) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    ASSERT_TRUE(doc->GetElementById("a")->GetSourceSpan() == NULL);
+    ASSERT_EQ(0u, doc->GetElementById("a")->OuterSource().size);
+
+    parser.SetSourceSpans(true);
+    doc = parser.Parse(html);
+    shared_ptr<HtmlElement> p = Select(doc, "//p");
+    ASSERT_EQ("plain", (*p->ChildBegin())->GetName());
+    ASSERT_TRUE((*p->ChildBegin())->GetSourceSpan() == NULL);
+}
+
+TEST(sourceSpan, feedAndLazySubtrees) {
+    string page;
+    for (int i = 0; i < 2000; i++) page += "<div>\n<p>item " + to_string(i) + "</p></div>";
+
+    HtmlParser parser;
+    parser.SetSourceSpans(true);
+    vector<shared_ptr<HtmlElement> > eager = parser.Parse(page)->SelectElement("//p");
+
+    parser.SetLazySubtrees(1, 0);
+    vector<shared_ptr<HtmlElement> > lazy = parser.Parse(page)->SelectElement("//p");
+    parser.SetLazySubtrees(0);
+
+    for (size_t i = 0; i < page.size(); i += 100) parser.Feed(page.data() + i, min<size_t>(100, page.size() - i));
+    vector<shared_ptr<HtmlElement> > fed = parser.Finish()->SelectElement("//p");
+
+    ASSERT_EQ(2000u, eager.size());
+    ASSERT_EQ(eager.size(), lazy.size());
+    ASSERT_EQ(eager.size(), fed.size());
+    for (size_t i = 0; i < eager.size(); i++) {
+        const HtmlSourceSpan *a = eager[i]->GetSourceSpan();
+        const HtmlSourceSpan *b = lazy[i]->GetSourceSpan();
+        const HtmlSourceSpan *c = fed[i]->GetSourceSpan();
+        ASSERT_EQ(i + 2, a->line);
+        ASSERT_EQ(a->outer_begin, b->outer_begin);
+        ASSERT_EQ(a->outer_end, b->outer_end);
+        ASSERT_EQ(a->line, b->line);
+        ASSERT_EQ(a->column, b->column);
+        ASSERT_EQ(a->outer_begin, c->outer_begin);
+        ASSERT_EQ(a->inner_end, c->inner_end);
+        ASSERT_EQ(a->line, c->line);
+        ASSERT_EQ(a->column, c->column);
+        ASSERT_EQ(eager[i]->OuterSource().str(), lazy[i]->OuterSource().str());
+    }
+
+    // the chunks are gone after Feed, only the offsets are kept
+    ASSERT_TRUE(fed[0]->GetSourceSpan()->input == NULL);
+    ASSERT_EQ(0u, fed[0]->OuterSource().size);
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static const string kClean =
+        "<?xml version=\"1.0\"?>\n<!DOCTYPE html>\n<html><head><title>t</title>"
+        "<script>if (a < b && c) x();</script></head>\n<body>\n"
+        "<div id=\"main\" class='a b'><p>Tom &amp; Jerry\n</p><br/><img src=\"x.png\" />"
+        "<!-- note --><ul><li>one</li><li data-x=\"1\">two<b>!</b></li></ul></div></body></html>\n";
+
+TEST(strict, sameTreeOnCleanInput) {
+    HtmlParser recovering;
+    shared_ptr<HtmlDocument> expected = recovering.Parse(kClean);
+
+    HtmlParser parser;
+    parser.SetStrict(HTML_STRICT_ERROR);
+    shared_ptr<HtmlDocument> doc = parser.Parse(kClean);
+    ASSERT_EQ(string::npos, parser.GetStrictError());
+    ASSERT_EQ(expected->html(), doc->html());
+    ASSERT_EQ(expected->text(), doc->text());
+    ASSERT_EQ("Tom & Jerry", doc->SelectElement("//p")[0]->GetValue());
+    ASSERT_EQ("if (a < b && c) x();", doc->SelectElement("//script")[0]->GetValue());
+    ASSERT_EQ("a b", doc->GetElementById("main")->GetAttribute("class"));
+    ASSERT_EQ(doc->GetRoot(), doc->GetElementById("main")->GetParent()->GetParent()->GetParent());
+
+    // with the options it supports
+    recovering.SetSubtreeHashes(true);
+    recovering.SetLazyAttributes(true);
+    recovering.SetEntityDecoding(HTML_ENTITIES_EAGER);
+    parser.SetSubtreeHashes(true);
+    parser.SetLazyAttributes(true);
+    parser.SetEntityDecoding(HTML_ENTITIES_EAGER);
+    expected = recovering.Parse(kClean);
+    doc = parser.Parse(kClean);
+    ASSERT_EQ(string::npos, parser.GetStrictError());
+    ASSERT_EQ(expected->html(), doc->html());
+    ASSERT_EQ(expected->GetRoot()->ChildBegin()[0]->GetHash(), doc->GetRoot()->ChildBegin()[0]->GetHash());
+}
+
+TEST(strict, errorOffset) {
+    HtmlParser parser;
+    parser.SetStrict(HTML_STRICT_ERROR);
+    vector<string> closed;
+    parser.SetElementCallback([&](const shared_ptr<HtmlElement> &e) { closed.push_back(e->GetName()); });
+
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><p>a</p><b><i>x</b></i></html>");
+    ASSERT_EQ(21u, parser.GetStrictError());
+    ASSERT_EQ(1u, closed.size());
+    ASSERT_EQ("p", closed[0]);
+    // elements still open are dropped
+    ASSERT_TRUE(doc->html().empty());
+
+    parser.Parse("<html><p>unclosed</html>");
+    ASSERT_EQ(17u, parser.GetStrictError());
+    parser.Parse("<html><p>a</p></html>text");
+    ASSERT_EQ(21u, parser.GetStrictError());
+    parser.Parse("<html><a title=\"1>2\">x</a></html>");
+    ASSERT_EQ(8u, parser.GetStrictError());
+    parser.Parse("<html><p>1 < 2</p></html>");
+    ASSERT_EQ(11u, parser.GetStrictError());
+    parser.Parse("<html><p>x</p></html>");
+    ASSERT_EQ(string::npos, parser.GetStrictError());
+}
+
+TEST(strict, fallsBack) {
+    string inputs[] = {
+        "<html><b><i>x</b></i></html>",
+        "<html><ul><li>one<li>two</ul></html>",
+        "<html><a title=\"1>2\">x</a></html>",
+        "<html><p>1 < 2</p><br></br></html>",
+        "<html><p>unclosed",
+    };
+
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        HtmlParser recovering;
+        HtmlParser parser;
+        parser.SetStrict(HTML_STRICT_FALLBACK);
+        ASSERT_EQ(recovering.Parse(inputs[i])->html(), parser.Parse(inputs[i])->html()) << inputs[i];
+        ASSERT_NE(string::npos, parser.GetStrictError());
+    }
+
+    // options strict parsing does not cover use the recovering parser
+    HtmlParser parser;
+    parser.SetStrict(HTML_STRICT_ERROR);
+    parser.SetSourceSpans(true);
+    ASSERT_EQ("<b><i>x</i></b>", parser.Parse(inputs[0])->SelectElement("//b")[0]->html());
+    ASSERT_EQ(string::npos, parser.GetStrictError());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,34 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+TEST(tag, lookupFlags) {
+    ASSERT_EQ(HTML_TAG_VOID | HTML_TAG_BLOCK, HtmlTag::Lookup("br"));
+    ASSERT_EQ(HTML_TAG_VOID | HTML_TAG_INVISIBLE, HtmlTag::Lookup("meta"));
+    ASSERT_EQ(HTML_TAG_RAW_TEXT | HTML_TAG_INVISIBLE, HtmlTag::Lookup("script"));
+    ASSERT_EQ(HTML_TAG_RAW_TEXT, HtmlTag::Lookup("noscript"));
+    ASSERT_EQ(HTML_TAG_TABLE_CELL, HtmlTag::Lookup("td"));
+    ASSERT_EQ(HTML_TAG_BLOCK, HtmlTag::Lookup("h7"));
+    ASSERT_EQ(HTML_TAG_VOID, HtmlTag::Lookup("wbr"));
+    ASSERT_EQ(0u, HtmlTag::Lookup("span"));
+    ASSERT_EQ(0u, HtmlTag::Lookup("BR"));
+    ASSERT_EQ(0u, HtmlTag::Lookup("h8"));
+    ASSERT_EQ(0u, HtmlTag::Lookup(""));
+}
+
+TEST(tag, tableDrivesParserAndText) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><head><title>t</title></head><body><table><tr><td>a</td><td>b</td></tr>"
+                                                "<tr><td>c</td></tr></table><style>p{}</style><p>x<br>y</p></body></html>");
+    ASSERT_EQ("a\tb\nc\nx\ny", doc->text());
+    ASSERT_EQ("p{}", doc->GetElementByTagName("style")[0]->GetValue());
+    ASSERT_TRUE(doc->GetElementByTagName("br")[0]->ChildBegin() == doc->GetElementByTagName("br")[0]->ChildEnd());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
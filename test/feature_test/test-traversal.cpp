@@ -0,0 +1,203 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include "html_parser.hpp"
+#include "html_parser_diff.hpp"
+#include "html_parser_json.hpp"
+#include "html_parser_selector.hpp"
+#include "html_parser_snapshot.hpp"
+
+using namespace std;
+
+static string Repeat(const string &s, size_t n) {
+    string r;
+    r.reserve(s.size() * n);
+    for (size_t i = 0; i < n; i++) r += s;
+    return r;
+}
+
+struct OrderVisitor : HtmlVisitor {
+    HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+        order += "<" + e->GetName();
+        if (!skip.empty() && e->GetAttribute("id") == skip) return HTML_WALK_SKIP;
+        if (!stop.empty() && e->GetAttribute("id") == stop) return HTML_WALK_STOP;
+        return HTML_WALK_CONTINUE;
+    }
+
+    void Leave(const shared_ptr<HtmlElement> &e) {
+        order += ">" + e->GetName();
+    }
+
+    string order;
+    string skip;
+    string stop;
+};
+
+TEST(traversal, enterAndLeaveInDocumentOrder) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><div id=\"d\"><p id=\"p\"><b></b></p><i></i></div><s></s></html>");
+    shared_ptr<HtmlElement> html = doc->GetRoot()->ChildBegin()[0];
+
+    OrderVisitor all;
+    ASSERT_TRUE(html->Walk(all));
+    ASSERT_EQ("<div<p<b>b>p<i>i>div<s>s", all.order);
+
+    OrderVisitor self;
+    ASSERT_TRUE(html->Walk(self, true));
+    ASSERT_EQ("<html<div<p<b>b>p<i>i>div<s>s>html", self.order);
+
+    // a skipped element is left without its children being entered
+    OrderVisitor skip;
+    skip.skip = "p";
+    ASSERT_TRUE(html->Walk(skip));
+    ASSERT_EQ("<div<p>p<i>i>div<s>s", skip.order);
+
+    // stopping leaves nothing
+    OrderVisitor stop;
+    stop.stop = "p";
+    ASSERT_FALSE(html->Walk(stop));
+    ASSERT_EQ("<div<p", stop.order);
+}
+
+TEST(traversal, queriesAndSerializersAreUnchanged) {
+    HtmlParser parser;
+    shared_ptr<HtmlDocument> doc = parser.Parse("<html><body><div id=\"a\" class=\"x y\">one<p class=\"y\">two</p>"
+                                                "<br/><p id=\"b\">three</p></div><p>four</p></body></html>");
+    ASSERT_EQ("div", doc->GetElementById("a")->GetName());
+    ASSERT_EQ("three", doc->GetElementById("b")->GetValue());
+    ASSERT_FALSE(doc->GetElementById("c"));
+    ASSERT_EQ(3u, doc->GetElementByTagName("p").size());
+    ASSERT_EQ(2u, doc->GetElementByClassName("y").size());
+    ASSERT_EQ(3u, doc->SelectElement("//p").size());
+    ASSERT_EQ(2u, doc->SelectElement("//div/p").size());
+
+    shared_ptr<HtmlElement> div = doc->GetElementById("a");
+    ASSERT_EQ("one\ntwo\n\nthree", div->text());
+    ASSERT_EQ("<div class=\"x y\" id=\"a\">one<p class=\"y\">two</p><br></br><p id=\"b\">three</p></div>", div->html());
+}
+
+TEST(traversal, deepTreesDoNotUseTheStack) {
+    const size_t depth = 200000;
+    string html = "<html>" + Repeat("<div>", depth) + "<p id=\"x\" class=\"c\">deep</p>" + Repeat("</div>", depth) + "</html>";
+
+    shared_ptr<HtmlDocument> doc = HtmlParser().Parse(html);
+    ASSERT_EQ("deep", doc->GetElementById("x")->GetValue());
+    ASSERT_EQ(depth, doc->GetElementByTagName("div").size());
+    ASSERT_EQ(1u, doc->GetElementByClassName("c").size());
+    ASSERT_EQ(1u, doc->SelectElement("//p").size());
+
+    shared_ptr<HtmlElement> top = doc->GetRoot()->ChildBegin()[0];
+    ASSERT_EQ("deep", top->text());
+    ASSERT_EQ(html.size(), top->html().size());
+    ASSERT_LT(depth * sizeof(HtmlElement), doc->MemoryUsage().Total());
+    doc->Compact();
+    ASSERT_EQ("deep", doc->GetElementById("x")->GetValue());
+
+    // released without recursion too
+    doc.reset();
+    top.reset();
+}
+
+TEST(traversal, deepTreesInTheOtherTraversals) {
+    const size_t depth = 200000;
+    string html = "<html>" + Repeat("<div>", depth) + "<p id=\"x\">deep</p>" + Repeat("</div>", depth) + "</html>";
+    HtmlParser parser;
+    parser.SetSubtreeHashes(true);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+
+    HtmlSelectorSet set;
+    set.Add("//p");
+    set.Add("//div/div/p");
+    HtmlSelectorSet::Results results = set.Select(doc);
+    ASSERT_EQ(1u, results[0].size());
+    ASSERT_EQ(1u, results[1].size());
+
+    string json = HtmlJsonWriter::ToJson(doc);
+    ASSERT_NE(string::npos, json.find("\"deep\""));
+    ASSERT_EQ("]}]}]", json.substr(json.size() - 5));
+
+    string changed = html;
+    changed.replace(changed.find("deep"), 4, "DEEP");
+    vector<HtmlChange> changes = HtmlTreeDiff::Compare(doc, parser.Parse(changed));
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ("DEEP", changes[0].after->GetValue());
+
+    string image = HtmlSnapshot::Serialize(doc);
+    shared_ptr<HtmlSnapshot> snapshot = HtmlSnapshot::Load(image.data(), image.size());
+    ASSERT_TRUE(snapshot);
+    ASSERT_EQ("deep", snapshot->GetElementById("x").GetValue());
+    ASSERT_EQ("deep", snapshot->text());
+}
+
+TEST(traversal, memoryUsageDoesNotBuildLazySubtrees) {
+    string html = "<html><body>" + Repeat("<ul><li><a href=\"/x\">item</a></li></ul>", 200) + "</body></html>";
+    HtmlParser parser;
+    parser.SetLazySubtrees(3, 0);
+    shared_ptr<HtmlDocument> doc = parser.Parse(html);
+    size_t before = doc->MemoryUsage().Total();
+    ASSERT_EQ(before, doc->MemoryUsage().Total());
+
+    // a walk that expands does build them
+    HtmlVisitor visitor;
+    doc->GetRoot()->Walk(visitor);
+    ASSERT_LT(before, doc->MemoryUsage().Total());
+}
+
+/**
+ * counts what a walk enters and leaves, skipping the elements named skip
+ */
+struct CountVisitor : HtmlVisitor {
+    CountVisitor()
+            : entered(0), left(0), depth(0), deepest(0) {}
+
+    HtmlWalk Enter(const shared_ptr<HtmlElement> &e) {
+        entered++;
+        distinct.insert(e.get());
+        deepest = max(deepest, ++depth);
+        return e->GetName() == skip ? HTML_WALK_SKIP : HTML_WALK_CONTINUE;
+    }
+
+    void Leave(const shared_ptr<HtmlElement> &) {
+        left++;
+        depth--;
+    }
+
+    size_t entered;
+    size_t left;
+    size_t depth;
+    size_t deepest;
+    string skip;
+    set<const HtmlElement *> distinct;
+};
+
+TEST(traversal, visitsEveryElementOnce) {
+    string row = "<tr class=\"row\"><td><a href=\"/x\">link</a></td><td>text <b>bold</b></td></tr>";
+    shared_ptr<HtmlDocument> doc = HtmlParser().Parse("<html><body><table>" + Repeat(row, 8000) + "</table></body></html>");
+
+    // html, body, table and per row: tr, td, a, its text, td, text, b, its text
+    const size_t elements = 3 + 8000 * 8;
+    CountVisitor all;
+    ASSERT_TRUE(doc->GetRoot()->Walk(all));
+    ASSERT_EQ(elements, all.entered);
+    ASSERT_EQ(elements, all.left);
+    ASSERT_EQ(elements, all.distinct.size());
+    ASSERT_EQ(0u, all.depth);
+    ASSERT_EQ(7u, all.deepest);
+
+    // nothing below a skipped element is entered
+    CountVisitor rows;
+    rows.skip = "tr";
+    ASSERT_TRUE(doc->GetRoot()->Walk(rows));
+    ASSERT_EQ(3u + 8000u, rows.entered);
+    ASSERT_EQ(rows.entered, rows.left);
+
+    ASSERT_EQ(8000u, doc->GetElementByTagName("a").size());
+    ASSERT_EQ(8000u, doc->GetElementByClassName("row").size());
+    ASSERT_EQ(8000u, doc->SelectElement("//a").size());
+}
+
+GTEST_API_ int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,50 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <string>
+#include "html_parser.hpp"
+
+using namespace std;
+
+static const string kPage =
+    "<html><head><meta charset=\"utf-8\"><title>Hello</title>"
+    "<link rel=\"stylesheet\" href=\"a.css\"><link rel=\"canonical\" href=\"https://x/y\">"
+    "<meta name=\"description\" content=\"d\"></head><body><div>" + string(10000, 'z') + "</div></body></html>";
+
+TEST(until, stopsOnceTargetsAreSatisfied) {
+    HtmlParser parser;
+    vector<string> targets({"/title", "/link[@rel='canonical']"});
+    HtmlPartialParse result = parser.ParseUntil(kPage, targets);
+
+    ASSERT_TRUE(result.stopped);
+    size_t end = kPage.find("<meta name=");
+    ASSERT_EQ(end, result.offset);
+    ASSERT_EQ("Hello", result.doc->GetElementByTagName("title")[0]->text());
+    ASSERT_EQ("https://x/y", result.doc->SelectElement("//link[@rel='canonical']")[0]->GetAttribute("href"));
+    ASSERT_TRUE(result.doc->SelectElement("//meta[@name='description']").empty());
+    ASSERT_EQ(1u, result.doc->GetElementByTagName("head").size());
+}
+
+TEST(until, stopsAtBoundaryTag) {
+    HtmlParser parser;
+    HtmlPartialParse result = parser.ParseUntil(kPage, vector<string>({"/meta[@name='missing']"}), "body");
+
+    ASSERT_TRUE(result.stopped);
+    ASSERT_EQ(kPage.find("<body>"), result.offset);
+    ASSERT_EQ(2u, result.doc->GetElementByTagName("meta").size());
+    ASSERT_TRUE(result.doc->GetElementByTagName("body").empty());
+    ASSERT_EQ("<html><head><meta charset=\"utf-8\"></meta>", result.doc->html().substr(0, 41));
+}
+
+TEST(until, parsesEverythingWhenNeverSatisfied) {
+    HtmlParser parser;
+    HtmlPartialParse result = parser.ParseUntil(kPage, vector<string>({"/article"}));
+
+    ASSERT_FALSE(result.stopped);
+    ASSERT_EQ(kPage.size(), result.offset);
+    ASSERT_EQ(parser.Parse(kPage)->html(), result.doc->html());
+}
+
+GTEST_API_ int main(int argc, char ** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}